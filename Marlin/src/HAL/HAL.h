@@ -24,6 +24,7 @@
  * Supports platforms :
  *    ARDUINO_ARCH_SAM : For Arduino Due and other boards based on Atmel SAM3X8E
  *    __AVR__ : For all Atmel AVR boards
+ *    __PLAT_LINUX__ : Simulation running on a Linux host
  */
 
 #ifndef _HAL_H
@@ -48,6 +49,9 @@
 #elif defined(__STM32F1__) || defined(TARGET_STM32F1)
   #include "math_32bit.h"
   #include "HAL_STM32F1/HAL_Stm32f1.h"
+#elif defined(__PLAT_LINUX__)
+  #include "math_32bit.h"
+  #include "HAL_LINUX/HAL.h"
 #else
   #error "Unsupported Platform!"
 #endif
@@ -96,4 +96,18 @@
   #endif
 #endif // SPINDLE_LASER_ENABLE
 
+/**
+ * The AVR ADC has no scan mode
+ */
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+  #error "ADC_CONTINUOUS_SCAN is not supported on AVR."
+#endif
+
+/**
+ * AVR timers are shared with the system, stepper and temperature interrupts
+ */
+#if ENABLED(HARDWARE_PWM_HEATERS)
+  #error "HARDWARE_PWM_HEATERS is not supported on AVR."
+#endif
+
 #endif // _SANITYCHECK_AVR_8_BIT_H_
@@ -31,7 +31,7 @@
 // Includes
 // --------------------------------------------------------------------------
 
-#include "../HAL.h"
+#include "../../inc/MarlinConfig.h"
 
 #include <Wire.h>
 
@@ -121,4 +121,52 @@ uint16_t HAL_adc_get_result(void) {
   return HAL_adc_result;
 }
 
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+
+  #include "../adc_scan.h"
+
+  /**
+   * Free-running mode: the ADC converts every enabled channel in turn,
+   * forever, leaving the latest result of each channel in ADC_CDR[ch].
+   */
+  static uint8_t scan_channel[ADC_SCAN_MAX_CHANNELS];
+
+  void HAL_adc_scan_start(const pin_t pins[], const uint8_t count) {
+    uint32_t mask = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      const pin_t pin = pins[i] < A0 ? pins[i] + A0 : pins[i];
+      scan_channel[i] = g_APinDescription[pin].ulADCChannelNumber;
+      SBI(mask, scan_channel[i]);
+    }
+    ADC->ADC_IDR = 0xFFFFFFFF;            // No interrupts, results are polled
+    ADC->ADC_MR |= ADC_MR_FREERUN_ON;     // Convert continuously without triggers
+    ADC->ADC_CHER = mask;
+    ADC->ADC_CR = ADC_CR_START;
+  }
+
+  uint16_t HAL_adc_scan_sample(const uint8_t index) {
+    return (ADC->ADC_CDR[scan_channel[index]] >> 2) & 0x3FF; // 12 to 10 bits
+  }
+
+#endif // ADC_CONTINUOUS_SCAN
+
+// --------------------------------------------------------------------------
+// Hardware PWM
+// --------------------------------------------------------------------------
+
+#if ENABLED(HARDWARE_PWM_HEATERS)
+
+  /**
+   * Only pins on the PWM controller are used. Pins that analogWrite()
+   * would drive from a TC channel could collide with the stepper and
+   * temperature timers, so those stay on soft PWM.
+   */
+  bool HAL_pwm_attach(const pin_t pin) {
+    return (g_APinDescription[pin].ulPinAttribute & PIN_ATTR_PWM) != 0;
+  }
+
+  void HAL_pwm_write(const pin_t pin, const uint8_t value) { analogWrite(pin, value); }
+
+#endif // HARDWARE_PWM_HEATERS
+
 #endif // ARDUINO_ARCH_SAM
@@ -147,6 +147,15 @@ inline void HAL_adc_init(void) {}//todo
 
 void HAL_adc_start_conversion(const uint8_t adc_pin);
 uint16_t HAL_adc_get_result(void);
+void HAL_adc_scan_start(const pin_t pins[], const uint8_t count);
+uint16_t HAL_adc_scan_sample(const uint8_t index);
+
+/**
+ * Hardware PWM for heaters and fans
+ */
+
+bool HAL_pwm_attach(const pin_t pin);
+void HAL_pwm_write(const pin_t pin, const uint8_t value);
 uint16_t HAL_getAdcReading(uint8_t chan);
 void HAL_startAdcConversion(uint8_t chan);
 uint8_t HAL_pinToAdcChannel(int pin);
@@ -27,3 +27,10 @@
 /**
  * Require gcc 4.7 or newer (first included with Arduino 1.6.8) for C++11 features.
  */
+
+/**
+ * The u8g hardware SPI com functions aren't implemented for the Due HAL
+ */
+#if ENABLED(DOGM_HARDWARE_SPI)
+  #error "DOGM_HARDWARE_SPI is not yet supported on Arduino Due."
+#endif
@@ -6,46 +6,86 @@
 
 #if ENABLED(EEPROM_SETTINGS)
 
+#define EEPROM_READ_BLOCK 32
+
+// Writes are staged one page at a time. 16 divides the page size of all the
+// usual I2C and SPI parts and fits in the Wire buffer with the address bytes.
+#define EEPROM_PAGE_WRITE 16
+
 namespace HAL {
 namespace PersistentStore {
 
+static uint8_t page_buffer[EEPROM_PAGE_WRITE];
+static int page_address = -1; // EEPROM address of the staged page, or -1
+
+// Write the staged page back, if it differs from the EEPROM
+static bool flush_page() {
+  if (page_address < 0) return false;
+  uint8_t current[EEPROM_PAGE_WRITE];
+  eeprom_read_block(current, (const void*)page_address, EEPROM_PAGE_WRITE);
+  bool failed = false;
+  // EEPROM has only ~100,000 write cycles,
+  // so only write pages that have changed!
+  if (memcmp(current, page_buffer, EEPROM_PAGE_WRITE)) {
+    eeprom_update_block(page_buffer, (void*)page_address, EEPROM_PAGE_WRITE);
+    eeprom_read_block(current, (const void*)page_address, EEPROM_PAGE_WRITE);
+    if (memcmp(current, page_buffer, EEPROM_PAGE_WRITE)) {
+      SERIAL_ECHO_START();
+      SERIAL_ECHOLNPGM(MSG_ERR_EEPROM_WRITE);
+      failed = true;
+    }
+  }
+  page_address = -1;
+  return failed;
+}
+
 bool access_start() {
+  page_address = -1;
   return true;
 }
 
 bool access_finish(){
-  return true;
+  return !flush_page();
 }
 
+/**
+ * Each byte write costs a full EEPROM write cycle (5ms or more), which made
+ * M500 crawl when many values changed. Collect the writes in a RAM copy of
+ * the current page instead and write each changed page only once.
+ */
 bool write_data(int &pos, const uint8_t *value, uint16_t size, uint16_t *crc) {
-  while (size--) {
-    uint8_t * const p = (uint8_t * const)pos;
-    uint8_t v = *value;
-    // EEPROM has only ~100,000 write cycles,
-    // so only write bytes that have changed!
-    if (v != eeprom_read_byte(p)) {
-      eeprom_write_byte(p, v);
-      if (eeprom_read_byte(p) != v) {
-        SERIAL_ECHO_START();
-        SERIAL_ECHOLNPGM(MSG_ERR_EEPROM_WRITE);
-        return true;
-      }
+  bool failed = false;
+  while (size) {
+    const int base = pos - pos % EEPROM_PAGE_WRITE;
+    if (base != page_address) {
+      failed |= flush_page();
+      eeprom_read_block(page_buffer, (const void*)base, EEPROM_PAGE_WRITE);
+      page_address = base;
     }
-    crc16(crc, &v, 1);
-    pos++;
-    value++;
-  };
-  return false;
+    const uint8_t offset = pos - base,
+                  room = EEPROM_PAGE_WRITE - offset,
+                  n = size > room ? room : size;
+    memcpy(&page_buffer[offset], value, n);
+    crc16(crc, value, n);
+    pos += n;
+    value += n;
+    size -= n;
+  }
+  return failed;
 }
 
 bool read_data(int &pos, uint8_t* value, uint16_t size, uint16_t *crc) {
-  do {
-    uint8_t c = eeprom_read_byte((unsigned char*)pos);
-    *value = c;
-    crc16(crc, &c, 1);
-    pos++;
-    value++;
-  } while (--size);
+  if (flush_page()) return true;
+  // Stream blocks from the external EEPROM instead of addressing each byte.
+  // An I2C read can't be longer than the Wire buffer.
+  while (size) {
+    const uint8_t n = size > EEPROM_READ_BLOCK ? EEPROM_READ_BLOCK : size;
+    eeprom_read_block(value, (const void*)pos, n);
+    crc16(crc, value, n);
+    pos += n;
+    value += n;
+    size -= n;
+  }
   return false;
 }
 
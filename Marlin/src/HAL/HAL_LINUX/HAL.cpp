@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "heater.h"
+
+// There is no fixed RAM to run out of
+int freeMemory() { return 0; }
+
+// --------------------------------------------------------------------------
+// ADC
+// --------------------------------------------------------------------------
+
+// Conversions are instant: the heater model is read when the result is
+static uint8_t active_adc = 0;
+
+void HAL_adc_init(void) {}
+
+void HAL_adc_start_conversion(const uint8_t ch) { active_adc = ch; }
+
+uint16_t HAL_adc_get_result(void) { return Heater::read_adc(active_adc); }
+
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+
+  #include "../adc_scan.h"
+
+  static uint8_t scan_channel[ADC_SCAN_MAX_CHANNELS];
+
+  void HAL_adc_scan_start(const pin_t pins[], const uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) scan_channel[i] = pins[i];
+  }
+
+  uint16_t HAL_adc_scan_sample(const uint8_t index) { return Heater::read_adc(scan_channel[index]); }
+
+#endif // ADC_CONTINUOUS_SCAN
+
+#endif // __PLAT_LINUX__
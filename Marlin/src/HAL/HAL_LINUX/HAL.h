@@ -0,0 +1,96 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Description: HAL for the Linux simulation
+ *
+ * For __PLAT_LINUX__
+ *
+ * Marlin runs as an ordinary Linux process with a simulated RAMPS board:
+ * virtual timers and GPIO, heaters with a thermal model, axes that drive
+ * their endstops, an SD card image and a file for EEPROM. See main.cpp
+ * for the command line.
+ */
+
+#ifndef _HAL_LINUX_H
+#define _HAL_LINUX_H
+
+#define F_CPU 100000000   // Simulated clock. Only the timer rates depend on it.
+
+// --------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdarg.h>
+
+#undef min
+#undef max
+
+#include <algorithm>
+
+//arduino: binary.h (weird defines)
+#define B01 1
+#define B10 2
+
+#include "include/arduino.h"
+
+#include "pinmapping.h"
+#include "fastio.h"
+#include "watchdog.h"
+#include "serial.h"
+#include "timers.h"
+
+// Serial: a PTY for host software, or stdin / stdout
+extern HalSerial usb_serial;
+#define MYSERIAL usb_serial
+
+#define CRITICAL_SECTION_START  const bool irqon = Clock::interrupts_enabled(); Clock::disable_interrupts();
+#define CRITICAL_SECTION_END    if (irqon) Clock::enable_interrupts();
+
+// Simulation settings from the command line
+extern const char *eeprom_file_path;
+
+//Utility functions
+int freeMemory(void);
+
+// SPI: Extended functions which take a channel number (hardware SPI only)
+/** Write single byte to specified SPI channel */
+void spiSend(uint32_t chan, byte b);
+/** Write buffer to specified SPI channel */
+void spiSend(uint32_t chan, const uint8_t* buf, size_t n);
+/** Read single byte from specified SPI channel */
+uint8_t spiRec(uint32_t chan);
+
+// ADC
+#define HAL_ANALOG_SELECT(pin) NOOP
+#define HAL_START_ADC(pin)     HAL_adc_start_conversion(pin)
+#define HAL_READ_ADC           HAL_adc_get_result()
+
+void HAL_adc_init(void);
+void HAL_adc_start_conversion(const uint8_t adc_pin);
+uint16_t HAL_adc_get_result(void);
+
+void HAL_adc_scan_start(const pin_t pins[], const uint8_t count);
+uint16_t HAL_adc_scan_sample(const uint8_t index);
+
+#endif // _HAL_LINUX_H
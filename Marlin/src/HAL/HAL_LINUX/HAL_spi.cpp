@@ -0,0 +1,86 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * SPI for the Linux simulation
+ *
+ * The only device on the bus is the simulated SD card. It takes part in
+ * a transfer while its chip select (SDSS) is held LOW; otherwise MISO
+ * floats high and reads 0xFF, as with no card fitted.
+ */
+
+#ifdef __PLAT_LINUX__
+
+// --------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------
+
+#include "../../inc/MarlinConfig.h"
+#include "spi_pins.h"
+#include "sd_image.h"
+
+#ifdef SDSS
+  #define SD_CS_PIN SDSS
+#else
+  #define SD_CS_PIN SS_PIN
+#endif
+
+static uint8_t spiTransfer(const uint8_t b) {
+  return READ(SD_CS_PIN) ? 0xFF : SdImage::transfer(b);
+}
+
+// --------------------------------------------------------------------------
+// Public functions
+// --------------------------------------------------------------------------
+
+void spiBegin() {
+  SET_OUTPUT(SCK_PIN);
+  SET_INPUT(MISO_PIN);
+  SET_OUTPUT(MOSI_PIN);
+  OUT_WRITE(SS_PIN, HIGH);
+}
+
+void spiInit(uint8_t spiRate) { UNUSED(spiRate); }
+
+uint8_t spiRec() { return spiTransfer(0xFF); }
+
+void spiRead(uint8_t* buf, uint16_t nbyte) {
+  for (uint16_t i = 0; i < nbyte; i++) buf[i] = spiTransfer(0xFF);
+}
+
+void spiSend(uint8_t b) { (void)spiTransfer(b); }
+
+void spiSend(const uint8_t* buf, size_t n) {
+  for (size_t i = 0; i < n; i++) (void)spiTransfer(buf[i]);
+}
+
+void spiSendBlock(uint8_t token, const uint8_t* buf) {
+  (void)spiTransfer(token);
+  for (uint16_t i = 0; i < 512; i++) (void)spiTransfer(buf[i]);
+}
+
+// Extended functions which take a channel number. There is only one bus.
+void spiSend(uint32_t chan, byte b) { UNUSED(chan); spiSend(b); }
+void spiSend(uint32_t chan, const uint8_t* buf, size_t n) { UNUSED(chan); spiSend(buf, n); }
+uint8_t spiRec(uint32_t chan) { UNUSED(chan); return spiRec(); }
+
+#endif // __PLAT_LINUX__
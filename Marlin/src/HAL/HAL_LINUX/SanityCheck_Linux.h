@@ -0,0 +1,41 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Test Linux simulation specific configuration values for errors at compile-time.
+ */
+
+#if !MB(LINUX_RAMPS)
+  #error "The Linux simulation requires MOTHERBOARD BOARD_LINUX_RAMPS."
+#endif
+
+#if IS_CORE
+  #error "The Linux simulation only models Cartesian and delta machines."
+#endif
+
+#if ENABLED(ULTRA_LCD)
+  #error "The Linux simulation has no display. Disable the LCD controller."
+#endif
+
+#if ENABLED(HARDWARE_PWM_HEATERS)
+  #error "HARDWARE_PWM_HEATERS is not available in the Linux simulation."
+#endif
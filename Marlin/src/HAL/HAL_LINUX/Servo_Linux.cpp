@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if HAS_SERVOS && defined(__PLAT_LINUX__)
+
+  #include "Servo_Linux.h"
+
+  #define MIN_PULSE_WIDTH       544     // the shortest pulse sent to a servo
+  #define MAX_PULSE_WIDTH      2400     // the longest pulse sent to a servo
+  #define DEFAULT_PULSE_WIDTH  1500     // default pulse width when servo is attached
+  #define INVALID_SERVO         255     // flag indicating an invalid servo index
+
+  static uint8_t ServoCount = 0;        // the total number of servos
+
+  Servo::Servo() : pin(-1), pulse_width(DEFAULT_PULSE_WIDTH), active(false) {
+    servoIndex = ServoCount < NUM_SERVOS ? ServoCount++ : INVALID_SERVO;
+  }
+
+  int8_t Servo::attach(const int pin) {
+    return this->attach(pin, MIN_PULSE_WIDTH, MAX_PULSE_WIDTH);
+  }
+
+  int8_t Servo::attach(const int pin, const int min, const int max) {
+    UNUSED(min);
+    UNUSED(max);
+    if (this->servoIndex == INVALID_SERVO) return -1;
+    if (pin > 0) this->pin = pin;     // move() attaches with pin 0 to keep the pin
+    this->active = true;
+    return this->servoIndex;
+  }
+
+  void Servo::detach() { this->active = false; }
+
+  void Servo::write(int value) {
+    if (value < MIN_PULSE_WIDTH) // treat values less than 544 as angles in degrees
+      value = map(constrain(value, 0, 180), 0, 180, MIN_PULSE_WIDTH, MAX_PULSE_WIDTH);
+    this->writeMicroseconds(value);
+  }
+
+  void Servo::writeMicroseconds(int value) {
+    this->pulse_width = constrain(value, MIN_PULSE_WIDTH, MAX_PULSE_WIDTH);
+  }
+
+  // return the value as degrees
+  int Servo::read() { return map(this->readMicroseconds() + 1, MIN_PULSE_WIDTH, MAX_PULSE_WIDTH, 0, 180); }
+
+  int Servo::readMicroseconds() { return this->servoIndex == INVALID_SERVO ? 0 : this->pulse_width; }
+
+  bool Servo::attached() { return this->active; }
+
+  void Servo::move(const int value) {
+    constexpr uint16_t servo_delay[] = SERVO_DELAY;
+    static_assert(COUNT(servo_delay) == NUM_SERVOS, "SERVO_DELAY must be an array NUM_SERVOS long.");
+    if (this->attach(0) >= 0) {
+      this->write(value);
+      delay(servo_delay[this->servoIndex]);
+      #if ENABLED(DEACTIVATE_SERVOS_AFTER_MOVE)
+        this->detach();
+      #endif
+    }
+  }
+
+#endif // HAS_SERVOS && __PLAT_LINUX__
@@ -0,0 +1,118 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "heater.h"
+
+// Interrupts
+void cli(void) { Clock::disable_interrupts(); } // Disable
+void sei(void) { Clock::enable_interrupts(); }  // Enable
+
+void attachInterrupt(const pin_t pin, void (*callback)(void), const uint32_t mode) {
+  Gpio::attach_interrupt(pin, callback, mode);
+}
+
+void detachInterrupt(const pin_t pin) { Gpio::detach_interrupt(pin); }
+
+// Time functions. Every one of them is a safe point for interrupts.
+void _delay_ms(const int delay_ms) { delay(delay_ms); }
+
+uint32_t millis() {
+  Clock::poll();
+  return Clock::millis();
+}
+
+uint32_t micros() {
+  Clock::poll();
+  return Clock::micros();
+}
+
+void delayMicroseconds(unsigned long us) { Clock::delay(uint64_t(us) * 1000UL); }
+
+void delay(const int msec) { Clock::delay(uint64_t(msec) * 1000000UL); }
+
+// IO functions
+// As defined by Arduino INPUT(0x0), OUPUT(0x1), INPUT_PULLUP(0x2)
+void pinMode(const pin_t pin, const uint8_t mode) {
+  switch (mode) {
+    case INPUT:        Gpio::set_mode(pin, Gpio::pin_input); break;
+    case OUTPUT:       Gpio::set_mode(pin, Gpio::pin_output); break;
+    case INPUT_PULLUP: Gpio::set_mode(pin, Gpio::pin_input_pullup); break;
+    default: break;
+  }
+}
+
+void digitalWrite(pin_t pin, uint8_t pin_status) {
+  Gpio::set(pin, pin_status);
+  pinMode(pin, OUTPUT);  // Set pin mode on every write (Arduino version does this)
+}
+
+bool digitalRead(pin_t pin) { return Gpio::get(pin); }
+
+// 1 - 254: pwm_value, 0: LOW, 255: HIGH. The duty is only recorded.
+void analogWrite(pin_t pin, int pwm_value) {
+  const uint8_t value = constrain(pwm_value, 0, 255);
+  Gpio::set_pwm(pin, value);
+  digitalWrite(pin, value > 127);
+}
+
+// Takes an analog channel, or the digital pin of one
+uint16_t analogRead(pin_t adc_pin) {
+  const int8_t ch = adc_pin < ANALOG_PIN_OFFSET ? adc_pin : DIGITAL_PIN_TO_ANALOG_PIN(adc_pin);
+  return ch < 0 ? 0 : Heater::read_adc(ch);
+}
+
+// EEPROM, read straight from the file. Settings go through PersistentStore.
+void eeprom_read_block(void *__dst, const void *__src, size_t __n) {
+  memset(__dst, 0xFF, __n);
+  FILE * const file = fopen(eeprom_file_path, "rb");
+  if (!file) return;
+  if (!fseek(file, (long)(uintptr_t)__src, SEEK_SET)) (void)fread(__dst, 1, __n, file);
+  fclose(file);
+}
+
+char *dtostrf (double __val, signed char __width, unsigned char __prec, char *__s) {
+  char format_string[20];
+  snprintf(format_string, 20, "%%%d.%df", __width, __prec);
+  sprintf(__s, format_string, __val);
+  return __s;
+}
+
+int32_t random(int32_t max) {
+  return rand() % max;
+}
+
+int32_t random(int32_t min, int32_t max) {
+  return min + rand() % (max - min);
+}
+
+void randomSeed(uint32_t value) {
+  srand(value);
+}
+
+int map(uint16_t x, uint16_t in_min, uint16_t in_max, uint16_t out_min, uint16_t out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+#endif // __PLAT_LINUX__
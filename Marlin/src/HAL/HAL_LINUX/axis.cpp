@@ -0,0 +1,104 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "axis.h"
+#include "gpio.h"
+
+static Axis axes[XYZE];
+
+#if ENABLED(DELTA)
+  // Tower carriages run from the bed up to the endstops at the top
+  #define SIM_TOWER_TOP ((DELTA_HEIGHT) + SQRT(sq(DELTA_DIAGONAL_ROD) - sq(DELTA_RADIUS)))
+  #define SIM_X_TRAVEL 0, SIM_TOWER_TOP
+  #define SIM_Y_TRAVEL 0, SIM_TOWER_TOP
+  #define SIM_Z_TRAVEL 0, SIM_TOWER_TOP
+#else
+  #define SIM_X_TRAVEL X_MIN_POS, X_MAX_POS
+  #define SIM_Y_TRAVEL Y_MIN_POS, Y_MAX_POS
+  #define SIM_Z_TRAVEL Z_MIN_POS, Z_MAX_POS
+#endif
+
+void Axis::init_all() {
+  const float steps_per_mm[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+  axes[X_AXIS].init(X_STEP_PIN, INVERT_X_STEP_PIN, X_DIR_PIN, INVERT_X_DIR,
+                    X_MIN_PIN, X_MIN_ENDSTOP_INVERTING, X_MAX_PIN, X_MAX_ENDSTOP_INVERTING,
+                    steps_per_mm[X_AXIS], SIM_X_TRAVEL);
+  axes[Y_AXIS].init(Y_STEP_PIN, INVERT_Y_STEP_PIN, Y_DIR_PIN, INVERT_Y_DIR,
+                    Y_MIN_PIN, Y_MIN_ENDSTOP_INVERTING, Y_MAX_PIN, Y_MAX_ENDSTOP_INVERTING,
+                    steps_per_mm[Y_AXIS], SIM_Y_TRAVEL);
+  axes[Z_AXIS].init(Z_STEP_PIN, INVERT_Z_STEP_PIN, Z_DIR_PIN, INVERT_Z_DIR,
+                    Z_MIN_PIN, Z_MIN_ENDSTOP_INVERTING, Z_MAX_PIN, Z_MAX_ENDSTOP_INVERTING,
+                    steps_per_mm[Z_AXIS], SIM_Z_TRAVEL);
+  // The extruder has no ends of travel
+  axes[E_AXIS].init(E0_STEP_PIN, INVERT_E_STEP_PIN, E0_DIR_PIN, INVERT_E0_DIR,
+                    -1, false, -1, false, steps_per_mm[E_AXIS], 0, 0);
+}
+
+float Axis::position_mm(const uint8_t axis) {
+  const Axis &a = axes[axis];
+  return a.origin + a.position / a.steps_mm;
+}
+
+void Axis::init(const pin_t step, const bool step_invert, const pin_t dir, const bool dir_invert,
+                const pin_t min_endstop, const bool min_invert, const pin_t max_endstop, const bool max_invert,
+                const float steps_per_mm, const float min_pos, const float max_pos
+) {
+  step_pin = step;
+  dir_pin = dir;
+  min_pin = min_endstop;
+  max_pin = max_endstop;
+  step_level = !step_invert;
+  forward_level = !dir_invert;
+  min_inverting = min_invert;
+  max_inverting = max_invert;
+  steps_mm = steps_per_mm;
+  origin = min_pos;
+  travel = (max_pos - min_pos) * steps_per_mm;
+  position = travel / 2;
+  Gpio::attach_listener(step_pin, step_changed);
+  update_endstops();
+}
+
+/**
+ * An endstop reads as triggered when the pin differs from its inverting
+ * setting, so drive the level the firmware will take as the switch state.
+ */
+void Axis::update_endstops() {
+  Gpio::drive(min_pin, (position <= 0) != min_inverting);
+  Gpio::drive(max_pin, (position >= travel) != max_inverting);
+}
+
+void Axis::step_changed(const pin_t pin, const bool value) {
+  for (uint8_t i = 0; i < COUNT(axes); i++) {
+    Axis &a = axes[i];
+    if (a.step_pin != pin) continue;
+    if (value != a.step_level) return; // End of the pulse
+    a.position += Gpio::get(a.dir_pin) == a.forward_level ? 1 : -1;
+    a.update_endstops();
+    return;
+  }
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,66 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Simulated axes for the Linux simulation
+ *
+ * Each motor moves a carriage one step per pulse on its STEP pin, in the
+ * direction its DIR pin sets. The carriage drives the endstop pins at
+ * either end of travel, so homing and endstop hits behave as on a real
+ * Cartesian machine, or a delta with the endstops at the top of its
+ * towers. Carriages start in the middle of their travel.
+ */
+
+#ifndef _HAL_LINUX_AXIS_H_
+#define _HAL_LINUX_AXIS_H_
+
+#include <stdint.h>
+#include "pinmapping.h"
+
+class Axis {
+public:
+  // Set up X, Y, Z and E0 from the configuration
+  static void init_all();
+
+  // Carriage position in mm, for reports
+  static float position_mm(const uint8_t axis);
+
+  void init(const pin_t step, const bool step_invert, const pin_t dir, const bool dir_invert,
+            const pin_t min_endstop, const bool min_invert, const pin_t max_endstop, const bool max_invert,
+            const float steps_per_mm, const float min_pos, const float max_pos);
+
+  int32_t position;   // Steps from the minimum end of travel
+
+private:
+  pin_t step_pin, dir_pin, min_pin, max_pin;
+  bool step_level,    // STEP level that starts a pulse
+       forward_level, // DIR level for positive motion
+       min_inverting, max_inverting;
+  int32_t travel;     // Steps from one end to the other
+  float steps_mm, origin;
+
+  void update_endstops();
+
+  static void step_changed(const pin_t pin, const bool value);
+};
+
+#endif // _HAL_LINUX_AXIS_H_
@@ -0,0 +1,182 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "benchmark.h"
+#include "../../gcode/gcode.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+#include "../../module/stepper.h"
+#include "../../module/temperature.h"
+
+#if HAS_LEVELING
+  #include "../../feature/bedlevel/bedlevel.h"
+#endif
+
+#if ENABLED(CPU_PROFILER)
+  #include "../../feature/profiler.h"
+#endif
+
+#include <ctype.h>
+
+bench_stats_t Benchmark::file, Benchmark::total;
+uint32_t Benchmark::period;
+uint8_t Benchmark::last_head, Benchmark::quiet_polls;
+
+/**
+ * Stand-in for the stepper ISR, run once per poll of the clock. Take the
+ * oldest block when the queue is full, or when nothing was queued since
+ * the last poll: the planner is then waiting for the queue to empty (M400,
+ * homing moves, the end of a file). Everything is counted in polls, so
+ * the queue goes the same way however fast the host is.
+ */
+void Benchmark::step_isr() {
+  HAL_timer_set_count(STEP_TIMER_NUM, period);
+  const uint8_t head = planner.block_buffer_head;
+  if (head != last_head) { last_head = head; quiet_polls = 0; }
+  if ((planner.is_full() || ++quiet_polls > BENCHMARK_QUIET_POLLS) && planner.get_current_block()) {
+    file.depth_total += planner.movesplanned();
+    file.blocks++;
+    planner.discard_current_block();
+  }
+}
+
+// Commands that would wait for an endstop, a heater or the user
+static bool must_skip() {
+  switch (parser.command_letter) {
+    case 'G': switch (parser.codenum) {
+      case 4: case 28: case 29: case 30: case 33: return true;
+    } break;
+    case 'M': switch (parser.codenum) {
+      case 0: case 1: case 48: case 109: case 190: case 226: case 303: case 600: return true;
+    } break;
+  }
+  return false;
+}
+
+bool Benchmark::replay(const char * const path) {
+  FILE * const f = fopen(path, "r");
+  if (!f) { perror(path); return false; }
+
+  // Read it all first, so the disk isn't timed
+  fseek(f, 0, SEEK_END);
+  const long size = ftell(f);
+  rewind(f);
+  char * const text = (char*)malloc(size + 1);
+  const bool ok = text && fread(text, 1, size, f) == (size_t)size;
+  fclose(f);
+  if (!ok) { fprintf(stderr, "%s: read failed\n", path); free(text); return false; }
+  text[size] = '\0';
+
+  // Start every run where G28 would leave the machine
+  #if HAS_LEVELING
+    set_bed_leveling_enabled(false);
+  #endif
+  LOOP_XYZ(i) set_axis_is_at_home((AxisEnum)i);
+  current_position[E_AXIS] = 0;
+  SYNC_PLAN_POSITION_KINEMATIC();
+
+  memset(&file, 0, sizeof(file));
+  #if ENABLED(CPU_PROFILER)
+    Profiler::reset();
+  #endif
+
+  const uint64_t start_ns = host_nanos();
+  for (char *line = text, *next; *line; line = next) {
+    next = strchr(line, '\n');
+    if (next) *next++ = '\0'; else next = line + strlen(line);
+
+    // Drop the comment and checksum, as the command queue does
+    char *end = line + strcspn(line, ";*");
+    while (end > line && isspace(end[-1])) end--;
+    *end = '\0';
+    while (isspace(*line)) line++;
+    if (!*line) continue;
+
+    parser.parse(line);
+    if (must_skip()) { file.skipped++; continue; }
+    gcode.process_parsed_command();
+    file.commands++;
+  }
+  file.elapsed_ns = host_nanos() - start_ns;
+
+  stepper.synchronize(); // Let the stand-in empty the queue, untimed
+  free(text);
+
+  #if ENABLED(CPU_PROFILER)
+    file.planner_ns = Profiler::stats[PROFILE_PLANNER].total * 1000UL / (PROFILER_TICKS_PER_US);
+  #endif
+  return true;
+}
+
+void Benchmark::report(const char * const name, const bench_stats_t &s) {
+  const double secs = s.elapsed_ns * 1e-9;
+  printf("%s: %u commands, %u skipped, %u blocks in %.3fs: %.0f commands/s, %.0f blocks/s",
+    name, s.commands, s.skipped, s.blocks, secs, secs > 0 ? s.commands / secs : 0.0, secs > 0 ? s.blocks / secs : 0.0
+  );
+  #if ENABLED(CPU_PROFILER)
+    if (s.blocks) printf(", planner %.2fus/block", s.planner_ns * 1e-3 / s.blocks);
+  #endif
+  printf(", queue depth %.1f\n", s.blocks ? double(s.depth_total) / s.blocks : 0.0);
+}
+
+int Benchmark::run(char * const files[], const int count, const uint32_t poll_ns, const uint16_t repeat) {
+  if (!count) { fprintf(stderr, "No G-code files to replay\n"); return EXIT_FAILURE; }
+
+  period = poll_ns / (HAL_TIMER_NS_PER_TICK);
+  last_head = planner.block_buffer_head;
+  sim_step_isr = step_isr;
+  HAL_timer_set_count(STEP_TIMER_NUM, period);
+
+  #if ENABLED(PREVENT_COLD_EXTRUSION)
+    thermalManager.allow_cold_extrude = true; // M109 is skipped, so the hotend stays cold
+  #endif
+
+  memset(&total, 0, sizeof(total));
+  for (int i = 0; i < count; i++) {
+    // Keep the fastest run. The others only differ by host noise.
+    bench_stats_t best;
+    for (uint16_t r = 0; r < repeat; r++) {
+      if (!replay(files[i])) return EXIT_FAILURE;
+      if (!r)
+        best = file;
+      else {
+        if (file.blocks != best.blocks)
+          fprintf(stderr, "%s: %u blocks, then %u: the replay isn't repeatable\n", files[i], best.blocks, file.blocks);
+        if (file.elapsed_ns < best.elapsed_ns) best = file;
+      }
+    }
+    report(files[i], best);
+    total.commands += best.commands;
+    total.skipped += best.skipped;
+    total.blocks += best.blocks;
+    total.depth_total += best.depth_total;
+    total.elapsed_ns += best.elapsed_ns;
+    total.planner_ns += best.planner_ns;
+  }
+  if (count > 1) report("total", total);
+  return EXIT_SUCCESS;
+}
+
+#endif // __PLAT_LINUX__
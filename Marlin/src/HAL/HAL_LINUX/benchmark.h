@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Replay benchmark for the Linux simulation
+ *
+ * Feeds G-code files straight through the parser, the G-code handlers
+ * and the planner, and reports how fast they went. The stepper ISR is
+ * replaced by a stand-in that only takes blocks off the queue, so the
+ * figures are for the motion pipeline alone. Time is lock-step, and the
+ * stand-in takes a block only when the planner is waiting for room or
+ * has stopped queuing, so each run plans exactly the same blocks with
+ * the queue as full as on a printer that can't keep up.
+ *
+ * Homing, probing and commands that wait for heaters or the user are
+ * skipped: nothing would ever trigger an endstop or end the wait.
+ *
+ * The planner time per block needs CPU_PROFILER. Sample files can be
+ * made with buildroot/share/scripts/benchmark_corpus.py.
+ */
+
+#ifndef _HAL_LINUX_BENCHMARK_H_
+#define _HAL_LINUX_BENCHMARK_H_
+
+#include <stdint.h>
+
+// Polls without a new block before the planner counts as waiting for the
+// queue to empty. Running a command polls the clock a few times.
+#ifndef BENCHMARK_QUIET_POLLS
+  #define BENCHMARK_QUIET_POLLS 8
+#endif
+
+typedef struct {
+  uint32_t commands,    // Commands run
+           skipped,     // Commands left out
+           blocks;      // Blocks taken off the queue
+  uint64_t depth_total, // Sum of the queue depth at each block taken
+           elapsed_ns,  // Host time to parse and run the commands
+           planner_ns;  // Host time spent planning blocks
+} bench_stats_t;
+
+class Benchmark {
+public:
+  // Replay each file 'repeat' times, after setup(). Returns the exit status.
+  static int run(char * const files[], const int count, const uint32_t poll_ns, const uint16_t repeat);
+
+private:
+  static bool replay(const char * const path);
+  static void report(const char * const name, const bench_stats_t &s);
+  static void step_isr();
+
+  static bench_stats_t file, total;
+  static uint32_t period;   // Stepper timer ticks per poll of the clock
+  static uint8_t last_head,   // Planner queue head at the last poll
+                 quiet_polls; // Polls since a block was last queued
+};
+
+#endif // _HAL_LINUX_BENCHMARK_H_
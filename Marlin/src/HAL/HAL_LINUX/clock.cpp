@@ -0,0 +1,106 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "clock.h"
+#include "gpio.h"
+
+#include <time.h>
+
+uint64_t Clock::now_ns,
+         Clock::host_start_ns;
+double Clock::time_multiplier;
+uint32_t Clock::poll_step_ns;
+bool Clock::irq_enabled;
+uint8_t Clock::isr_depth;
+
+uint64_t host_nanos() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return uint64_t(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+void Clock::init(const double multiplier, const uint32_t poll_ns) {
+  time_multiplier = multiplier;
+  poll_step_ns = poll_ns;
+  host_start_ns = host_nanos();
+  now_ns = 0;
+  irq_enabled = true;
+  isr_depth = 0;
+}
+
+uint64_t Clock::host_virtual_ns() {
+  return uint64_t((host_nanos() - host_start_ns) * time_multiplier);
+}
+
+/**
+ * Move virtual time up to 'target', running each timer interrupt at the
+ * time it falls due. When interrupts can't be taken time just moves on;
+ * the overdue interrupts run at the next safe point that allows them.
+ */
+void Clock::run_until(const uint64_t target) {
+  if (irq_enabled && !in_isr()) {
+    Gpio::deliver_pending();
+    uint8_t timer_num;
+    for (uint64_t due; (due = HAL_timer_next_event(timer_num)) <= target;) {
+      NOLESS(now_ns, due);
+      HAL_timer_run_isr(timer_num);
+      if (!irq_enabled) break; // A handler left interrupts off
+      Gpio::deliver_pending(); // Pin changes made by the handler, before the next timer
+    }
+  }
+  NOLESS(now_ns, target);
+}
+
+void Clock::poll() {
+  if (realtime())
+    run_until(host_virtual_ns());
+  else // An interrupt handler polling the timer sees it count one tick at a time
+    run_until(now_ns + (in_isr() ? HAL_TIMER_NS_PER_TICK : poll_step_ns));
+}
+
+void Clock::delay(const uint64_t ns) {
+  const uint64_t end = now_ns + ns;
+  if (!realtime()) return run_until(end);
+
+  while (now_ns < end) {
+    uint64_t target = host_virtual_ns();
+    NOMORE(target, end);
+    run_until(target);
+    if (now_ns >= end) break;
+
+    // Sleep until the next interrupt or the end of the delay, 1ms at most
+    uint8_t timer_num;
+    uint64_t wake = HAL_timer_next_event(timer_num);
+    NOMORE(wake, end);
+    NOMORE(wake, now_ns + 1000000ULL);
+    if (wake > now_ns) {
+      const uint64_t host_ns = uint64_t((wake - now_ns) / time_multiplier);
+      const timespec ts = { time_t(host_ns / 1000000000ULL), long(host_ns % 1000000000ULL) };
+      nanosleep(&ts, NULL);
+    }
+  }
+}
+
+#endif // __PLAT_LINUX__
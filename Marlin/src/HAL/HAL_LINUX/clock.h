@@ -0,0 +1,88 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Virtual time for the Linux simulation
+ *
+ * The firmware runs in a single host thread. Interrupts can't preempt
+ * it, so they are delivered at "safe points" instead: whenever the
+ * firmware looks at the time (millis, micros, delay) or polls the serial
+ * port, which every busy-wait in Marlin already does.
+ *
+ * Two time bases are available:
+ *
+ *  - Real time (multiplier > 0): virtual time follows the host clock,
+ *    scaled by the multiplier. Use this with a host program on the PTY.
+ *
+ *  - Lock-step (multiplier == 0): virtual time only moves when the
+ *    firmware waits. Each safe point costs 'poll_ns' (one timer tick
+ *    inside a handler) and each delay passes exactly. Runs are repeatable
+ *    and as fast as the host allows, which is what benchmarks want.
+ */
+
+#ifndef _HAL_LINUX_CLOCK_H_
+#define _HAL_LINUX_CLOCK_H_
+
+#include <stdint.h>
+
+class Clock {
+public:
+  static void init(const double multiplier, const uint32_t poll_ns);
+
+  // Current virtual time. No side effects.
+  static inline uint64_t nanos() { return now_ns; }
+  static inline uint64_t micros() { return now_ns / 1000UL; }
+  static inline uint64_t millis() { return now_ns / 1000000UL; }
+
+  // Safe point: move time on and deliver any interrupts that are due
+  static void poll();
+
+  // Let 'ns' of virtual time pass, delivering interrupts along the way
+  static void delay(const uint64_t ns);
+
+  // Interrupt masking (cli / sei)
+  static inline void disable_interrupts() { irq_enabled = false; }
+  static inline void enable_interrupts() { irq_enabled = true; }
+  static inline bool interrupts_enabled() { return irq_enabled; }
+
+  // Bracket every interrupt handler. Timer handlers never nest; pin
+  // change handlers may run inside them, as a higher priority would.
+  static inline void enter_isr() { isr_depth++; }
+  static inline void leave_isr() { isr_depth--; }
+  static inline bool in_isr() { return isr_depth > 0; }
+
+  static inline bool realtime() { return time_multiplier > 0; }
+
+private:
+  static void run_until(const uint64_t target);
+  static uint64_t host_virtual_ns();
+
+  static uint64_t now_ns, host_start_ns;
+  static double time_multiplier;
+  static uint32_t poll_step_ns;
+  static bool irq_enabled;
+  static uint8_t isr_depth;
+};
+
+uint64_t host_nanos();
+
+#endif // _HAL_LINUX_CLOCK_H_
@@ -0,0 +1,101 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Description: Fast IO functions for the Linux simulation
+ *
+ * All pin access goes to the simulated GPIO, so devices see every write.
+ */
+
+#ifndef _FASTIO_LINUX_H
+#define _FASTIO_LINUX_H
+
+#include "gpio.h"
+
+#define USEABLE_HARDWARE_PWM(pin) true
+
+/**
+ * Magic I/O routines
+ *
+ * Now you can simply SET_OUTPUT(STEP); WRITE(STEP, HIGH); WRITE(STEP, LOW);
+ *
+ * Why double up on these macros? see http://gcc.gnu.org/onlinedocs/cpp/Stringification.html
+ */
+
+/// Read a pin
+#define _READ(IO) Gpio::get(IO)
+
+/// Write to a pin
+#define _WRITE_VAR(IO, v) Gpio::set(IO, v)
+
+#define _WRITE(IO, v) Gpio::set(IO, v)
+
+/// toggle a pin
+#define _TOGGLE(IO) _WRITE(IO, !READ(IO))
+
+/// set pin as input
+#define _SET_INPUT(IO) Gpio::set_mode(IO, Gpio::pin_input)
+
+/// set pin as output
+#define _SET_OUTPUT(IO) Gpio::set_mode(IO, Gpio::pin_output)
+
+/// set pin as input with pullup mode
+#define _PULLUP(IO, v) Gpio::set_mode(IO, (v) != LOW ? Gpio::pin_input_pullup : Gpio::pin_input)
+
+/// check if pin is an input
+#define _GET_INPUT(IO) (Gpio::get_mode(IO) != Gpio::pin_output)
+
+/// check if pin is an output
+#define _GET_OUTPUT(IO) (Gpio::get_mode(IO) == Gpio::pin_output)
+
+/// check if pin is an timer
+#define _GET_TIMER(IO) false
+
+/// Read a pin wrapper
+#define READ(IO)  _READ(IO)
+
+/// Write to a pin wrapper
+#define WRITE_VAR(IO, v)  _WRITE_VAR(IO, v)
+#define WRITE(IO, v)  _WRITE(IO, v)
+
+/// toggle a pin wrapper
+#define TOGGLE(IO)  _TOGGLE(IO)
+
+/// set pin as input wrapper
+#define SET_INPUT(IO)  _SET_INPUT(IO)
+/// set pin as input with pullup wrapper
+#define SET_INPUT_PULLUP(IO) do{ _SET_INPUT(IO); _PULLUP(IO, HIGH); }while(0)
+/// set pin as output wrapper
+#define SET_OUTPUT(IO)  do{ _SET_OUTPUT(IO); _WRITE(IO, LOW); }while(0)
+
+/// check if pin is an input wrapper
+#define GET_INPUT(IO)  _GET_INPUT(IO)
+/// check if pin is an output wrapper
+#define GET_OUTPUT(IO)  _GET_OUTPUT(IO)
+
+/// check if pin is an timer wrapper
+#define GET_TIMER(IO)  _GET_TIMER(IO)
+
+// Shorthand
+#define OUT_WRITE(IO, v) { SET_OUTPUT(IO); WRITE(IO, v); }
+
+#endif // _FASTIO_LINUX_H
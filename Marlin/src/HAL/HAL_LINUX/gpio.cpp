@@ -0,0 +1,90 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "gpio.h"
+
+Gpio::pin_data Gpio::pin_map[NUM_DIGITAL_PINS];
+bool Gpio::any_pending;
+
+void Gpio::attach_interrupt(const pin_t pin, isr_t isr, const uint32_t mode) {
+  if (!VALID_PIN(pin)) return;
+  pin_map[pin].isr = isr;
+  pin_map[pin].int_mode = mode;
+}
+
+void Gpio::detach_interrupt(const pin_t pin) {
+  if (!VALID_PIN(pin)) return;
+  pin_map[pin].isr = NULL;
+  pin_map[pin].pending = false;
+}
+
+void Gpio::attach_listener(const pin_t pin, listener_t listener) {
+  if (VALID_PIN(pin)) pin_map[pin].listener = listener;
+}
+
+void Gpio::drive(const pin_t pin, const bool value) {
+  if (!VALID_PIN(pin)) return;
+  const bool was = get(pin);
+  pin_data &p = pin_map[pin];
+  p.driven = true;
+  p.drive_value = value;
+  if (was != value) raise_interrupt(pin, value);
+}
+
+void Gpio::raise_interrupt(const pin_t pin, const bool rising) {
+  pin_data &p = pin_map[pin];
+  if (!p.isr) return;
+  switch (p.int_mode) {
+    case RISING:  if (!rising) return; break;
+    case FALLING: if (rising) return; break;
+    case CHANGE:  break;
+    default:      return;
+  }
+  // Pin change interrupts outrank the timers, but respect cli()
+  if (Clock::interrupts_enabled()) {
+    Clock::enter_isr();
+    p.isr();
+    Clock::leave_isr();
+  }
+  else
+    p.pending = any_pending = true;
+}
+
+void Gpio::deliver_pending() {
+  if (!any_pending) return;
+  any_pending = false;
+  for (pin_t pin = 0; pin < NUM_DIGITAL_PINS; pin++) {
+    pin_data &p = pin_map[pin];
+    if (!p.pending) continue;
+    p.pending = false;
+    if (p.isr) {
+      Clock::enter_isr();
+      p.isr();
+      Clock::leave_isr();
+    }
+  }
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,91 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Simulated GPIO for the Linux simulation
+ *
+ * Each pin holds the level the firmware last wrote, or the level a
+ * simulated device (heater, axis, endstop) drives onto it. Devices can
+ * listen for writes to output pins, and pin change interrupts are raised
+ * when a device changes an input.
+ */
+
+#ifndef _HAL_LINUX_GPIO_H_
+#define _HAL_LINUX_GPIO_H_
+
+#include <stdint.h>
+#include "pinmapping.h"
+
+class Gpio {
+public:
+  typedef void (*listener_t)(const pin_t pin, const bool value);
+  typedef void (*isr_t)(void);
+
+  // Firmware side
+  static inline void set(const pin_t pin, const bool value) {
+    if (!VALID_PIN(pin)) return;
+    pin_data &p = pin_map[pin];
+    if (p.value == value) return;
+    p.value = value;
+    if (p.listener) p.listener(pin, value);
+  }
+
+  static inline bool get(const pin_t pin) {
+    if (!VALID_PIN(pin)) return false;
+    const pin_data &p = pin_map[pin];
+    return p.driven ? p.drive_value : p.mode == pin_input_pullup || p.value;
+  }
+
+  static inline void set_mode(const pin_t pin, const uint8_t mode) { if (VALID_PIN(pin)) pin_map[pin].mode = mode; }
+  static inline uint8_t get_mode(const pin_t pin) { return VALID_PIN(pin) ? pin_map[pin].mode : 0; }
+
+  static inline void set_pwm(const pin_t pin, const uint8_t value) { if (VALID_PIN(pin)) pin_map[pin].pwm = value; }
+  static inline uint8_t get_pwm(const pin_t pin) { return VALID_PIN(pin) ? pin_map[pin].pwm : 0; }
+
+  static void attach_interrupt(const pin_t pin, isr_t isr, const uint32_t mode);
+  static void detach_interrupt(const pin_t pin);
+
+  // Device side
+  static void drive(const pin_t pin, const bool value);
+  static void attach_listener(const pin_t pin, listener_t listener);
+
+  // Run pin change handlers held back while interrupts were off
+  static void deliver_pending();
+
+  // pinMode modes, as in arduino.h
+  enum { pin_input, pin_output, pin_input_pullup };
+
+private:
+  typedef struct {
+    uint8_t mode, pwm, int_mode;
+    bool value, driven, drive_value, pending;
+    isr_t isr;
+    listener_t listener;
+  } pin_data;
+
+  static pin_data pin_map[NUM_DIGITAL_PINS];
+  static bool any_pending;
+
+  static void raise_interrupt(const pin_t pin, const bool rising);
+};
+
+#endif // _HAL_LINUX_GPIO_H_
@@ -0,0 +1,168 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "heater.h"
+#include "gpio.h"
+#include "../../module/thermistor/thermistors.h"
+
+#include <math.h>
+
+// A 40W cartridge in a small aluminium block, and a 12V bed
+#ifndef SIM_HOTEND_WATTS
+  #define SIM_HOTEND_WATTS     40.0
+  #define SIM_HOTEND_CAPACITY  12.0  // J/K
+  #define SIM_HOTEND_MAX_TEMP 350.0  // Where heating at full power levels off
+#endif
+#ifndef SIM_BED_WATTS
+  #define SIM_BED_WATTS       120.0
+  #define SIM_BED_CAPACITY    300.0
+  #define SIM_BED_MAX_TEMP    130.0
+#endif
+
+#if !PIN_EXISTS(HEATER_0)
+  #define HEATER_0_PIN -1
+#endif
+#if !PIN_EXISTS(HEATER_1)
+  #define HEATER_1_PIN -1
+#endif
+#if !PIN_EXISTS(HEATER_2)
+  #define HEATER_2_PIN -1
+#endif
+#if !PIN_EXISTS(HEATER_3)
+  #define HEATER_3_PIN -1
+#endif
+#if !PIN_EXISTS(HEATER_4)
+  #define HEATER_4_PIN -1
+#endif
+#if !PIN_EXISTS(HEATER_BED)
+  #define HEATER_BED_PIN -1
+#endif
+
+static Heater heaters[HOTENDS + 1];
+static uint8_t heater_count;
+
+void Heater::init_all() {
+  heater_count = 0;
+  #define _INIT_HOTEND(N) heaters[heater_count++].init(HEATER_##N##_PIN, TEMP_##N##_PIN, HEATER_##N##_TEMPTABLE, HEATER_##N##_TEMPTABLE_LEN, \
+                                                      SIM_HOTEND_WATTS, SIM_HOTEND_CAPACITY, SIM_HOTEND_MAX_TEMP)
+  #if HAS_TEMP_0
+    _INIT_HOTEND(0);
+  #endif
+  #if HAS_TEMP_1
+    _INIT_HOTEND(1);
+  #endif
+  #if HAS_TEMP_2
+    _INIT_HOTEND(2);
+  #endif
+  #if HAS_TEMP_3
+    _INIT_HOTEND(3);
+  #endif
+  #if HAS_TEMP_4
+    _INIT_HOTEND(4);
+  #endif
+  #if HAS_TEMP_BED && defined(BEDTEMPTABLE)
+    heaters[heater_count++].init(HEATER_BED_PIN, TEMP_BED_PIN, BEDTEMPTABLE, BEDTEMPTABLE_LEN,
+                                 SIM_BED_WATTS, SIM_BED_CAPACITY, SIM_BED_MAX_TEMP);
+  #endif
+}
+
+uint16_t Heater::read_adc(const uint8_t channel) {
+  for (uint8_t i = 0; i < heater_count; i++)
+    if (heaters[i].channel == channel) {
+      heaters[i].update();
+      return heaters[i].raw();
+    }
+  return 0;
+}
+
+void Heater::init(const pin_t heater_pin, const int8_t adc_channel, const short (*const table)[2], const uint8_t table_len,
+                  const float watts, const float heat_capacity, const float max_temp
+) {
+  pin = heater_pin;
+  channel = adc_channel;
+  temptable = table;
+  temptable_len = table_len;
+  power = watts;
+  capacity = heat_capacity;
+  loss = watts / (max_temp - (SIM_AMBIENT_TEMP));
+  temperature = SIM_AMBIENT_TEMP;
+  updated_ns = level_ns = Clock::nanos();
+  on_ns = 0;
+  Gpio::attach_listener(pin, pin_changed);
+}
+
+/**
+ * Bring the temperature up to date. Over the time since the last update
+ * the heater delivered power * duty, and the block relaxes exponentially
+ * towards the temperature where that power balances the losses.
+ */
+void Heater::update() {
+  const uint64_t now = Clock::nanos();
+  if (now <= updated_ns) return;
+  if (Gpio::get(pin)) on_ns += now - level_ns;
+  level_ns = now;
+
+  const float dt = (now - updated_ns) * 1e-9f,
+              duty = on_ns * 1e-9f / dt,
+              settle = SIM_AMBIENT_TEMP + power * duty / loss;
+  temperature = settle + (temperature - settle) * expf(-dt * loss / capacity);
+  updated_ns = now;
+  on_ns = 0;
+}
+
+void Heater::pin_changed(const pin_t pin, const bool value) {
+  const uint64_t now = Clock::nanos();
+  for (uint8_t i = 0; i < heater_count; i++) {
+    Heater &h = heaters[i];
+    if (h.pin != pin) continue;
+    if (!value) h.on_ns += now - h.level_ns; // End of an on period
+    h.level_ns = now;
+  }
+}
+
+/**
+ * The ADC reading for the current temperature: the thermistor table run
+ * backwards. Tables are in raw order and temperature may rise or fall
+ * along them, so look for the pair of rows that brackets it.
+ */
+uint16_t Heater::raw() {
+  if (!temptable_len) return 0;
+  const float t = temperature;
+  for (uint8_t i = 1; i < temptable_len; i++) {
+    const float t0 = (short)pgm_read_word(&temptable[i - 1][1]), t1 = (short)pgm_read_word(&temptable[i][1]);
+    if ((t0 <= t && t <= t1) || (t1 <= t && t <= t0)) {
+      const float r0 = (short)pgm_read_word(&temptable[i - 1][0]), r1 = (short)pgm_read_word(&temptable[i][0]),
+                  r = t1 == t0 ? r0 : r0 + (r1 - r0) * (t - t0) / (t1 - t0);
+      return uint16_t(r / (OVERSAMPLENR) + 0.5f);
+    }
+  }
+  // Off the end of the table: use the row nearest in temperature
+  const uint8_t last = temptable_len - 1;
+  const bool hot_first = (short)pgm_read_word(&temptable[0][1]) > (short)pgm_read_word(&temptable[last][1]),
+             too_hot = t > (short)pgm_read_word(&temptable[hot_first ? 0 : last][1]);
+  return (short)pgm_read_word(&temptable[too_hot == hot_first ? 0 : last][0]) / (OVERSAMPLENR);
+}
+
+#endif // __PLAT_LINUX__
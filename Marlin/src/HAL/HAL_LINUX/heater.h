@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Simulated heaters for the Linux simulation
+ *
+ * A heater is a lumped thermal mass driven by the time its heater pin
+ * spends HIGH, losing heat to the room in proportion to its temperature
+ * rise. Its sensor reads back through the same thermistor table the
+ * firmware uses, so the firmware sees the modelled temperature exactly.
+ */
+
+#ifndef _HAL_LINUX_HEATER_H_
+#define _HAL_LINUX_HEATER_H_
+
+#include <stdint.h>
+#include "pinmapping.h"
+
+#define SIM_AMBIENT_TEMP 25.0
+
+class Heater {
+public:
+  // Set up a heater for each temperature sensor in the configuration
+  static void init_all();
+
+  // 10-bit reading of the sensor on an analog channel
+  static uint16_t read_adc(const uint8_t channel);
+
+  void init(const pin_t heater_pin, const int8_t adc_channel, const short (*const table)[2], const uint8_t table_len,
+            const float watts, const float heat_capacity, const float max_temp);
+
+  float temperature;
+
+private:
+  pin_t pin;
+  int8_t channel;
+  const short (*temptable)[2];
+  uint8_t temptable_len;
+  float power,        // W
+        capacity,     // J/K
+        loss;         // W/K to the room
+  uint64_t updated_ns, level_ns, on_ns;
+
+  void update();
+  uint16_t raw();
+
+  static void pin_changed(const pin_t pin, const bool value);
+};
+
+#endif // _HAL_LINUX_HEATER_H_
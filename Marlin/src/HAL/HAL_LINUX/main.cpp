@@ -0,0 +1,189 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Entry point for the Linux simulation
+ *
+ *   marlin [options]
+ *   marlin -b [options] FILE...
+ *   marlin -k
+ *
+ *   -p, --pty LINK    Make the serial port a PTY, with a symlink at LINK
+ *   -s, --stdio       Read G-code from stdin and reply on stdout. The run
+ *                     ends once the input is used up and all moves are done.
+ *   -t, --time X      Run X times faster than real time, or 0 for lock-step
+ *                     virtual time that only moves when the firmware waits
+ *   -n, --poll-ns N   Lock-step time taken by each poll of the clock (10000)
+ *   -e, --eeprom FILE File for EEPROM settings (eeprom.dat, none with -b)
+ *   -c, --sdcard FILE SD card image
+ *   -b, --benchmark   Replay the G-code FILEs through the parser and the
+ *                     planner as fast as possible, in lock-step time, and
+ *                     report the throughput. See benchmark.h.
+ *   -r, --repeat N    Replay each file N times and report the fastest (1)
+ *   -k, --check       Check the fast math paths against the code they
+ *                     replaced, with the configured tables and settings,
+ *                     then exit. See selfcheck.h. SCARA builds can only
+ *                     run the checks, as the arms aren't simulated.
+ *
+ * The board's power latch (SUICIDE_PIN) ends the process when it drops,
+ * so M81 exits with status 0, and kill() with status 1.
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "../../gcode/queue.h"
+#include "../../module/planner.h"
+#include "axis.h"
+#include "benchmark.h"
+#include "heater.h"
+#include "sd_image.h"
+#include "selfcheck.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../../sd/cardreader.h"
+#endif
+
+#include <getopt.h>
+#include <unistd.h>
+
+extern void setup();
+extern void loop();
+
+const char *eeprom_file_path = "eeprom.dat";
+
+static uint64_t host_start_ns;
+
+static void print_summary() {
+  usb_serial.flushTX();
+  const double virtual_s = Clock::nanos() * 1e-9, host_s = (host_nanos() - host_start_ns) * 1e-9;
+  fprintf(stderr, "Simulated %.3fs in %.3fs (x%.1f). X%.3f Y%.3f Z%.3f E%.3f\n",
+    virtual_s, host_s, host_s > 0 ? virtual_s / host_s : 0.0,
+    Axis::position_mm(X_AXIS), Axis::position_mm(Y_AXIS), Axis::position_mm(Z_AXIS), Axis::position_mm(E_AXIS)
+  );
+}
+
+#if HAS_SUICIDE
+  // kill() masks interrupts before it cuts the power, M81 doesn't
+  static void power_latch(const pin_t pin, const bool on) {
+    UNUSED(pin);
+    if (!on) exit(Clock::interrupts_enabled() ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
+#endif
+
+static void usage(const char * const name) {
+  fprintf(stderr, "Usage: %s [-p LINK | -s] [-t MULTIPLIER] [-n POLL_NS] [-e EEPROM_FILE] [-c SD_IMAGE]\n"
+                  "       %s -b [-r REPEAT] [-s] [-n POLL_NS] [-e EEPROM_FILE] FILE...\n"
+                  "       %s -k\n", name, name, name);
+}
+
+int main(int argc, char *argv[]) {
+  static const option long_options[] = {
+    { "pty",       required_argument, NULL, 'p' },
+    { "stdio",     no_argument,       NULL, 's' },
+    { "time",      required_argument, NULL, 't' },
+    { "poll-ns",   required_argument, NULL, 'n' },
+    { "eeprom",    required_argument, NULL, 'e' },
+    { "sdcard",    required_argument, NULL, 'c' },
+    { "benchmark", no_argument,       NULL, 'b' },
+    { "repeat",    required_argument, NULL, 'r' },
+    { "check",     no_argument,       NULL, 'k' },
+    { "help",      no_argument,       NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+
+  const char *pty_link = NULL, *sd_image = NULL;
+  bool use_stdio = false, benchmark = false, check = false, eeprom_given = false;
+  double multiplier = 1.0;
+  uint32_t poll_ns = 10000;
+  int repeat = 1;
+
+  for (int c; (c = getopt_long(argc, argv, "p:st:n:e:c:br:kh", long_options, NULL)) != -1;) {
+    switch (c) {
+      case 'p': pty_link = optarg; break;
+      case 's': use_stdio = true; break;
+      case 't': multiplier = atof(optarg); break;
+      case 'n': poll_ns = atol(optarg); break;
+      case 'e': eeprom_file_path = optarg; eeprom_given = true; break;
+      case 'c': sd_image = optarg; break;
+      case 'b': benchmark = true; break;
+      case 'r': repeat = atoi(optarg); break;
+      case 'k': check = true; break;
+      default: usage(argv[0]); return c == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+  if (multiplier < 0 || !poll_ns || !WITHIN(repeat, 1, 65535)) { usage(argv[0]); return EXIT_FAILURE; }
+
+  #if IS_SCARA
+    if (!check) {
+      fprintf(stderr, "The simulation doesn't model SCARA arms. Only the checks (-k) can run.\n");
+      return EXIT_FAILURE;
+    }
+  #endif
+
+  // Benchmarks and checks start from the configured settings, not whatever was saved last
+  if ((benchmark || check) && !eeprom_given) eeprom_file_path = "/dev/null";
+
+  host_start_ns = host_nanos();
+  Clock::init(benchmark || check ? 0 : multiplier, poll_ns);
+
+  // A benchmark or check drops its replies, unless -s sends them to stdout
+  if (use_stdio)
+    usb_serial.open_stdio();
+  else if (!benchmark && !check && !usb_serial.open_pty(pty_link)) {
+    perror("Can't open a PTY");
+    return EXIT_FAILURE;
+  }
+
+  if (sd_image && !SdImage::open(sd_image)) {
+    perror(sd_image);
+    return EXIT_FAILURE;
+  }
+
+  HAL_timer_init();
+  Heater::init_all();
+  Axis::init_all();
+  #if HAS_SUICIDE
+    Gpio::attach_listener(SUICIDE_PIN, power_latch);
+  #endif
+  if (!benchmark && !check) atexit(print_summary);
+
+  setup();
+  if (check) return SelfCheck::run();
+  if (benchmark) return Benchmark::run(argv + optind, argc - optind, poll_ns, repeat);
+
+  for (;;) {
+    loop();
+    if (!commands_in_queue) {
+      if (usb_serial.eof() && !planner.blocks_queued()
+        #if ENABLED(SDSUPPORT)
+          && !card.sdprinting
+        #endif
+      ) break;
+      // Nothing to do: give the host CPU back, as WFI would
+      if (Clock::realtime()) Clock::delay(100000UL);
+    }
+  }
+  return EXIT_SUCCESS;
+}
+
+#endif // __PLAT_LINUX__
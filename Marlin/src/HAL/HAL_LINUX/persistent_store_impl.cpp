@@ -0,0 +1,88 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(EEPROM_SETTINGS)
+
+#include "../persistent_store_api.h"
+
+#include <stdio.h>
+
+namespace HAL {
+namespace PersistentStore {
+
+/**
+ * The EEPROM is a file on the host, staged in RAM while settings are
+ * read or written. A missing or short file reads as erased EEPROM, and
+ * the file is only rewritten when something changed.
+ */
+static uint8_t eeprom_image[E2END + 1];
+static bool eeprom_dirty;
+
+bool access_start() {
+  memset(eeprom_image, 0xFF, sizeof(eeprom_image));
+  FILE * const file = fopen(eeprom_file_path, "rb");
+  if (file) {
+    (void)fread(eeprom_image, 1, sizeof(eeprom_image), file);
+    fclose(file);
+  }
+  eeprom_dirty = false;
+  return true;
+}
+
+bool access_finish() {
+  if (!eeprom_dirty) return true;
+  eeprom_dirty = false;
+  FILE * const file = fopen(eeprom_file_path, "wb");
+  if (!file) return false;
+  const bool ok = fwrite(eeprom_image, 1, sizeof(eeprom_image), file) == sizeof(eeprom_image);
+  return !fclose(file) && ok;
+}
+
+bool write_data(int &pos, const uint8_t *value, uint16_t size, uint16_t *crc) {
+  if (pos < 0 || pos + size > (int)sizeof(eeprom_image)) return true;
+  for (uint16_t i = 0; i < size; i++, pos++) {
+    if (eeprom_image[pos] != value[i]) {
+      eeprom_image[pos] = value[i];
+      eeprom_dirty = true;
+    }
+  }
+  crc16(crc, value, size);
+  return false;
+}
+
+bool read_data(int &pos, uint8_t* value, uint16_t size, uint16_t *crc) {
+  if (pos < 0 || pos + size > (int)sizeof(eeprom_image)) return true;
+  memcpy(value, &eeprom_image[pos], size);
+  crc16(crc, value, size);
+  pos += size;
+  return false;
+}
+
+} // PersistentStore
+} // HAL
+
+#endif // EEPROM_SETTINGS
+#endif // __PLAT_LINUX__
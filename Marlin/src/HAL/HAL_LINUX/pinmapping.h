@@ -0,0 +1,52 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _PINMAPPING_H_
+#define _PINMAPPING_H_
+
+#include <stdint.h>
+
+typedef int16_t pin_t;
+
+/**
+ * The simulated board has the pin numbering of an Arduino Mega, so the
+ * stock RAMPS pin definitions work unchanged. Analog channels A0-A15 are
+ * the digital pins 54-69, as on the Mega. Pin 70 is the board's virtual
+ * power latch.
+ */
+#define NUM_DIGITAL_PINS  71
+#define NUM_ANALOG_INPUTS 16
+#define ANALOG_PIN_OFFSET 54
+
+#define P_NC -1
+
+#define analogInputToDigitalPin(p) ((p) < NUM_ANALOG_INPUTS ? (p) + ANALOG_PIN_OFFSET : -1)
+#define DIGITAL_PIN_TO_ANALOG_PIN(p) (WITHIN(p, ANALOG_PIN_OFFSET, ANALOG_PIN_OFFSET + NUM_ANALOG_INPUTS - 1) ? (p) - ANALOG_PIN_OFFSET : -1)
+
+#define VALID_PIN(p) ((p) >= 0 && (p) < NUM_DIGITAL_PINS)
+
+// Pin index for M43 and M226
+#define GET_PIN_MAP_PIN(index) index
+#define GET_PIN_MAP_INDEX(pin) pin
+#define PARSED_PIN_INDEX(code, dval) parser.intval(code, dval)
+
+#endif // _PINMAPPING_H_
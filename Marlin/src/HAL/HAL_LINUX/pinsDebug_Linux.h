@@ -0,0 +1,46 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Support routines for the Linux simulation
+ */
+
+/**
+ * Translation of routines & variables used by pinsDebug.h
+ */
+
+#define pwm_details(pin) pin = pin    // do nothing  // print PWM details
+#define pwm_status(pin) (Gpio::get_pwm(pin) != 0) // Print a pin's PWM status. Return true if it's currently a PWM pin.
+#define IS_ANALOG(P) (DIGITAL_PIN_TO_ANALOG_PIN(P) >= 0 ? 1 : 0)
+#define digitalRead_mod(p)  digitalRead(p)
+#define digitalPinToPort_DEBUG(p)  0
+#define digitalPinToBitMask_DEBUG(pin) 0
+#define PRINT_PORT(p) SERIAL_ECHO_SP(10);
+#define GET_ARRAY_PIN(p) pin_array[p].pin
+#define PRINT_ARRAY_NAME(x)  do {sprintf_P(buffer, PSTR("%-" STRINGIFY(MAX_NAME_LENGTH) "s"), pin_array[x].name); SERIAL_ECHO(buffer);} while (0)
+#define PRINT_PIN(p) do {sprintf_P(buffer, PSTR("%3d "), p); SERIAL_ECHO(buffer);} while (0)
+
+// Is the pin an output
+bool GET_PINMODE(pin_t pin) { return Gpio::get_mode(pin) == Gpio::pin_output; }
+
+// All simulated pins are digital, the analog ones included
+bool GET_ARRAY_IS_DIGITAL(pin_t pin) { UNUSED(pin); return true; }
@@ -0,0 +1,253 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "sd_image.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define SD_BLOCK_SIZE 512
+
+// R1 response bits and data tokens, as in sd/SdInfo.h
+#define SD_R1_READY     0x00
+#define SD_R1_IDLE      0x01
+#define SD_R1_ILLEGAL   0x04
+#define SD_R1_ADDRESS   0x20
+#define SD_DATA_START   0xFE
+#define SD_WRITE_MULTI  0xFC
+#define SD_STOP_TRAN    0xFD
+#define SD_DATA_ACCEPT  0x05
+
+enum SdMode : uint8_t { SD_MODE_IDLE, SD_MODE_READ_MULTIPLE, SD_MODE_WRITE_SINGLE, SD_MODE_WRITE_MULTIPLE };
+
+static FILE *image;
+static uint32_t block_count;
+
+static SdMode mode;
+static bool idle_state = true, app_command;
+
+static uint8_t command[6], command_length;
+
+// Bytes waiting to go out on MISO. 0xFF when there are none.
+static uint8_t out_buffer[8 + SD_BLOCK_SIZE + 2];
+static uint16_t out_head, out_tail;
+
+// Block being received for a write
+static uint8_t in_buffer[SD_BLOCK_SIZE + 2];
+static uint16_t in_count;
+static bool receiving;
+
+static uint32_t block_address, erase_first, erase_last;
+
+static uint16_t crc16(const uint8_t *data, const uint16_t n) {
+  uint16_t crc = 0;
+  for (uint16_t i = 0; i < n; i++) {
+    crc ^= uint16_t(data[i]) << 8;
+    for (uint8_t b = 0; b < 8; b++) crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+static void queue(const uint8_t b) { if (out_tail < sizeof(out_buffer)) out_buffer[out_tail++] = b; }
+
+static void queue_r1(const uint8_t flags=0) { queue((idle_state ? SD_R1_IDLE : SD_R1_READY) | flags); }
+
+// A data packet: start token, the data, then its CRC
+static void queue_data(const uint8_t *data, const uint16_t n) {
+  queue(SD_DATA_START);
+  for (uint16_t i = 0; i < n; i++) queue(data[i]);
+  const uint16_t crc = crc16(data, n);
+  queue(crc >> 8);
+  queue(crc & 0xFF);
+}
+
+// Blocks past the end of the file read as zeros
+static void read_block(const uint32_t block, uint8_t *dst) {
+  memset(dst, 0, SD_BLOCK_SIZE);
+  if (fseek(image, long(block) * SD_BLOCK_SIZE, SEEK_SET) == 0)
+    (void)fread(dst, 1, SD_BLOCK_SIZE, image);
+}
+
+static void write_block(const uint32_t block, const uint8_t *src) {
+  if (fseek(image, long(block) * SD_BLOCK_SIZE, SEEK_SET) == 0) {
+    fwrite(src, 1, SD_BLOCK_SIZE, image);
+    fflush(image);
+  }
+}
+
+static void queue_block(const uint32_t block) {
+  uint8_t data[SD_BLOCK_SIZE];
+  read_block(block, data);
+  queue_data(data, SD_BLOCK_SIZE);
+}
+
+/**
+ * Version 2 CSD: 512 byte blocks and a capacity in units of 512K, which
+ * is all Sd2Card::cardSize() and erase() look at.
+ */
+static void queue_csd() {
+  const uint32_t c_size = block_count / 1024 - 1;
+  const uint8_t csd[16] = {
+    0x40, 0x0E, 0x00, 0x32, 0x5B, 0x59, 0x00,
+    uint8_t((c_size >> 16) & 0x3F), uint8_t(c_size >> 8), uint8_t(c_size),
+    0x7F, 0x80, 0x0A, 0x40, 0x00, 0x01
+  };
+  queue_data(csd, sizeof(csd));
+}
+
+static void queue_cid() {
+  const uint8_t cid[16] = { 0x00, 'M', 'L', 'S', 'I', 'M', 'S', 'D', 0x10, 0x00, 0x00, 0x00, 0x01, 0x01, 0x20, 0x01 };
+  queue_data(cid, sizeof(cid));
+}
+
+static void run_command(const uint8_t cmd, const uint32_t arg) {
+  out_head = out_tail = 0;
+  queue(0xFF); // One byte before the response, as real cards take
+
+  const bool acmd = app_command;
+  app_command = false;
+  if (acmd) switch (cmd) {
+    case 41: idle_state = false; queue_r1(); return;  // ACMD41: finish initialization
+    case 23: queue_r1(); return;                      // ACMD23: pre-erase count, ignored
+  }
+
+  const bool in_range = arg < block_count;
+  switch (cmd) {
+    case 0:  // CMD0: reset
+      idle_state = true;
+      mode = SD_MODE_IDLE;
+      queue_r1();
+      break;
+    case 8:  // CMD8: echo the voltage and check pattern
+      queue_r1();
+      queue(0x00); queue(0x00); queue((arg >> 8) & 0x0F); queue(arg & 0xFF);
+      break;
+    case 9:  queue_r1(); queue_csd(); break;
+    case 10: queue_r1(); queue_cid(); break;
+    case 12: // CMD12: stop a multiple block read, after a stuff byte
+      mode = SD_MODE_IDLE;
+      queue(0xFF);
+      queue_r1();
+      break;
+    case 13: queue_r1(); queue(0x00); break; // CMD13: status, R2
+    case 17:
+      if (!in_range) { queue_r1(SD_R1_ADDRESS); break; }
+      queue_r1();
+      queue_block(arg);
+      break;
+    case 18: // CMD18: blocks stream out until CMD12
+      if (!in_range) { queue_r1(SD_R1_ADDRESS); break; }
+      queue_r1();
+      block_address = arg;
+      mode = SD_MODE_READ_MULTIPLE;
+      break;
+    case 24:
+    case 25:
+      if (!in_range) { queue_r1(SD_R1_ADDRESS); break; }
+      queue_r1();
+      block_address = arg;
+      receiving = false;
+      mode = cmd == 24 ? SD_MODE_WRITE_SINGLE : SD_MODE_WRITE_MULTIPLE;
+      break;
+    case 32: erase_first = arg; queue_r1(); break;
+    case 33: erase_last = arg; queue_r1(); break;
+    case 38: {
+      uint8_t zeros[SD_BLOCK_SIZE] = { 0 };
+      for (uint32_t b = erase_first; b <= erase_last && b < block_count; b++) write_block(b, zeros);
+      queue_r1();
+    } break;
+    case 55: app_command = true; queue_r1(); break;
+    case 58: // CMD58: OCR with power up done and CCS (block addressing) set
+      queue_r1();
+      queue(0xC0); queue(0xFF); queue(0x80); queue(0x00);
+      break;
+    default: queue_r1(SD_R1_ILLEGAL); break;
+  }
+}
+
+// A data byte from the host during a write
+static void receive_data(const uint8_t in) {
+  if (!receiving) {
+    if (in == (mode == SD_MODE_WRITE_SINGLE ? SD_DATA_START : SD_WRITE_MULTI)) {
+      receiving = true;
+      in_count = 0;
+    }
+    else if (in == SD_STOP_TRAN && mode == SD_MODE_WRITE_MULTIPLE)
+      mode = SD_MODE_IDLE;
+    return;
+  }
+  in_buffer[in_count++] = in;
+  if (in_count < sizeof(in_buffer)) return;
+
+  // Block and CRC received. The CRC is a dummy, as CRCs are off in SPI mode.
+  receiving = false;
+  write_block(block_address++, in_buffer);
+  out_head = out_tail = 0;
+  queue(SD_DATA_ACCEPT);
+  if (mode == SD_MODE_WRITE_SINGLE) mode = SD_MODE_IDLE;
+}
+
+bool SdImage::open(const char * const path) {
+  image = fopen(path, "r+b");
+  if (!image) return false;
+  fseek(image, 0, SEEK_END);
+  const long bytes = ftell(image);
+  // The CSD gives the size in whole 512K units
+  block_count = ((bytes / SD_BLOCK_SIZE + 1023) / 1024) * 1024;
+  if (!block_count) block_count = 1024;
+  return true;
+}
+
+uint8_t SdImage::transfer(const uint8_t in) {
+  if (!image) return 0xFF;
+
+  // Whatever the card had ready goes out while the host's byte comes in
+  uint8_t out = 0xFF;
+  if (out_head < out_tail)
+    out = out_buffer[out_head++];
+  else if (mode == SD_MODE_READ_MULTIPLE) {
+    out_head = out_tail = 0;
+    queue(0xFF); // A gap between blocks, where hosts wait to send CMD12
+    queue_block(block_address++);
+    if (block_address >= block_count) mode = SD_MODE_IDLE;
+    out = out_buffer[out_head++];
+  }
+
+  if (receiving)
+    receive_data(in);
+  else if (command_length || (in & 0xC0) == 0x40) {
+    command[command_length++] = in;
+    if (command_length == COUNT(command)) {
+      command_length = 0;
+      run_command(command[0] & 0x3F, uint32_t(command[1]) << 24 | uint32_t(command[2]) << 16 | uint32_t(command[3]) << 8 | command[4]);
+    }
+  }
+  else if (mode == SD_MODE_WRITE_SINGLE || mode == SD_MODE_WRITE_MULTIPLE)
+    receive_data(in);
+
+  return out;
+}
+
+#endif // __PLAT_LINUX__
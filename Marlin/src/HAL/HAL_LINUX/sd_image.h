@@ -0,0 +1,50 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Simulated SD card for the Linux simulation
+ *
+ * An SDHC card in SPI mode, backed by a disk image file. Sd2Card talks
+ * to it byte by byte through the HAL SPI functions, exactly as it would
+ * to a real card, so the whole SD stack (FAT, file reads and writes,
+ * SD_CHECK_AND_RETRY) runs unchanged. A FAT-formatted image can be made
+ * with, for example:
+ *
+ *   dd if=/dev/zero of=sd.img bs=1M count=64 && mkfs.vfat sd.img
+ *   mcopy -i sd.img part.gcode ::
+ */
+
+#ifndef _HAL_LINUX_SD_IMAGE_H_
+#define _HAL_LINUX_SD_IMAGE_H_
+
+#include <stdint.h>
+
+class SdImage {
+public:
+  // Insert the card. Without one the card never answers.
+  static bool open(const char * const path);
+
+  // Clock one byte each way while the card is selected
+  static uint8_t transfer(const uint8_t in);
+};
+
+#endif // _HAL_LINUX_SD_IMAGE_H_
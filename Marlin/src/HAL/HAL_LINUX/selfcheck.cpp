@@ -0,0 +1,320 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "selfcheck.h"
+#include "clock.h"
+#include "../../module/motion.h"
+#include "../../module/temperature.h"
+
+#if ENABLED(DELTA)
+  #include "../../module/delta.h"
+#elif IS_SCARA
+  #include "../../module/planner.h"
+  #include "../../module/scara.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// One line per check
+static bool report(const char * const name, const bool pass, const char * const detail) {
+  printf("%-28s %s  %s\n", name, pass ? "ok  " : "FAIL", detail);
+  return pass;
+}
+
+#define PGM_RD_W(x)   (short)pgm_read_word(&x)
+
+/**
+ * The linear scan that temp_from_table() replaced, as it was
+ */
+static float scan_table(const short (*tt)[2], const uint8_t len, const int raw) {
+  float celsius = 0;
+  uint8_t i;
+  for (i = 1; i < len; i++) {
+    if (PGM_RD_W(tt[i][0]) > raw) {
+      celsius = PGM_RD_W(tt[i - 1][1]) +
+                (raw - PGM_RD_W(tt[i - 1][0])) *
+                (float)(PGM_RD_W(tt[i][1]) - PGM_RD_W(tt[i - 1][1])) /
+                (float)(PGM_RD_W(tt[i][0]) - PGM_RD_W(tt[i - 1][0]));
+      break;
+    }
+  }
+
+  // Overflow: Set to last value in the table
+  if (i == len) celsius = PGM_RD_W(tt[i - 1][1]);
+
+  return celsius;
+}
+
+// Every raw value the ADC can give, and one past each end
+#define RAW_FIRST -1
+#define RAW_LAST  (1024 * (OVERSAMPLENR))
+
+bool SelfCheck::thermistor_tables() {
+  #if ENABLED(TEMP_SENSOR_1_AS_REDUNDANT)
+    const void * const table[] = { HEATER_0_TEMPTABLE, HEATER_1_TEMPTABLE };
+    const uint8_t table_len[] = { HEATER_0_TEMPTABLE_LEN, HEATER_1_TEMPTABLE_LEN };
+  #else
+    const void * const table[] = ARRAY_BY_HOTENDS(HEATER_0_TEMPTABLE, HEATER_1_TEMPTABLE, HEATER_2_TEMPTABLE, HEATER_3_TEMPTABLE, HEATER_4_TEMPTABLE);
+    const uint8_t table_len[] = ARRAY_BY_HOTENDS(HEATER_0_TEMPTABLE_LEN, HEATER_1_TEMPTABLE_LEN, HEATER_2_TEMPTABLE_LEN, HEATER_3_TEMPTABLE_LEN, HEATER_4_TEMPTABLE_LEN);
+  #endif
+
+  bool pass = true;
+  char name[32], detail[80];
+  for (uint8_t e = 0; e < COUNT(table); e++) {
+    #if ENABLED(HEATER_0_USES_MAX6675)
+      if (e == 0) continue;
+    #endif
+    if (!table[e]) continue;
+    uint32_t differ = 0;
+    for (int raw = RAW_FIRST; raw <= RAW_LAST; raw++)
+      if (thermalManager.analog2temp(raw, e) != scan_table((const short(*)[2])table[e], table_len[e], raw)) differ++;
+    sprintf(name, "Thermistor lookup, hotend %u", e);
+    sprintf(detail, "%u raw values, %u differ", RAW_LAST - (RAW_FIRST) + 1, differ);
+    pass &= report(name, !differ, detail);
+  }
+
+  #if ENABLED(BED_USES_THERMISTOR)
+    uint32_t differ = 0;
+    for (int raw = RAW_FIRST; raw <= RAW_LAST; raw++)
+      if (thermalManager.analog2tempBed(raw) != scan_table(BEDTEMPTABLE, BEDTEMPTABLE_LEN, raw)) differ++;
+    sprintf(detail, "%u raw values, %u differ", RAW_LAST - (RAW_FIRST) + 1, differ);
+    pass &= report("Thermistor lookup, bed", !differ, detail);
+  #endif
+
+  return pass;
+}
+
+#if ENABLED(DELTA) || ENABLED(SCARA_FAST_TRIG)
+
+// Random value from lo to hi
+static float random_range(const float lo, const float hi) { return lo + (hi - lo) * (rand() * (1.0 / RAND_MAX)); }
+
+#endif
+
+#if ENABLED(DELTA)
+
+  #define IK_BATCH          DELTA_IK_BATCH
+  #define IK_SEGMENTS       20000
+  #define IK_MAX_ERROR      0.001  // mm
+  #define IK_ERROR_UNIT     "um"
+  #define IK_ERROR_SCALE    1000.0
+
+  /**
+   * Can every arm reach the point? That goes well past the printable area,
+   * up to where an arm lies flat, so the batch has to take over from its
+   * running sums near flat.
+   */
+  static bool ik_in_range(const float p[XYZ]) {
+    for (uint8_t t = A_AXIS; t <= C_AXIS; t++)
+      if (delta_diagonal_rod_2_tower[t] - HYPOT2(delta_tower[t][X_AXIS] - p[X_AXIS], delta_tower[t][Y_AXIS] - p[Y_AXIS]) <= 0)
+        return false;
+    return true;
+  }
+
+  // A random point from the bed to 50mm above it
+  static void ik_random_point(float p[XYZ]) {
+    do {
+      p[X_AXIS] = random_range(-(DELTA_DIAGONAL_ROD), DELTA_DIAGONAL_ROD);
+      p[Y_AXIS] = random_range(-(DELTA_DIAGONAL_ROD), DELTA_DIAGONAL_ROD);
+      p[Z_AXIS] = random_range(0, 50);
+    } while (!ik_in_range(p));
+  }
+
+  #define IK_DIFFERENCE(A,B) FABS((A) - (B))
+
+#elif ENABLED(SCARA_FAST_TRIG)
+
+  #define IK_BATCH          SCARA_IK_BATCH
+  #define IK_SEGMENTS       20000
+  #define IK_MAX_ERROR      (0.1 / max(planner.axis_steps_per_mm[A_AXIS], planner.axis_steps_per_mm[B_AXIS])) // A tenth of a step, in degrees
+  #define IK_ERROR_UNIT     "deg"
+  #define IK_ERROR_SCALE    1.0
+
+  /**
+   * Is the point on the bed and inside the arms' reach, with the elbow
+   * at least 6 degrees from straight or folded? Close to those, the arm
+   * angles change much faster than the position, for any solution.
+   */
+  static bool ik_in_range(const float p[XYZ]) {
+    if (!WITHIN(p[X_AXIS], X_MIN_POS, X_MAX_POS) || !WITHIN(p[Y_AXIS], Y_MIN_POS, Y_MAX_POS)) return false;
+    const float r2 = HYPOT2(p[X_AXIS] - SCARA_OFFSET_X, p[Y_AXIS] - SCARA_OFFSET_Y),
+                c2 = (r2 - (L1_2 + L2_2)) / (2.0 * L1 * L2);
+    return FABS(c2) <= 0.9945; // cos(6 degrees)
+  }
+
+  // A random point on the bed, up to 50mm above it
+  static void ik_random_point(float p[XYZ]) {
+    do {
+      p[X_AXIS] = random_range(X_MIN_POS, X_MAX_POS);
+      p[Y_AXIS] = random_range(Y_MIN_POS, Y_MAX_POS);
+      p[Z_AXIS] = random_range(0, 50);
+    } while (!ik_in_range(p));
+  }
+
+  // Angles a full turn apart are the same
+  static float angle_difference(const float a, const float b) {
+    const float d = FMOD(FABS(a - b), 360);
+    return min(d, 360 - d);
+  }
+
+  #define IK_DIFFERENCE(A,B) angle_difference(A, B)
+
+  /**
+   * The arm angles of scara_arm_angles() in double precision with libm
+   */
+  static void scara_reference_angles(const double x, const double y, double angle[2]) {
+    const double sx = x - (SCARA_OFFSET_X), sy = y - (SCARA_OFFSET_Y),
+                 C2 = (sx * sx + sy * sy - (sq((double)L1) + sq((double)L2))) / (2.0 * L1 * L2),
+                 S2 = sqrt(1 - C2 * C2),
+                 THETA = atan2(L1 + L2 * C2, L2 * S2) - atan2(sx, sy),
+                 PSI = atan2(S2, C2);
+    angle[0] = THETA * 180 / M_PI;
+    angle[1] = (THETA + PSI) * 180 / M_PI;
+  }
+
+  /**
+   * Solve every point of the bed on a 0.5mm grid, with the atan table,
+   * and compare with the reference.
+   */
+  bool SelfCheck::scara_angles() {
+    float worst = 0;
+    uint32_t points = 0;
+    for (float x = X_MIN_POS; x <= X_MAX_POS; x += 0.5)
+      for (float y = Y_MIN_POS; y <= Y_MAX_POS; y += 0.5) {
+        const float raw[XYZ] = { x, y, 0 };
+        if (!ik_in_range(raw)) continue;
+        double ref[2];
+        scara_reference_angles(x, y, ref);
+        inverse_kinematics(raw);
+        NOLESS(worst, angle_difference(delta[A_AXIS], ref[0]));
+        NOLESS(worst, angle_difference(delta[B_AXIS], ref[1]));
+        points++;
+      }
+    char detail[80];
+    sprintf(detail, "%u points, worst %.5f%s (limit %.5f%s)", points,
+      worst * IK_ERROR_SCALE, IK_ERROR_UNIT, IK_MAX_ERROR * IK_ERROR_SCALE, IK_ERROR_UNIT);
+    return report("SCARA arm angles", points && worst < IK_MAX_ERROR, detail);
+  }
+
+#endif
+
+#ifdef IK_BATCH
+
+  #define IK_TIMING_RUNS 20
+
+  /**
+   * Solve random segments the way prepare_kinematic_move_to() does, a batch
+   * at a time, and solve each of their points on its own as well. Segments
+   * run from 0.05mm to 2mm, in any direction, rising or falling a little,
+   * and every point must be in range.
+   *
+   * Then time both ways over the same segments. The speed line is only for
+   * information, as the host's FPU is nothing like the boards'.
+   */
+  bool SelfCheck::ik_batch() {
+    static float seg_raw[IK_SEGMENTS][XYZ], seg_step[IK_SEGMENTS][XYZ];
+    for (uint16_t n = 0; n < IK_SEGMENTS; n++) {
+      float * const raw = seg_raw[n], * const step = seg_step[n];
+      bool in_range;
+      do {
+        ik_random_point(raw);
+        const float len = random_range(0.05, 2), angle = random_range(0, 2 * M_PI);
+        step[X_AXIS] = len * cos(angle);
+        step[Y_AXIS] = len * sin(angle);
+        step[Z_AXIS] = random_range(-0.05, 0.05);
+        in_range = true;
+        for (uint8_t i = 1; i <= IK_BATCH && in_range; i++) {
+          float p[XYZ];
+          LOOP_XYZ(j) p[j] = raw[j] + step[j] * i;
+          in_range = ik_in_range(p);
+        }
+      } while (!in_range);
+    }
+
+    float worst = 0, batch[IK_BATCH][ABC];
+    for (uint16_t n = 0; n < IK_SEGMENTS; n++) {
+      float raw[XYZ];
+      COPY(raw, seg_raw[n]);
+      inverse_kinematics_batch(raw, seg_step[n], IK_BATCH, batch);
+      for (uint8_t i = 0; i < IK_BATCH; i++) {
+        LOOP_XYZ(j) raw[j] += seg_step[n][j];
+        inverse_kinematics(raw);
+        for (uint8_t t = A_AXIS; t <= C_AXIS; t++) NOLESS(worst, IK_DIFFERENCE(batch[i][t], delta[t]));
+      }
+    }
+    char detail[80];
+    sprintf(detail, "%u points, worst %.5f%s (limit %.5f%s)", IK_SEGMENTS * (IK_BATCH),
+      worst * IK_ERROR_SCALE, IK_ERROR_UNIT, IK_MAX_ERROR * IK_ERROR_SCALE, IK_ERROR_UNIT);
+    const bool pass = report("Batched inverse kinematics", worst < IK_MAX_ERROR, detail);
+
+    // Take turns, and keep the fastest pass of each
+    volatile float sink = 0; // Keep the results, or the solving could go too
+    uint64_t batch_ns = UINT64_MAX, single_ns = UINT64_MAX;
+    for (uint8_t r = 0; r < IK_TIMING_RUNS; r++) {
+      uint64_t start_ns = host_nanos();
+      for (uint16_t n = 0; n < IK_SEGMENTS; n++) {
+        inverse_kinematics_batch(seg_raw[n], seg_step[n], IK_BATCH, batch);
+        sink = batch[IK_BATCH - 1][A_AXIS];
+      }
+      NOMORE(batch_ns, host_nanos() - start_ns);
+
+      start_ns = host_nanos();
+      for (uint16_t n = 0; n < IK_SEGMENTS; n++) {
+        float raw[XYZ];
+        COPY(raw, seg_raw[n]);
+        for (uint8_t i = 0; i < IK_BATCH; i++) {
+          LOOP_XYZ(j) raw[j] += seg_step[n][j];
+          inverse_kinematics(raw);
+        }
+        sink = delta[A_AXIS];
+      }
+      NOMORE(single_ns, host_nanos() - start_ns);
+    }
+    UNUSED(sink);
+
+    const double points = IK_SEGMENTS * (IK_BATCH);
+    sprintf(detail, "batch %.1fns, single %.1fns per point (x%.2f)",
+      batch_ns / points, single_ns / points, double(single_ns) / batch_ns);
+    report("Batched IK speed", true, detail);
+
+    return pass;
+  }
+
+#endif // IK_BATCH
+
+int SelfCheck::run() {
+  srand(1); // The same points every run
+  bool pass = thermistor_tables();
+  #ifdef IK_BATCH
+    pass &= ik_batch();
+  #endif
+  #if ENABLED(SCARA_FAST_TRIG)
+    pass &= scara_angles();
+  #endif
+  return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#endif // __PLAT_LINUX__
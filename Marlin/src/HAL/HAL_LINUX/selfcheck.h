@@ -0,0 +1,61 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Self-checks for the Linux simulation
+ *
+ * Compare the firmware's fast paths with the plain versions they replaced,
+ * using the tables and settings of the configuration being built. Each
+ * check prints one line and the run fails if any check does:
+ *
+ *   - Thermistor lookup: temp_from_table() against a linear scan of the
+ *     same table, for every raw value. The results must be identical.
+ *   - Delta segments: inverse_kinematics_batch() against inverse_kinematics()
+ *     for each point of many random segments, anywhere every arm reaches.
+ *     The towers must agree within 1um. A second line times both over the
+ *     same points, for information only.
+ *   - SCARA_FAST_TRIG: the table-driven arm angles against libm in double
+ *     precision, over the bed, and the batched segments against single
+ *     points as for Delta. Both must agree within a tenth of a step.
+ */
+
+#ifndef _HAL_LINUX_SELFCHECK_H_
+#define _HAL_LINUX_SELFCHECK_H_
+
+#include "../../inc/MarlinConfig.h"
+
+class SelfCheck {
+public:
+  // Run every check that applies, after setup(). Returns the exit status.
+  static int run();
+
+private:
+  static bool thermistor_tables();
+  #if ENABLED(DELTA) || ENABLED(SCARA_FAST_TRIG)
+    static bool ik_batch();
+  #endif
+  #if ENABLED(SCARA_FAST_TRIG)
+    static bool scara_angles();
+  #endif
+};
+
+#endif // _HAL_LINUX_SELFCHECK_H_
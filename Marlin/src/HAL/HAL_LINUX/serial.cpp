@@ -0,0 +1,126 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "serial.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+HalSerial usb_serial;
+
+/**
+ * Create a pseudo-terminal for host software to connect to. The slave
+ * side is kept open here so the port survives hosts reconnecting, and
+ * is put in raw mode so nothing is echoed or translated.
+ */
+bool HalSerial::open_pty(const char * const link_name) {
+  const int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) || unlockpt(master)) return false;
+
+  const char * const slave_name = ptsname(master);
+  fd_slave = open(slave_name, O_RDWR | O_NOCTTY);
+  if (fd_slave < 0) return false;
+
+  termios tio;
+  tcgetattr(fd_slave, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(fd_slave, TCSANOW, &tio);
+
+  // Output to a port nobody reads is dropped, as with USB serial
+  fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+  fd_in = fd_out = master;
+
+  const char *port_name = slave_name;
+  if (link_name) {
+    unlink(link_name);
+    if (!symlink(slave_name, link_name)) port_name = link_name;
+  }
+  fprintf(stderr, "Serial port: %s\n", port_name);
+  return true;
+}
+
+void HalSerial::open_stdio() {
+  fd_in = STDIN_FILENO;
+  fd_out = STDOUT_FILENO;
+  fcntl(fd_in, F_SETFL, fcntl(fd_in, F_GETFL) | O_NONBLOCK);
+}
+
+void HalSerial::fill() {
+  if (rx_head < rx_tail || fd_in < 0 || input_closed) return;
+  rx_head = rx_tail = 0;
+  const ssize_t n = ::read(fd_in, rx_buffer, sizeof(rx_buffer));
+  if (n > 0)
+    rx_tail = n;
+  else if (n == 0 && fd_in == STDIN_FILENO)
+    input_closed = true;
+}
+
+int HalSerial::peek() {
+  fill();
+  return rx_head < rx_tail ? rx_buffer[rx_head] : -1;
+}
+
+int HalSerial::read() {
+  fill();
+  return rx_head < rx_tail ? rx_buffer[rx_head++] : -1;
+}
+
+uint16_t HalSerial::available() {
+  Clock::poll();
+  fill();
+  return rx_tail - rx_head;
+}
+
+void HalSerial::flushTX() {
+  for (uint16_t sent = 0; sent < tx_count;) {
+    const ssize_t n = ::write(fd_out, tx_buffer + sent, tx_count - sent);
+    if (n <= 0) break;
+    sent += n;
+  }
+  tx_count = 0;
+}
+
+void HalSerial::printf(const char *format, ...) {
+  char buffer[256];
+  va_list vArgs;
+  va_start(vArgs, format);
+  const int length = vsnprintf(buffer, sizeof(buffer), format, vArgs);
+  va_end(vArgs);
+  for (int i = 0; i < length && i < (int)sizeof(buffer) - 1; i++) write(buffer[i]);
+}
+
+void HalSerial::print(unsigned long value, int b) {
+  if (b == DEC) return printf("%lu", value);
+  if (b == HEX) return printf("%lX", value);
+  if (b == OCT) return printf("%lo", value);
+  char digits[8 * sizeof(value) + 1], *p = &digits[sizeof(digits) - 1];
+  *p = '\0';
+  do { *--p = '0' + (value & 1); value >>= 1; } while (value);
+  print(p);
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,101 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Serial port for the Linux simulation
+ *
+ * Either a pseudo-terminal, which host software can open like any USB
+ * serial port, or the process's stdin / stdout for piping G-code through.
+ */
+
+#ifndef HAL_SERIAL_H_
+#define HAL_SERIAL_H_
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class HalSerial {
+public:
+  HalSerial() : fd_in(-1), fd_out(-1), fd_slave(-1), rx_head(0), rx_tail(0), tx_count(0), input_closed(false) {}
+
+  bool open_pty(const char * const link_name);
+  void open_stdio();
+
+  void begin(int32_t baud) { (void)baud; }
+
+  int peek();
+  int read();
+  uint16_t available();
+  void flush() { rx_head = rx_tail = 0; }
+
+  size_t write(const uint8_t c) {
+    tx_buffer[tx_count++] = c;
+    if (c == '\n' || tx_count == sizeof(tx_buffer)) flushTX();
+    return 1;
+  }
+  void flushTX();
+
+  // Input has ended (stdin only) and everything sent has been read
+  bool eof() { return input_closed && rx_head == rx_tail; }
+
+  operator bool() { return fd_out >= 0; }
+
+  void printf(const char *format, ...);
+
+  void print(const char value[])              { printf("%s" , value); }
+  void print(char value, int = 0)             { write(value); }
+  void print(unsigned char value, int b = DEC) { print((unsigned long)value, b); }
+  void print(int value, int b = DEC)          { print((long)value, b); }
+  void print(unsigned int value, int b = DEC) { print((unsigned long)value, b); }
+  void print(long value, int b = DEC)         { if (b == DEC) printf("%ld", value); else print((unsigned long)value, b); }
+  void print(unsigned long value, int b = DEC);
+
+  void print(float value, int round = 2)      { print((double)value, round); }
+  void print(double value, int round = 2)     { printf("%.*f", round, value); }
+
+  void println(const char value[])            { print(value); println(); }
+  void println(char value, int = 0)           { print(value); println(); }
+  void println(unsigned char value, int b = DEC) { print(value, b); println(); }
+  void println(int value, int b = DEC)        { print(value, b); println(); }
+  void println(unsigned int value, int b = DEC) { print(value, b); println(); }
+  void println(long value, int b = DEC)       { print(value, b); println(); }
+  void println(unsigned long value, int b = DEC) { print(value, b); println(); }
+  void println(float value, int round = 2)    { print(value, round); println(); }
+  void println(double value, int round = 2)   { print(value, round); println(); }
+  void println(void)                          { write('\n'); }
+
+private:
+  int fd_in, fd_out, fd_slave;
+  uint8_t rx_buffer[1024], tx_buffer[256];
+  uint16_t rx_head, rx_tail, tx_count;
+  bool input_closed;
+
+  void fill();
+};
+
+#endif // HAL_SERIAL_H_
@@ -0,0 +1,45 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPI_PINS_LINUX_H
+#define SPI_PINS_LINUX_H
+
+/**
+ * Define SPI Pins: SCK, MISO, MOSI, SS
+ *
+ * The simulated board has the Mega's hardware SPI pins. Only the select
+ * line matters to the simulated SD card.
+ */
+#ifndef SCK_PIN
+  #define SCK_PIN  52
+#endif
+#ifndef MISO_PIN
+  #define MISO_PIN 50
+#endif
+#ifndef MOSI_PIN
+  #define MOSI_PIN 51
+#endif
+#ifndef SS_PIN
+  #define SS_PIN   53
+#endif
+
+#endif // SPI_PINS_LINUX_H
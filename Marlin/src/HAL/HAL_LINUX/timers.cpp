@@ -0,0 +1,78 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ * Copyright (c) 2016 Bob Cousins bobcousins42@googlemail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "timers.h"
+
+extern HAL_STEP_TIMER_ISR;
+extern HAL_TEMP_TIMER_ISR;
+
+sim_timer_t sim_timer[2];
+
+void (*sim_step_isr)() = HAL_step_timer_isr;
+
+void HAL_timer_init(void) {
+  for (uint8_t i = 0; i < COUNT(sim_timer); i++)
+    sim_timer[i] = (sim_timer_t){ 0, HAL_TIMER_TYPE_MAX, false, false };
+}
+
+void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency) {
+  sim_timer_t &t = sim_timer[timer_num];
+  t.compare = uint32_t(HAL_TIMER_RATE) / frequency; // Match value (period) to set frequency
+  t.start_ns = Clock::nanos();
+  t.running = true;
+}
+
+void HAL_timer_enable_interrupt(const uint8_t timer_num) { sim_timer[timer_num].enabled = true; }
+
+void HAL_timer_disable_interrupt(const uint8_t timer_num) { sim_timer[timer_num].enabled = false; }
+
+void HAL_timer_isr_prologue(const uint8_t timer_num) { UNUSED(timer_num); }
+
+/**
+ * The earliest pending timer interrupt, or UINT64_MAX if none can fire
+ */
+uint64_t HAL_timer_next_event(uint8_t &timer_num) {
+  uint64_t next = UINT64_MAX;
+  for (uint8_t i = 0; i < COUNT(sim_timer); i++) {
+    const sim_timer_t &t = sim_timer[i];
+    if (!t.running || !t.enabled) continue;
+    const uint64_t due = t.start_ns + uint64_t(t.compare) * (HAL_TIMER_NS_PER_TICK);
+    if (due < next) { next = due; timer_num = i; }
+  }
+  return next;
+}
+
+/**
+ * The counter matched: restart it from the match time, as the hardware
+ * would however late the handler runs, then call the handler.
+ */
+void HAL_timer_run_isr(const uint8_t timer_num) {
+  sim_timer_t &t = sim_timer[timer_num];
+  t.start_ns += uint64_t(t.compare) * (HAL_TIMER_NS_PER_TICK);
+  Clock::enter_isr();
+  if (timer_num == STEP_TIMER_NUM) sim_step_isr(); else HAL_temp_timer_isr();
+  Clock::leave_isr();
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,121 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ * Copyright (c) 2016 Bob Cousins bobcousins42@googlemail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * HAL timers for the Linux simulation
+ *
+ * Two virtual match timers, modelled on the LPC1768 ones: the counter
+ * runs at HAL_TIMER_RATE, raises its interrupt when it reaches the
+ * match value and restarts from 0. Time is taken from Clock.
+ */
+
+#ifndef _HAL_TIMERS_LINUX_H
+#define _HAL_TIMERS_LINUX_H
+
+// --------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------
+
+#include <stdint.h>
+#include "clock.h"
+
+// --------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------
+
+#define FORCE_INLINE __attribute__((always_inline)) inline
+
+typedef uint32_t hal_timer_t;
+#define HAL_TIMER_TYPE_MAX 0xFFFFFFFF
+
+#define STEP_TIMER_NUM 0  // index of timer to use for stepper
+#define TEMP_TIMER_NUM 1  // index of timer to use for temperature
+
+#define HAL_TIMER_RATE         ((F_CPU) / 4)    // frequency of timers peripherals
+#define STEPPER_TIMER_PRESCALE 1.0              // prescaler for setting stepper frequency
+#define HAL_STEPPER_TIMER_RATE HAL_TIMER_RATE   // frequency of stepper timer (HAL_TIMER_RATE / STEPPER_TIMER_PRESCALE)
+#define HAL_TICKS_PER_US       ((HAL_STEPPER_TIMER_RATE) / 1000000) // stepper timer ticks per us
+#define HAL_TEMP_TIMER_RATE    HAL_TIMER_RATE
+#define TEMP_TIMER_FREQUENCY   1000 // temperature interrupt frequency
+
+#define HAL_TIMER_NS_PER_TICK  (1000000000UL / (HAL_TIMER_RATE))
+
+#define ENABLE_STEPPER_DRIVER_INTERRUPT() HAL_timer_enable_interrupt(STEP_TIMER_NUM)
+#define DISABLE_STEPPER_DRIVER_INTERRUPT() HAL_timer_disable_interrupt(STEP_TIMER_NUM)
+#define ENABLE_TEMPERATURE_INTERRUPT() HAL_timer_enable_interrupt(TEMP_TIMER_NUM)
+#define DISABLE_TEMPERATURE_INTERRUPT() HAL_timer_disable_interrupt(TEMP_TIMER_NUM)
+
+#define HAL_ENABLE_ISRs() do { if (thermalManager.in_temp_isr) DISABLE_TEMPERATURE_INTERRUPT(); else ENABLE_TEMPERATURE_INTERRUPT(); ENABLE_STEPPER_DRIVER_INTERRUPT(); } while(0)
+
+#define HAL_STEP_TIMER_ISR  void HAL_step_timer_isr()
+#define HAL_TEMP_TIMER_ISR  void HAL_temp_timer_isr()
+
+// --------------------------------------------------------------------------
+// Types
+// --------------------------------------------------------------------------
+
+typedef struct {
+  uint64_t start_ns;    // Virtual time at which the counter last restarted from 0
+  hal_timer_t compare;  // Match value
+  bool running,         // Counting
+       enabled;         // Interrupt enabled
+} sim_timer_t;
+
+// --------------------------------------------------------------------------
+// Public Variables
+// --------------------------------------------------------------------------
+
+extern sim_timer_t sim_timer[2];
+
+// Handler for the stepper timer: the stepper ISR, or the benchmark's stand-in
+extern void (*sim_step_isr)();
+
+// --------------------------------------------------------------------------
+// Public functions
+// --------------------------------------------------------------------------
+void HAL_timer_init(void);
+void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency);
+
+static FORCE_INLINE void HAL_timer_set_count(const uint8_t timer_num, const hal_timer_t count) {
+  sim_timer_t &t = sim_timer[timer_num];
+  const uint64_t now = Clock::nanos(), match_ns = uint64_t(count) * (HAL_TIMER_NS_PER_TICK);
+  t.compare = count;
+  if (now - t.start_ns > match_ns) t.start_ns = now - match_ns; // generate an immediate ISR
+}
+
+static FORCE_INLINE hal_timer_t HAL_timer_get_count(const uint8_t timer_num) {
+  return sim_timer[timer_num].compare;
+}
+
+static FORCE_INLINE hal_timer_t HAL_timer_get_current_count(const uint8_t timer_num) {
+  Clock::poll(); // Let time pass, so busy-waits on the counter end
+  return (Clock::nanos() - sim_timer[timer_num].start_ns) / (HAL_TIMER_NS_PER_TICK);
+}
+
+void HAL_timer_enable_interrupt(const uint8_t timer_num);
+void HAL_timer_disable_interrupt(const uint8_t timer_num);
+void HAL_timer_isr_prologue(const uint8_t timer_num);
+
+// For Clock: when the next timer interrupt is due, and deliver it
+uint64_t HAL_timer_next_event(uint8_t &timer_num);
+void HAL_timer_run_isr(const uint8_t timer_num);
+
+#endif // _HAL_TIMERS_LINUX_H
@@ -134,26 +134,11 @@ bool HAL_adc_finished(void) {
 #define ADC_USE_LOWPASS_FILTER     // filter out high frequency noise
 #define ADC_LOWPASS_K_VALUE 4      // how much to smooth out noise (1:8)
 
-struct MedianFilter {
-  uint16_t values[3];
-  uint8_t next_val;
-  MedianFilter() {
-    next_val = 0;
-    values[0] = values[1] = values[2] = 0;
-  }
-  uint16_t update(uint16_t value) {
-    values[next_val++] = value;
-    next_val = next_val % 3;
-    return max(min(values[0], values[1]), min(max(values[0], values[1]), values[2]));     //median
-  }
-};
+#include "../adc_filter.h"
 
 uint16_t lowpass_filter(uint16_t value) {
-  const uint8_t k_data_shift = ADC_LOWPASS_K_VALUE;
-  static uint32_t data_delay[NUM_ANALOG_INPUTS] = { 0 };
-  uint32_t &active_filter = data_delay[active_adc];
-  active_filter = active_filter - (active_filter >> k_data_shift) + value;
-  return (uint16_t)(active_filter >> k_data_shift);
+  static ADCLowpassFilter<ADC_LOWPASS_K_VALUE> data_delay[NUM_ANALOG_INPUTS];
+  return data_delay[active_adc].update(value);
 }
 
 uint16_t HAL_adc_get_result(void) {
@@ -161,7 +146,7 @@ uint16_t HAL_adc_get_result(void) {
   CBI(LPC_ADC->ADCR, 24);    // Stop conversion
   if (data & ADC_OVERRUN) return 0;
   #ifdef ADC_USE_MEDIAN_FILTER
-    static MedianFilter median_filter[NUM_ANALOG_INPUTS];
+    static ADCMedianFilter median_filter[NUM_ANALOG_INPUTS];
     data = median_filter[active_adc].update((uint16_t)data);
   #endif
   #ifdef ADC_USE_LOWPASS_FILTER
@@ -170,6 +155,56 @@ uint16_t HAL_adc_get_result(void) {
   return ((data >> 6) & 0x3ff);    // 10bit
 }
 
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+
+  #include "../adc_scan.h"
+
+  /**
+   * Burst mode: the ADC converts every selected channel in turn, forever,
+   * leaving the latest result of each channel in its own ADDRn register.
+   * No CPU time or DMA channel is needed to keep the samples fresh.
+   */
+  static uint8_t scan_channel[ADC_SCAN_MAX_CHANNELS];
+
+  void HAL_adc_scan_start(const pin_t pins[], const uint8_t count) {
+    uint32_t sel = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      scan_channel[i] = pins[i];
+      SBI(sel, pins[i]);
+    }
+    LPC_ADC->ADINTEN = 0;                          // No interrupts, results are polled
+    LPC_ADC->ADCR = (LPC_ADC->ADCR & ~0xFF) | sel; // Select all scanned channels
+    CBI(LPC_ADC->ADCR, 24);                        // START must be 0 in burst mode
+    SBI(LPC_ADC->ADCR, 16);                        // BURST: 1 = hardware scan
+  }
+
+  uint16_t HAL_adc_scan_sample(const uint8_t index) {
+    const uint32_t data = (&LPC_ADC->ADDR0)[scan_channel[index]];
+    return (data >> 6) & 0x3FF;    // 10bit
+  }
+
+#endif // ADC_CONTINUOUS_SCAN
+
+#if ENABLED(HARDWARE_PWM_HEATERS)
+
+  #include "LPC1768_PWM.h"
+
+  /**
+   * Reserve a PWM1 slot for a heater or fan. Pins wired to a PWM1 match
+   * output are driven entirely in hardware. Other pins are toggled by the
+   * 50Hz PWM1 interrupt, which still takes the work out of Temperature::isr().
+   * A minimum of 0 lets the output stay fully off.
+   */
+  bool HAL_pwm_attach(const pin_t pin) {
+    return LPC1768_PWM_attach_pin(pin, 0, LPC_PWM1_MR0 - (MR0_MARGIN), 0xFF);
+  }
+
+  void HAL_pwm_write(const pin_t pin, const uint8_t value) {
+    LPC1768_PWM_write(pin, map(value, 0, 255, 0, LPC_PWM1_MR0 - (MR0_MARGIN)));
+  }
+
+#endif // HARDWARE_PWM_HEATERS
+
 #define SBIT_CNTEN     0
 #define SBIT_PWMEN     2
 #define SBIT_PWMMR0R   1
@@ -65,6 +65,11 @@ extern "C" volatile uint32_t _millis;
 #include "HAL_timers.h"
 #include "HardwareSerial.h"
 
+// Use the LPC1768 u8g com functions (see lcd/dogm/HAL_LCD_com_defines.h)
+#ifndef U8G_HAL_LINKS
+  #define U8G_HAL_LINKS
+#endif
+
 #define ST7920_DELAY_1 DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP
 #define ST7920_DELAY_2 DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP
 #define ST7920_DELAY_3 DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP;DELAY_5_NOP
@@ -108,4 +113,11 @@ void HAL_adc_enable_channel(int pin);
 void HAL_adc_start_conversion(const uint8_t adc_pin);
 uint16_t HAL_adc_get_result(void);
 
+void HAL_adc_scan_start(const pin_t pins[], const uint8_t count);
+uint16_t HAL_adc_scan_sample(const uint8_t index);
+
+// Hardware PWM for heaters and fans
+bool HAL_pwm_attach(const pin_t pin);
+void HAL_pwm_write(const pin_t pin, const uint8_t value);
+
 #endif // _HAL_LPC1768_H
@@ -27,7 +27,7 @@
 #ifdef TARGET_LPC1768
 
   // pointers to low level routines - must always supply these
-  //#define U8G_HAL_LINKS
+  // U8G_HAL_LINKS is defined in HAL.h
   #define HAL_LCD_pin_routines "HAL_LPC1768/HAL_LCD_pin_routines.h"
   #define HAL_LCD_I2C_routines  "HAL_LPC1768/HAL_LCD_I2C_routines.h"
   #define HAL_LCD_delay "HAL_LPC1768/HAL_LCD_delay.h"
@@ -222,7 +222,13 @@ PinCfg.Portnum = LPC1768_PIN_PORT(MISO_PIN);
   }
 
 
+  // The SD card and a display on the same bus both set their rate before each
+  // use, so only reprogram SSP0 when the rate actually changes.
+  static uint8_t spi_rate_set = 0xFF;
+
   void spiInit(uint8_t spiRate) {
+    if (spiRate == spi_rate_set) return;
+    spi_rate_set = spiRate;
 
    // table to convert Marlin spiRates (0-5 plus default) into bit rates
     uint32_t Marlin_speed[7]; // CPSR is always 2
@@ -37,33 +37,51 @@
  #ifndef _ENDSTOP_INTERRUPTS_H_
  #define _ENDSTOP_INTERRUPTS_H_
 
+/**
+ *  Endstop interrupts for LPC1768 based targets.
+ *  Only pins on ports 0 and 2 raise GPIO interrupts. attachInterrupt takes
+ *  the pin_t directly and silently ignores pins on the other ports, so
+ *  refuse to build with any of those.
+ */
+
+#define _LPC1768_INTERRUPT_PIN(P) (LPC1768_PIN_PORT(P) == 0 || LPC1768_PIN_PORT(P) == 2)
+
 void setup_endstop_interrupts(void) {
   #if HAS_X_MAX
-    attachInterrupt(digitalPinToInterrupt(X_MAX_PIN), endstop_ISR, CHANGE); // assign it
+    static_assert(_LPC1768_INTERRUPT_PIN(X_MAX_PIN), "X_MAX_PIN is not interrupt-capable");
+    attachInterrupt(X_MAX_PIN, endstop_ISR, CHANGE); // assign it
   #endif
   #if HAS_X_MIN
-    attachInterrupt(digitalPinToInterrupt(X_MIN_PIN), endstop_ISR, CHANGE);
+    static_assert(_LPC1768_INTERRUPT_PIN(X_MIN_PIN), "X_MIN_PIN is not interrupt-capable");
+    attachInterrupt(X_MIN_PIN, endstop_ISR, CHANGE);
   #endif
   #if HAS_Y_MAX
-    attachInterrupt(digitalPinToInterrupt(Y_MAX_PIN), endstop_ISR, CHANGE);
+    static_assert(_LPC1768_INTERRUPT_PIN(Y_MAX_PIN), "Y_MAX_PIN is not interrupt-capable");
+    attachInterrupt(Y_MAX_PIN, endstop_ISR, CHANGE);
   #endif
   #if HAS_Y_MIN
-    attachInterrupt(digitalPinToInterrupt(Y_MIN_PIN), endstop_ISR, CHANGE);
+    static_assert(_LPC1768_INTERRUPT_PIN(Y_MIN_PIN), "Y_MIN_PIN is not interrupt-capable");
+    attachInterrupt(Y_MIN_PIN, endstop_ISR, CHANGE);
   #endif
   #if HAS_Z_MAX
-    attachInterrupt(digitalPinToInterrupt(Z_MAX_PIN), endstop_ISR, CHANGE);
+    static_assert(_LPC1768_INTERRUPT_PIN(Z_MAX_PIN), "Z_MAX_PIN is not interrupt-capable");
+    attachInterrupt(Z_MAX_PIN, endstop_ISR, CHANGE);
   #endif
   #if HAS_Z_MIN
-     attachInterrupt(digitalPinToInterrupt(Z_MIN_PIN), endstop_ISR, CHANGE);
+    static_assert(_LPC1768_INTERRUPT_PIN(Z_MIN_PIN), "Z_MIN_PIN is not interrupt-capable");
+    attachInterrupt(Z_MIN_PIN, endstop_ISR, CHANGE);
   #endif
   #if HAS_Z2_MAX
-    attachInterrupt(digitalPinToInterrupt(Z2_MAX_PIN), endstop_ISR, CHANGE);
+    static_assert(_LPC1768_INTERRUPT_PIN(Z2_MAX_PIN), "Z2_MAX_PIN is not interrupt-capable");
+    attachInterrupt(Z2_MAX_PIN, endstop_ISR, CHANGE);
   #endif
   #if HAS_Z2_MIN
-    attachInterrupt(digitalPinToInterrupt(Z2_MIN_PIN), endstop_ISR, CHANGE);
+    static_assert(_LPC1768_INTERRUPT_PIN(Z2_MIN_PIN), "Z2_MIN_PIN is not interrupt-capable");
+    attachInterrupt(Z2_MIN_PIN, endstop_ISR, CHANGE);
   #endif
   #if HAS_Z_MIN_PROBE_PIN
-    attachInterrupt(digitalPinToInterrupt(Z_MIN_PROBE_PIN), endstop_ISR, CHANGE);
+    static_assert(_LPC1768_INTERRUPT_PIN(Z_MIN_PROBE_PIN), "Z_MIN_PROBE_PIN is not interrupt-capable");
+    attachInterrupt(Z_MIN_PROBE_PIN, endstop_ISR, CHANGE);
   #endif
 }
 
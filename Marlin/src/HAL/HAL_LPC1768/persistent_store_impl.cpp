@@ -39,8 +39,20 @@ namespace PersistentStore {
 FATFS fat_fs;
 FIL eeprom_file;
 
+/**
+ * The whole EEPROM image is staged in RAM. Reads and writes only touch the
+ * RAM copy, and access_finish() writes back just the sectors that changed,
+ * one f_write per sector, instead of an f_lseek/f_write for every value.
+ */
+#define EEPROM_SECTOR_SIZE 512
+#define EEPROM_SECTORS ((E2END + EEPROM_SECTOR_SIZE) / EEPROM_SECTOR_SIZE)
+
+static_assert(EEPROM_SECTORS <= 32, "EEPROM image is too large for the dirty sector mask.");
+
+static uint8_t eeprom_image[EEPROM_SECTORS * EEPROM_SECTOR_SIZE];
+static uint32_t dirty_sectors;
+
 bool access_start() {
-  const char eeprom_erase_value = 0xFF;
   MSC_Aquire_Lock();
   if (f_mount(&fat_fs, "", 1)) {
     MSC_Release_Lock();
@@ -49,31 +61,40 @@ bool access_start() {
   FRESULT res = f_open(&eeprom_file, "eeprom.dat", FA_OPEN_ALWAYS | FA_WRITE | FA_READ);
   if (res) MSC_Release_Lock();
 
+  dirty_sectors = 0;
   if (res == FR_OK) {
-    UINT bytes_written;
-    FSIZE_t file_size = f_size(&eeprom_file);
-    f_lseek(&eeprom_file, file_size);
-    while (file_size <= E2END && res == FR_OK) {
-      res = f_write(&eeprom_file, &eeprom_erase_value, 1, &bytes_written);
-      file_size++;
+    UINT bytes_read = 0;
+    res = f_read(&eeprom_file, eeprom_image, sizeof(eeprom_image), &bytes_read);
+    if (res == FR_OK && bytes_read < sizeof(eeprom_image)) {
+      // A new or short file reads as erased EEPROM. Extend it on the next write-back.
+      memset(&eeprom_image[bytes_read], 0xFF, sizeof(eeprom_image) - bytes_read);
+      for (uint8_t i = bytes_read / EEPROM_SECTOR_SIZE; i < EEPROM_SECTORS; i++) SBI(dirty_sectors, i);
     }
   }
-  if (res == FR_OK) {
-    f_lseek(&eeprom_file, 0);
-    f_sync(&eeprom_file);
-  }
   return res == FR_OK;
 }
 
 bool access_finish() {
+  FRESULT res = FR_OK;
+  for (uint8_t i = 0; i < EEPROM_SECTORS && res == FR_OK; i++) {
+    if (!TEST(dirty_sectors, i)) continue;
+    UINT bytes_written = 0;
+    res = f_lseek(&eeprom_file, i * EEPROM_SECTOR_SIZE);
+    if (res == FR_OK) res = f_write(&eeprom_file, &eeprom_image[i * EEPROM_SECTOR_SIZE], EEPROM_SECTOR_SIZE, &bytes_written);
+    if (res == FR_OK && bytes_written != EEPROM_SECTOR_SIZE) res = FR_DISK_ERR;
+  }
+  if (res) {
+    SERIAL_ECHO_START();
+    SERIAL_ECHOLNPAIR(MSG_ERR_EEPROM_WRITE " ", (int)res);
+  }
+  dirty_sectors = 0;
   f_close(&eeprom_file);
   f_unmount("");
   MSC_Release_Lock();
-  return true;
+  return res == FR_OK;
 }
 
-// File function return codes for type FRESULT   This goes away soon.   But it is helpful right now to see
-// the different errors the read_data() and write_data() functions are seeing.
+// File function return codes for type FRESULT, as reported by access_finish().
 //
 //  typedef enum {
 //    FR_OK = 0,               /* (0) Succeeded */
@@ -99,61 +120,24 @@ bool access_finish() {
 //  } FRESULT;
 
 bool write_data(int &pos, const uint8_t *value, uint16_t size, uint16_t *crc) {
-  FRESULT s;
-  UINT bytes_written = 0;
-
-  s = f_lseek(&eeprom_file, pos);
-  if (s) {
-   SERIAL_PROTOCOLPAIR(" write_data(", pos);         // This extra chit-chat goes away soon.  But it is helpful
-   SERIAL_PROTOCOLPAIR(",", (int)value);            // right now to see errors that are happening in the
-   SERIAL_PROTOCOLPAIR(",", (int)size);             // read_data() and write_data() functions
-   SERIAL_PROTOCOL("...)\n");
-   SERIAL_PROTOCOLLNPAIR(" f_lseek()=", (int)s);
-   return s;
-  }
-
-  s = f_write(&eeprom_file, (void *)value, size, &bytes_written);
-  if (s) {
-   SERIAL_PROTOCOLPAIR(" write_data(", pos);         // This extra chit-chat goes away soon.  But it is helpful
-   SERIAL_PROTOCOLPAIR(",", (int)value);            // right now to see errors that are happening in the
-   SERIAL_PROTOCOLPAIR(",", size);             // read_data() and write_data() functions
-   SERIAL_PROTOCOLLN("...)");
-   SERIAL_PROTOCOLLNPAIR(" f_write()=", (int)s);
-   SERIAL_PROTOCOLPAIR(" size=", size);
-   SERIAL_PROTOCOLLNPAIR("\n bytes_written=", bytes_written);
-   return s;
+  if (pos < 0 || pos + size > (int)sizeof(eeprom_image)) return true;
+  for (uint16_t i = 0; i < size; i++, pos++) {
+    // Only mark sectors that really change
+    if (eeprom_image[pos] != value[i]) {
+      eeprom_image[pos] = value[i];
+      SBI(dirty_sectors, pos / EEPROM_SECTOR_SIZE);
+    }
   }
   crc16(crc, value, size);
-  pos = pos + size;
-  return (bytes_written != size);  // return true for any error
+  return false;
 }
 
 bool read_data(int &pos, uint8_t* value, uint16_t size, uint16_t *crc) {
-  UINT bytes_read = 0;
-  FRESULT s;
-  s = f_lseek(&eeprom_file, pos);
-  if ( s ) {
-   SERIAL_PROTOCOLPAIR(" read_data(", pos);          // This extra chit-chat goes away soon.  But it is helpful
-   SERIAL_PROTOCOLPAIR(",", (int)value);            // right now to see errors that are happening in the
-   SERIAL_PROTOCOLPAIR(",", size);             // read_data() and write_data() functions
-   SERIAL_PROTOCOLLN("...)");
-   SERIAL_PROTOCOLLNPAIR(" f_lseek()=", (int)s);
-   return true;
-  }
-  s = f_read(&eeprom_file, (void *)value, size, &bytes_read);
-  if (s) {
-   SERIAL_PROTOCOLPAIR(" read_data(", pos);         // This extra chit-chat goes away soon.  But it is helpful
-   SERIAL_PROTOCOLPAIR(",", (int)value);           // right now to see errors that are happening in the
-   SERIAL_PROTOCOLPAIR(",", size);            // read_data() and write_data() functions
-   SERIAL_PROTOCOLLN("...)");
-   SERIAL_PROTOCOLLNPAIR(" f_write()=", (int)s);
-   SERIAL_PROTOCOLPAIR(" size=", size);
-   SERIAL_PROTOCOLLNPAIR("\n bytes_read=",  bytes_read);
-   return true;
-  }
+  if (pos < 0 || pos + size > (int)sizeof(eeprom_image)) return true;
+  memcpy(value, &eeprom_image[pos], size);
   crc16(crc, value, size);
-  pos = pos + size;
-  return bytes_read != size;  // return true for any error
+  pos += size;
+  return false;
 }
 
 } // PersistentStore
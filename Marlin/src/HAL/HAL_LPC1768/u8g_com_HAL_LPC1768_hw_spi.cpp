@@ -119,25 +119,8 @@
         break;
 
       case U8G_COM_MSG_WRITE_SEQ:
-        {
-          uint8_t *ptr = (uint8_t*) arg_ptr;
-          while( arg_val > 0 )
-          {
-            spiSend(*ptr++);
-            arg_val--;
-          }
-        }
-        break;
-
       case U8G_COM_MSG_WRITE_SEQ_P:
-        {
-          uint8_t *ptr = (uint8_t*) arg_ptr;
-          while( arg_val > 0 )
-          {
-            spiSend(*ptr++);
-            arg_val--;
-          }
-        }
+        spiSend((uint8_t*)arg_ptr, arg_val);  // Keep the SSP FIFO full for the whole run
         break;
     }
     return 1;
@@ -81,7 +81,7 @@
 
   static uint8_t rs_last_state = 255;
 
-  static void u8g_com_LPC1768_st7920_write_byte_hw_spi(uint8_t rs, uint8_t val)
+  static void u8g_com_LPC1768_st7920_set_rs_hw_spi(uint8_t rs)
   {
     uint8_t i;
 
@@ -98,11 +98,34 @@
       for( i = 0; i < 4; i++ )   // give the controller some time to process the data
         u8g_10MicroDelay();      // 2 is bad, 3 is OK, 4 is safe
     }
+  }
 
+  static void u8g_com_LPC1768_st7920_write_byte_hw_spi(uint8_t rs, uint8_t val)
+  {
+    u8g_com_LPC1768_st7920_set_rs_hw_spi(rs);
     spiSend(val & 0x0f0);
     spiSend(val << 4);
   }
 
+  // Split a run of bytes into nibbles and send them in blocks,
+  // keeping the SSP FIFO full instead of waiting on every byte.
+  static void u8g_com_LPC1768_st7920_write_seq_hw_spi(uint8_t rs, const uint8_t *ptr, uint8_t len)
+  {
+    uint8_t buf[32];
+
+    u8g_com_LPC1768_st7920_set_rs_hw_spi(rs);
+    while ( len > 0 ) {
+      const uint8_t n = len < sizeof(buf) / 2 ? len : sizeof(buf) / 2;
+      for (uint8_t i = 0; i < n; i++) {
+        buf[2 * i] = ptr[i] & 0x0f0;
+        buf[2 * i + 1] = ptr[i] << 4;
+      }
+      spiSend(buf, 2 * n);
+      ptr += n;
+      len -= n;
+    }
+  }
+
 
   uint8_t u8g_com_HAL_LPC1768_ST7920_hw_spi_fn(u8g_t *u8g, uint8_t msg, uint8_t arg_val, void *arg_ptr)
   {
@@ -129,6 +152,7 @@
         break;
 
       case U8G_COM_MSG_CHIP_SELECT:
+        if (arg_val) rs_last_state = 255;  // The st7920 needs a new sync byte after a select
         u8g_SetPILevel(u8g, U8G_PI_CS, arg_val);  //note: the st7920 has an active high chip select
         break;
 
@@ -137,25 +161,8 @@
         break;
 
       case U8G_COM_MSG_WRITE_SEQ:
-        {
-          uint8_t *ptr = (uint8_t*) arg_ptr;
-          while( arg_val > 0 )
-          {
-            u8g_com_LPC1768_st7920_write_byte_hw_spi(u8g->pin_list[U8G_PI_A0_STATE], *ptr++);
-            arg_val--;
-          }
-        }
-        break;
-
-        case U8G_COM_MSG_WRITE_SEQ_P:
-        {
-          uint8_t *ptr = (uint8_t*) arg_ptr;
-          while( arg_val > 0 )
-          {
-            u8g_com_LPC1768_st7920_write_byte_hw_spi(u8g->pin_list[U8G_PI_A0_STATE], *ptr++);
-            arg_val--;
-          }
-        }
+      case U8G_COM_MSG_WRITE_SEQ_P:
+        u8g_com_LPC1768_st7920_write_seq_hw_spi(u8g->pin_list[U8G_PI_A0_STATE], (uint8_t*)arg_ptr, arg_val);
         break;
     }
     return 1;
@@ -31,7 +31,7 @@
 // Includes
 // --------------------------------------------------------------------------
 
-#include "../HAL.h"
+#include "../../inc/MarlinConfig.h"
 
 //#include <Wire.h>
 
@@ -135,4 +135,68 @@ uint16_t HAL_adc_get_result(void) {
   return HAL_adc_result;
 }
 
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+
+  #include "../adc_scan.h"
+  #include <libmaple/dma.h>
+
+  /**
+   * Scan mode: ADC1 converts the whole regular sequence continuously and
+   * DMA1 channel 1 copies each result into adc_scan_buffer, wrapping around
+   * at the end. The buffer always holds the latest sample of every input.
+   */
+  static volatile uint16_t adc_scan_buffer[ADC_SCAN_MAX_CHANNELS];
+
+  void HAL_adc_scan_start(const pin_t pins[], const uint8_t count) {
+    uint32_t sqr[3] = { 0 };  // SQR1, SQR2, SQR3
+    for (uint8_t i = 0; i < count; i++)
+      sqr[2 - i / 6] |= (uint32_t)PIN_MAP[pins[i]].adc_channel << (5 * (i % 6));
+
+    adc_set_sample_rate(ADC1, ADC_SMPR_239_5);  // Long sample time for high-impedance thermistor dividers
+    adc_set_reg_seqlen(ADC1, count);
+    ADC1->regs->SQR1 = (ADC1->regs->SQR1 & ADC_SQR1_L) | sqr[0];
+    ADC1->regs->SQR2 = sqr[1];
+    ADC1->regs->SQR3 = sqr[2];
+    ADC1->regs->CR1 |= ADC_CR1_SCAN;
+    ADC1->regs->CR2 |= ADC_CR2_CONT | ADC_CR2_DMA;
+
+    dma_init(DMA1);
+    dma_setup_transfer(DMA1, DMA_CH1, &ADC1->regs->DR, DMA_SIZE_16BITS,
+                       (void*)adc_scan_buffer, DMA_SIZE_16BITS, (DMA_MINC_MODE | DMA_CIRC_MODE));
+    dma_set_num_transfers(DMA1, DMA_CH1, count);
+    dma_enable(DMA1, DMA_CH1);
+
+    ADC1->regs->CR2 |= ADC_CR2_SWSTART;
+  }
+
+  uint16_t HAL_adc_scan_sample(const uint8_t index) {
+    return (adc_scan_buffer[index] >> 2) & 0x3FF; // 12 to 10 bits
+  }
+
+#endif // ADC_CONTINUOUS_SCAN
+
+// --------------------------------------------------------------------------
+// Hardware PWM
+// --------------------------------------------------------------------------
+
+#if ENABLED(HARDWARE_PWM_HEATERS)
+
+  #define _TIMER_DEV(N) TIMER##N
+  #define TIMER_DEV(N) _TIMER_DEV(N)
+
+  // Use any pin with a timer channel, except on the stepper and temperature timers
+  bool HAL_pwm_attach(const pin_t pin) {
+    timer_dev * const dev = PIN_MAP[pin].timer_device;
+    if (!dev || dev == TIMER_DEV(STEP_TIMER_NUM) || dev == TIMER_DEV(TEMP_TIMER_NUM)) return false;
+    pinMode(pin, PWM);
+    pwmWrite(pin, 0);
+    return true;
+  }
+
+  void HAL_pwm_write(const pin_t pin, const uint8_t value) {
+    pwmWrite(pin, (uint32_t)value * timer_get_reload(PIN_MAP[pin].timer_device) / 255);
+  }
+
+#endif // HARDWARE_PWM_HEATERS
+
 #endif // __STM32F1__
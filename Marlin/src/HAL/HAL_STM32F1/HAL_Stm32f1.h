@@ -192,6 +192,14 @@ void HAL_adc_start_conversion(const uint8_t adc_pin);
 
 uint16_t HAL_adc_get_result(void);
 
+void HAL_adc_scan_start(const pin_t pins[], const uint8_t count);
+uint16_t HAL_adc_scan_sample(const uint8_t index);
+
+// Hardware PWM for heaters and fans
+
+bool HAL_pwm_attach(const pin_t pin);
+void HAL_pwm_write(const pin_t pin, const uint8_t value);
+
 /* Todo: Confirm none of this is needed.
 uint16_t HAL_getAdcReading(uint8_t chan);
 
@@ -68,3 +68,10 @@
     #endif
   #endif
 #endif // SPINDLE_LASER_ENABLE
+
+/**
+ * The u8g hardware SPI com functions aren't implemented for the STM32F1 HAL
+ */
+#if ENABLED(DOGM_HARDWARE_SPI)
+  #error "DOGM_HARDWARE_SPI is not yet supported on STM32F1."
+#endif
@@ -49,6 +49,51 @@
 #ifndef _ENDSTOP_INTERRUPTS_H_
 #define _ENDSTOP_INTERRUPTS_H_
 
+/**
+ * Refuse to build when two endstop pins share an EXTI line: the later
+ * attachInterrupt would take the line over and the other pin go unseen.
+ * Libmaple numbers pins PA0-PA15, PB0-PB15, ... so the line is pin % 16.
+ */
+constexpr pin_t endstop_interrupt_pins[] = {
+  #if HAS_X_MAX
+    X_MAX_PIN,
+  #endif
+  #if HAS_X_MIN
+    X_MIN_PIN,
+  #endif
+  #if HAS_Y_MAX
+    Y_MAX_PIN,
+  #endif
+  #if HAS_Y_MIN
+    Y_MIN_PIN,
+  #endif
+  #if HAS_Z_MAX
+    Z_MAX_PIN,
+  #endif
+  #if HAS_Z_MIN
+    Z_MIN_PIN,
+  #endif
+  #if HAS_Z2_MAX
+    Z2_MAX_PIN,
+  #endif
+  #if HAS_Z2_MIN
+    Z2_MIN_PIN,
+  #endif
+  #if HAS_Z_MIN_PROBE_PIN
+    Z_MIN_PROBE_PIN,
+  #endif
+};
+
+constexpr bool endstop_exti_lines_distinct(const uint8_t i=0, const uint8_t j=1) {
+  return i >= COUNT(endstop_interrupt_pins) ? true
+       : j >= COUNT(endstop_interrupt_pins) ? endstop_exti_lines_distinct(i + 1, i + 2)
+       : endstop_interrupt_pins[i] != endstop_interrupt_pins[j]
+         && endstop_interrupt_pins[i] % 16 == endstop_interrupt_pins[j] % 16 ? false
+       : endstop_exti_lines_distinct(i, j + 1);
+}
+
+static_assert(endstop_exti_lines_distinct(), "Two endstop pins share an EXTI line (same pin number on different ports).");
+
 void setup_endstop_interrupts(void) {
   #if HAS_X_MAX
     SET_INPUT(X_MAX_PIN);
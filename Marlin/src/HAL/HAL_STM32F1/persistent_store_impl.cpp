@@ -47,6 +47,7 @@ namespace PersistentStore {
 #define CONFIG_FILE_NAME "eeprom.dat"
 #define HAL_STM32F1_EEPROM_SIZE 4096
 char HAL_STM32F1_eeprom_content[HAL_STM32F1_EEPROM_SIZE];
+static bool HAL_STM32F1_eeprom_dirty; // Only rewrite the file when something changed
 
 bool access_start() {
 	if (!card.cardOK) return false;
@@ -59,22 +60,28 @@ bool access_start() {
 		HAL_STM32F1_eeprom_content[bytes_read] = eeprom_zero;
 	}
 	card.closefile();
+	HAL_STM32F1_eeprom_dirty = false;
 	return true;
 }
 
 
 bool access_finish(){
 	if (!card.cardOK) return false;
+	if (!HAL_STM32F1_eeprom_dirty) return true;
 	int16_t bytes_written = 0;
 	card.openFile((char *)CONFIG_FILE_NAME,true);
 	bytes_written = card.write (HAL_STM32F1_eeprom_content, HAL_STM32F1_EEPROM_SIZE);
 	card.closefile();
+	HAL_STM32F1_eeprom_dirty = false;
 	return (bytes_written == HAL_STM32F1_EEPROM_SIZE);
 }
 
 bool write_data(int &pos, const uint8_t *value, uint16_t size, uint16_t *crc) {
 	for (int i = 0; i < size; i++) {
-		HAL_STM32F1_eeprom_content [pos + i] = value[i];
+		if (HAL_STM32F1_eeprom_content [pos + i] != (char)value[i]) {
+			HAL_STM32F1_eeprom_content [pos + i] = value[i];
+			HAL_STM32F1_eeprom_dirty = true;
+		}
 	}
 	crc16(crc, value, size);
 	pos += size;
@@ -32,6 +32,8 @@
   #include "HAL_LPC1768/SanityCheck_Re_ARM.h"
 #elif defined(__STM32F1__)
     #include "HAL_STM32F1/SanityCheck_Stm32f1.h"
+#elif defined(__PLAT_LINUX__)
+  #include "HAL_LINUX/SanityCheck_Linux.h"
 #else
   #error Unsupported Platform!
 #endif
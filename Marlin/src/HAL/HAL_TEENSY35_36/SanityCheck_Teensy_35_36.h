@@ -27,3 +27,24 @@
 /**
  * Require gcc 4.7 or newer (first included with Arduino 1.6.8) for C++11 features.
  */
+
+/**
+ * Continuous ADC scan is not implemented for the Kinetis ADC
+ */
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+  #error "ADC_CONTINUOUS_SCAN is not yet supported on Teensy 3.5/3.6."
+#endif
+
+/**
+ * FTM0 and FTM1 are used by the stepper and temperature interrupts
+ */
+#if ENABLED(HARDWARE_PWM_HEATERS)
+  #error "HARDWARE_PWM_HEATERS is not yet supported on Teensy 3.5/3.6."
+#endif
+
+/**
+ * The u8g hardware SPI com functions aren't implemented for the Teensy HAL
+ */
+#if ENABLED(DOGM_HARDWARE_SPI)
+  #error "DOGM_HARDWARE_SPI is not yet supported on Teensy 3.5/3.6."
+#endif
@@ -29,6 +29,7 @@ volatile uint8_t e_hit = 0; // Different from 0 when the endstops should be test
 // This is what is really done inside the interrupts.
 FORCE_INLINE void endstop_ISR_worker( void ) {
   e_hit = 2; // Because the detection of a e-stop hit has a 1 step debouncer it has to be called at least twice.
+  Stepper::latch_endstop_position(); // Remember where the motors were at the edge, not where they are once polled
 }
 
 // One ISR for all EXT-Interrupts
@@ -46,6 +47,18 @@ void endstop_ISR(void) { endstop_ISR_worker(); }
 
   #include "HAL_TEENSY35_36/endstop_interrupts.h"
 
+#elif defined(TARGET_LPC1768)
+
+  #include "HAL_LPC1768/endstop_interrupts.h"
+
+#elif defined(__STM32F1__) || defined(TARGET_STM32F1)
+
+  #include "HAL_STM32F1/endstop_interrupts.h"
+
+#elif defined(__PLAT_LINUX__)
+
+  #include "HAL_LINUX/endstop_interrupts.h"
+
 #else
 
   #error Unsupported Platform!
@@ -31,6 +31,8 @@
   #include "HAL_TEENSY35_36/HAL_pinsDebug_Teensy.h"
 #elif defined(TARGET_LPC1768)
   #include "HAL_LPC1768/pinsDebug_LPC1768.h"
+#elif defined(__PLAT_LINUX__)
+  #include "HAL_LINUX/pinsDebug_Linux.h"
 #else
   #error Unsupported Platform!
 #endif
@@ -36,6 +36,8 @@
   #include "HAL_LPC1768/spi_pins.h"
 #elif defined(__STM32F1__)
     #include "HAL_STM32F1/spi_pins.h"
+#elif defined(__PLAT_LINUX__)
+  #include "HAL_LINUX/spi_pins.h"
 #else
   #error "Unsupported Platform!"
 #endif
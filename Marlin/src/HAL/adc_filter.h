@@ -0,0 +1,67 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _ADC_FILTER_H_
+#define _ADC_FILTER_H_
+
+/**
+ * Description: Filters for raw ADC samples.
+ * Not platform dependent.
+ */
+
+#include <stdint.h>
+
+/**
+ * Median of the last 3 samples. Rejects single-sample spikes
+ * without the lag of an averaging filter.
+ */
+struct ADCMedianFilter {
+  uint16_t values[3];
+  uint8_t next_val;
+  ADCMedianFilter() { next_val = 0; values[0] = values[1] = values[2] = 0; }
+  uint16_t update(const uint16_t value) {
+    values[next_val++] = value;
+    if (next_val > 2) next_val = 0;
+    const uint16_t lo = values[0] < values[1] ? values[0] : values[1],
+                   hi = values[0] < values[1] ? values[1] : values[0],
+                   mid = hi < values[2] ? hi : values[2];
+    return lo > mid ? lo : mid;
+  }
+};
+
+/**
+ * First-order IIR low-pass with a power-of-2 time constant.
+ * K = 0 passes samples through unchanged.
+ */
+template<uint8_t K>
+struct ADCLowpassFilter {
+  uint32_t data;
+  ADCLowpassFilter() { data = 0; }
+  uint16_t update(const uint16_t value) {
+    if (!K) return value;
+    if (!data) data = (uint32_t)value << K;   // Start at the first sample instead of ramping up from 0
+    data = data - (data >> K) + value;
+    return (uint16_t)(data >> K);
+  }
+};
+
+#endif // _ADC_FILTER_H_
@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Description: Continuous background ADC scan with filtering.
+ * Not platform dependent. Platforms supply HAL_adc_scan_start()
+ * and HAL_adc_scan_sample().
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+
+#include "adc_scan.h"
+#include "adc_filter.h"
+
+#ifndef ADC_SCAN_LOWPASS_K_VALUE
+  #define ADC_SCAN_LOWPASS_K_VALUE 0
+#endif
+
+static uint8_t scan_count = 0;
+static uint16_t scan_value[ADC_SCAN_MAX_CHANNELS];
+
+#if ENABLED(ADC_SCAN_MEDIAN_FILTER)
+  static ADCMedianFilter scan_median[ADC_SCAN_MAX_CHANNELS];
+#endif
+#if ADC_SCAN_LOWPASS_K_VALUE > 0
+  static ADCLowpassFilter<ADC_SCAN_LOWPASS_K_VALUE> scan_lowpass[ADC_SCAN_MAX_CHANNELS];
+#endif
+
+void HAL_adc_scan_init(const pin_t pins[], const uint8_t count) {
+  scan_count = count;
+  HAL_adc_scan_start(pins, count);
+}
+
+void HAL_adc_scan_update() {
+  for (uint8_t i = 0; i < scan_count; i++) {
+    uint16_t v = HAL_adc_scan_sample(i);
+    #if ENABLED(ADC_SCAN_MEDIAN_FILTER)
+      v = scan_median[i].update(v);
+    #endif
+    #if ADC_SCAN_LOWPASS_K_VALUE > 0
+      v = scan_lowpass[i].update(v);
+    #endif
+    scan_value[i] = v;
+  }
+}
+
+uint16_t HAL_adc_scan_value(const uint8_t index) { return scan_value[index]; }
+
+#endif // ADC_CONTINUOUS_SCAN
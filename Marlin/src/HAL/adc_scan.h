@@ -0,0 +1,52 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _ADC_SCAN_H_
+#define _ADC_SCAN_H_
+
+/**
+ * Description: Continuous background ADC scan (ADC_CONTINUOUS_SCAN)
+ *
+ * The platform HAL converts every registered input in the background
+ * and provides the latest raw sample of each one:
+ *
+ *   void HAL_adc_scan_start(const pin_t pins[], const uint8_t count);
+ *   uint16_t HAL_adc_scan_sample(const uint8_t index);   // 10-bit
+ *
+ * HAL_adc_scan_update() pulls those samples through the configured
+ * filters once per temperature interrupt, so every input yields a new
+ * filtered reading on every interrupt.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+
+  #define ADC_SCAN_MAX_CHANNELS 8
+
+  void HAL_adc_scan_init(const pin_t pins[], const uint8_t count);
+  void HAL_adc_scan_update();
+  uint16_t HAL_adc_scan_value(const uint8_t index);
+
+#endif
+
+#endif // _ADC_SCAN_H_
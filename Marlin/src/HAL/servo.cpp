@@ -56,7 +56,7 @@
 
 #include "HAL.h"
 
-#if HAS_SERVOS && !(IS_32BIT_TEENSY || defined(TARGET_LPC1768))
+#if HAS_SERVOS && !(IS_32BIT_TEENSY || defined(TARGET_LPC1768) || defined(__PLAT_LINUX__))
 
 //#include <Arduino.h>
 
@@ -75,6 +75,9 @@
 #elif defined(TARGET_LPC1768)
   #include "HAL_LPC1768/LPC1768_Servo.h"
 
+#elif defined(__PLAT_LINUX__)
+  #include "HAL_LINUX/Servo_Linux.h"
+
 #else
   #include <stdint.h>
 
@@ -150,6 +150,10 @@
   #include "feature/controllerfan.h"
 #endif
 
+#if ENABLED(CPU_PROFILER)
+  #include "feature/profiler.h"
+#endif
+
 bool Running = true;
 
 /**
@@ -637,6 +641,10 @@ void setup() {
     Max7219_init();
   #endif
 
+  #if ENABLED(CPU_PROFILER)
+    Profiler::init();
+  #endif
+
   #if ENABLED(DISABLE_JTAG)
     // Disable JTAG on AT90USB chips to free up pins for IO
     MCUCR = 0x80;
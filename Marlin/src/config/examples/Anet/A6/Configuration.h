@@ -778,6 +778,27 @@
 // Use double touch for probing
 #define PROBE_DOUBLE_TOUCH
 
+// Probe a mesh on the fly: each point's height is predicted from its
+// neighbor, so the probe rises while traveling and skips the fast approach.
+// The time taken and saved is reported at the end of G29.
+//#define PROBE_ON_THE_FLY
+#if ENABLED(PROBE_ON_THE_FLY)
+  #define PROBE_PREDICT_MARGIN 1.0 // (mm) Probe slowly from this far above the predicted height
+#endif
+
+// Take more touches only where they are needed: keep probing each point
+// until its mean is known to within PROBE_SAMPLE_TOLERANCE, judged by the
+// spread of all the points probed so far. Outlying touches are discarded.
+// The standard error of each point is kept with the mesh.
+//#define PROBE_ADAPTIVE_SAMPLING
+#if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+  #define PROBE_SAMPLES_MIN        1 // Touches taken at every point
+  #define PROBE_SAMPLES_MAX        5 // Most touches at a noisy point (2-10)
+  #define PROBE_SAMPLE_TOLERANCE 0.01 // (mm) 95% confidence in the mean of each point
+  #define PROBE_OUTLIER_LIMIT    0.05 // (mm) Discard a touch this far from the median
+  #define PROBE_SAMPLE_LIFT       1.0 // (mm) Raise between touches at the same point
+#endif
+
 /**
  * Z probes require clearance when deploying, stowing, and moving between
  * probe points to avoid hitting the bed and other hardware.
@@ -1010,6 +1031,17 @@
   #define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
 
+  // Split leveled moves only where the mesh bends more than this distance.
+  // Segments then grow up to one mesh cell over flat parts of the bed. With
+  // SEGMENT_LEVELED_MOVES, LEVELED_SEGMENT_LENGTH becomes the shortest segment.
+  //#define LEVELED_SEGMENT_ERROR 0.005 // (mm)
+
+  // Interpolate the mesh as a smooth Catmull-Rom surface instead of flat
+  // bilinear facets, so a coarse mesh follows a warped bed more closely.
+  // For AUTO_BED_LEVELING_BILINEAR and AUTO_BED_LEVELING_UBL.
+  // Cartesians also need SEGMENT_LEVELED_MOVES.
+  //#define MESH_BICUBIC_INTERPOLATION
+
   /**
    * Enable the G26 Mesh Validation Pattern tool.
    */
@@ -1115,6 +1147,7 @@
 
   #define UBL_MESH_EDIT_MOVES_Z     // Sophisticated users prefer no movement of nozzle
   #define UBL_SAVE_ACTIVE_ON_M500   // Save the currently active mesh in the current slot on M500
+  //#define UBL_MESH_COMPRESSION    // Store meshes as a plane plus 16-bit micron offsets to fit more slots
 
 #elif ENABLED(MESH_BED_LEVELING)
 
@@ -105,6 +105,30 @@
     #define DEFAULT_Kc (100) //heating power=Kc*(e_speed)
     #define LPQ_MAX_LEN 50
   #endif
+
+  /**
+   * Model Predictive Control (experimental)
+   *
+   * Replace the hotend PID loop with a thermal model of the hotend: heater
+   * power, heat capacity of the block, heat lost to the surroundings, and
+   * heat carried off by the filament. The planner's upcoming extrusion is
+   * fed forward so the heater responds before the melt zone cools down.
+   *
+   * With this enabled, M303 on a hotend identifies the model instead of PID
+   * gains. Start it with the hotend cold, e.g. "M303 E0 S200 U1".
+   * M306 sets the model by hand, and M500 saves it.
+   */
+  //#define MPC_HOTEND
+  #if ENABLED(MPC_HOTEND)
+    #define MPC_HEATER_POWER                  40.0  // (W) Heater cartridge power
+    #define MPC_BLOCK_HEAT_CAPACITY           16.7  // (J/K) Heater block and nozzle. Found by M303.
+    #define MPC_SENSOR_RESPONSIVENESS         0.22  // (1/s) How fast the sensor follows the block. Found by M303.
+    #define MPC_AMBIENT_XFER_COEFF            0.068 // (W/K) Heat lost to the surroundings. Found by M303.
+    #define MPC_FILAMENT_HEAT_CAPACITY_PERMM  5.6e-3 // (J/K/mm) 1.75mm PLA: 5.6e-3, 2.85mm PLA: 1.49e-2
+    #define MPC_AMBIENT_TEMP                  25    // (C) Temperature of the surroundings. Measured by M303.
+    #define MPC_SMOOTHING_FACTOR              0.5   // (0.0-1.0) How strongly each reading corrects the model
+    #define MPC_LOOKAHEAD_MS                  1000  // (ms) Planned extrusion to feed forward
+  #endif
 #endif
 
 /**
@@ -129,6 +153,23 @@
 // Enable for M105 to include ADC values read from temperature sensors.
 //#define SHOW_TEMP_ADC_VALUES
 
+/**
+ * Continuous ADC Scan
+ *
+ * Let the ADC convert all temperature (and filament width) inputs in the
+ * background instead of starting one conversion per temperature interrupt.
+ * Every sensor is then sampled on every temperature interrupt, so readings
+ * arrive about 10x more often and the PID loop runs at a higher rate.
+ *
+ * Supported on LPC1768 (burst mode), Due (free-running mode) and
+ * STM32F1 (scan mode with circular DMA).
+ */
+//#define ADC_CONTINUOUS_SCAN
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+  #define ADC_SCAN_MEDIAN_FILTER      // Median-of-3 filter to reject single-sample spikes
+  #define ADC_SCAN_LOWPASS_K_VALUE 2  // IIR low-pass strength (0 = off, 1:8). Higher values smooth more but lag more.
+#endif
+
 /**
  * High Temperature Thermistor Support
  *
@@ -176,6 +217,37 @@
 #define TEMP_SENSOR_AD595_OFFSET 3.0
 #define TEMP_SENSOR_AD595_GAIN   2.0
 
+/**
+ * Hardware PWM for heaters and fans
+ *
+ * Drive the heaters (and any fans using FAN_SOFT_PWM) from hardware PWM
+ * channels instead of toggling them in the temperature interrupt. This
+ * lightens the temperature ISR and gives fans full 8-bit resolution.
+ * Outputs without a free hardware channel fall back to software PWM.
+ *
+ * Supported on LPC1768, Due and STM32F1. Not compatible with SLOW_PWM_HEATERS.
+ */
+//#define HARDWARE_PWM_HEATERS
+
+/**
+ * Heater Power Budget
+ *
+ * For a power supply that can't run every heater at full power at once.
+ * At the start of each PWM cycle the heaters that want power are switched
+ * on in turn, only as long as their combined rating fits the budget. The
+ * first heater served moves along each cycle so all of them get a share.
+ * The temperature loops make up for the cycles a heater has to sit out.
+ *
+ * Use M116 to bring all heaters up together instead of one by one.
+ * Not compatible with SLOW_PWM_HEATERS.
+ */
+//#define HEATER_POWER_BUDGET
+#if ENABLED(HEATER_POWER_BUDGET)
+  #define HEATER_BUDGET_WATTS   300                     // (W) Power the supply can spare for heaters
+  #define HOTEND_HEATER_WATTS   { 40, 40, 40, 40, 40 }  // (W) Rating of each hotend heater
+  #define BED_HEATER_WATTS      250                     // (W) Rating of the bed heater
+#endif
+
 /**
  * Controller Fan
  * To cool down the stepper drivers and MOSFETs.
@@ -628,6 +700,15 @@
   // The normal delay is 10µs. Use the lowest value that still gives a reliable display.
   //#define DOGM_SPI_DELAY_US 5
 
+  // Send only the rows of an ST7920 display that changed since the last frame.
+  // Costs 130 bytes of RAM. Saves most of the time spent updating the Info Screen.
+  //#define ST7920_DIRTY_ROWS
+
+  // Drive an ST7920 or ST7565 (64128N) display with the hardware SPI that
+  // the SD card uses. The display must be wired to the SPI bus, with its
+  // chip select on LCD_PINS_RS (ST7920) or DOGLCD_CS (ST7565).
+  //#define DOGM_HARDWARE_SPI
+
   // Swap the CW/CCW indicators in the graphics overlay
   //#define OVERLAY_GFX_REVERSE
 
@@ -751,6 +832,21 @@
 // Moves (or segments) with fewer steps than this will be joined with the next move
 #define MIN_STEPS_PER_SEGMENT 6
 
+/**
+ * Chord Error Segmentation (DELTA / SCARA)
+ *
+ * Split moves only where the kinematics need it. Each segment is made as
+ * long as it can be while staying within KINEMATIC_CHORD_ERROR of the straight
+ * Cartesian path and the bilinear leveling mesh, so moves near the center of
+ * a delta use far fewer segments. DELTA_SEGMENTS_PER_SECOND sets the longest
+ * segment. Segments are planned with their Cartesian length so the feedrate
+ * and acceleration apply to the effector, not the towers.
+ */
+//#define KINEMATIC_CHORD_SEGMENTS
+#if ENABLED(KINEMATIC_CHORD_SEGMENTS)
+  #define KINEMATIC_CHORD_ERROR 0.01 // (mm) Allowed deviation from the straight path
+#endif
+
 // The minimum pulse width (in µs) for stepping a stepper.
 // Set this if you find stepping unreliable, or if using a very fast CPU.
 #define MINIMUM_STEPPER_PULSE 0 // (µs) The smallest stepper pulse allowed
@@ -1325,6 +1421,36 @@
  */
 //#define PINS_DEBUGGING
 
+/**
+ * M930 - Record the step pulses the stepper ISR emits, for offline analysis
+ *
+ * Each step event is kept with its stepper timer time, the axes that stepped
+ * and their directions, along with the trapezoid of each block started.
+ *
+ *  M930 S1 : Record continuously, keeping the latest events
+ *  M930 S2 : Record until the buffer is full
+ *  M930 S0 : Stop recording
+ *  M930 D  : Stop and dump the trace over serial
+ *  M930 W  : Stop and write the trace to STEPTRC.TXT on the SD card
+ *
+ * Analyze a dump with buildroot/share/scripts/step_trace.py
+ */
+//#define STEP_TRACE
+#if ENABLED(STEP_TRACE)
+  #define STEP_TRACE_SIZE   256   // Step events to keep (power of 2), 6-8 bytes each
+  #define STEP_TRACE_BLOCKS   8   // Block trapezoids to keep (power of 2), 48 bytes each
+#endif
+
+/**
+ * M931 - Profile the stepper and temperature ISRs, the planner and the
+ * main loop's heater, LCD and command reading tasks
+ *
+ * Reports the calls, min / avg / max time per call and CPU share of each
+ * since the last reset. M931 R resets the counters.
+ * Timed with the DWT cycle counter on ARM and micros() on AVR.
+ */
+//#define CPU_PROFILER
+
 /**
  * Auto-report temperatures with M155 S<seconds>
  */
@@ -194,6 +194,11 @@
 #define BOARD_TEENSY35_36       841   // Teensy3.5 and Teensy3.6
 #define BOARD_STM32F1R         1800   // STM3R Libmaple based STM32F1 controller
 
+//
+// Simulations - Linux
+//
+#define BOARD_LINUX_RAMPS      9999   // RAMPS 1.4 simulated on a Linux host (Power outputs: Hotend, Fan, Bed)
+
 #define MB(board) (MOTHERBOARD==BOARD_##board)
 
 #endif // __BOARDS_H
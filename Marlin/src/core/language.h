@@ -237,6 +237,14 @@
 #define MSG_T                               "T:"
 #define MSG_AT                              " @:"
 #define MSG_PID_AUTOTUNE_FINISHED           MSG_PID_AUTOTUNE " finished! Put the last Kp, Ki and Kd constants from below into Configuration.h"
+#define MSG_MPC_AUTOTUNE                    "MPC Autotune"
+#define MSG_MPC_AUTOTUNE_START              MSG_MPC_AUTOTUNE " start"
+#define MSG_MPC_AUTOTUNE_FAILED             MSG_MPC_AUTOTUNE " failed!"
+#define MSG_MPC_COOLING                     "Waiting for the hotend to settle at ambient"
+#define MSG_MPC_HEATING                     "Heating at full power"
+#define MSG_MPC_MEASURING                   "Measuring heat loss at target"
+#define MSG_MPC_BAD_FIT                     MSG_MPC_AUTOTUNE_FAILED " Heating curve could not be fitted"
+#define MSG_MPC_AUTOTUNE_FINISHED           MSG_MPC_AUTOTUNE " finished! Put the constants from below into Configuration_adv.h"
 #define MSG_PID_DEBUG                       " PID_DEBUG "
 #define MSG_PID_DEBUG_INPUT                 ": Input "
 #define MSG_PID_DEBUG_OUTPUT                " Output "
@@ -32,6 +32,10 @@ int bilinear_grid_spacing[2], bilinear_start[2];
 float bilinear_grid_factor[2],
       z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
+#if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+  float z_std_error[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+#endif
+
 /**
  * Extrapolate a single point from its neighbors
  */
@@ -138,6 +142,17 @@ void print_bilinear_leveling_grid() {
   );
 }
 
+#if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+
+  void print_bilinear_std_error_grid() {
+    SERIAL_ECHOLNPGM("Probe Standard Error:");
+    print_2d_array(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, 4,
+      [](const uint8_t ix, const uint8_t iy) { return z_std_error[ix][iy]; }
+    );
+  }
+
+#endif
+
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
 
   #define ABL_GRID_POINTS_VIRT_X (GRID_MAX_POINTS_X - 1) * (BILINEAR_SUBDIVISIONS) + 1
@@ -261,6 +276,15 @@ void refresh_bed_level() {
 // Get the Z adjustment for non-linear bed leveling
 float bilinear_z_offset(const float raw[XYZ]) {
 
+  #if ENABLED(MESH_BICUBIC_INTERPOLATION)
+    // Position in grid units, holding the height at the edges of the grid
+    const float gx = constrain((raw[X_AXIS] - bilinear_start[X_AXIS]) * bilinear_grid_factor[X_AXIS], 0, GRID_MAX_POINTS_X - 1),
+                gy = constrain((raw[Y_AXIS] - bilinear_start[Y_AXIS]) * bilinear_grid_factor[Y_AXIS], 0, GRID_MAX_POINTS_Y - 1);
+    const int8_t cx = min(int8_t(gx), GRID_MAX_POINTS_X - 2),
+                 cy = min(int8_t(gy), GRID_MAX_POINTS_Y - 2);
+    return bicubic_z(z_values, cx, cy, gx - cx, gy - cy);
+  #endif
+
   static float z1, d2, z3, d4, L, D, ratio_x, ratio_y,
                last_x = -999.999, last_y = -999.999;
 
@@ -378,7 +402,14 @@ float bilinear_z_offset(const float raw[XYZ]) {
 
     // Start and end in the same cell? No split needed.
     if (cx1 == cx2 && cy1 == cy2) {
-      buffer_line_to_destination(fr_mm_s);
+      #if ENABLED(ADAPTIVE_LEVELED_SEGMENTS)
+        cell_line_to_destination(fr_mm_s,
+          ABL_BG_GRID(cx1, cy1) - ABL_BG_GRID(cx1 + 1, cy1) - ABL_BG_GRID(cx1, cy1 + 1) + ABL_BG_GRID(cx1 + 1, cy1 + 1),
+          ABL_BG_SPACING(X_AXIS), ABL_BG_SPACING(Y_AXIS)
+        );
+      #else
+        buffer_line_to_destination(fr_mm_s);
+      #endif
       set_current_from_destination();
       return;
     }
@@ -36,6 +36,10 @@
 
   void extrapolate_unprobed_bed_level();
   void print_bilinear_leveling_grid();
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+    extern float z_std_error[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+    void print_bilinear_std_error_grid();
+  #endif
   void refresh_bed_level();
   #if ENABLED(ABL_BILINEAR_SUBDIVISION)
     void print_bilinear_leveling_grid_virt();
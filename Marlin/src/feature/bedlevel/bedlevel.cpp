@@ -281,6 +281,136 @@ void reset_bed_level() {
 
 #endif
 
+#if ENABLED(MESH_BICUBIC_INTERPOLATION)
+
+  /**
+   * Catmull-Rom weights of the mesh lines before, at the start, at the end,
+   * and after the cell for a point 't' of the way across. A cell on the edge
+   * of the mesh takes the missing outer line as a straight extension of the
+   * two inner ones, so its weight is folded into theirs.
+   */
+  static void catmull_rom_weights(float w[4], const float &t, const int8_t cell, const int8_t last_cell) {
+    const float t2 = sq(t), t3 = t2 * t;
+    w[0] = (2 * t2 - t - t3) * 0.5;
+    w[1] = (2 - 5 * t2 + 3 * t3) * 0.5;
+    w[2] = (t + 4 * t2 - 3 * t3) * 0.5;
+    w[3] = (t3 - t2) * 0.5;
+    if (cell == 0) {
+      w[1] += 2 * w[0];
+      w[2] -= w[0];
+      w[0] = 0;
+    }
+    if (cell == last_cell) {
+      w[2] += 2 * w[3];
+      w[1] -= w[3];
+      w[3] = 0;
+    }
+  }
+
+  // A mesh point, guessing zero for one that was never probed. One NaN would spoil the whole cell.
+  FORCE_INLINE static float mesh_point(const mesh_z_t &z, const int8_t x, const int8_t y) {
+    const float v = z[x][y];
+    return isnan(v) ? 0 : v;
+  }
+
+  // Interpolate one row of the mesh in X using the given weights
+  static float mesh_row(const mesh_z_t &z, const int8_t cx, const int8_t y, const float wx[4]) {
+    float sum = 0;
+    for (int8_t i = 0; i < 4; i++) {
+      const int8_t x = cx - 1 + i;
+      if (wx[i] && WITHIN(x, 0, GRID_MAX_POINTS_X - 1)) sum += wx[i] * mesh_point(z, x, y);
+    }
+    return sum;
+  }
+
+  float bicubic_z(const mesh_z_t &z, const int8_t cx, const int8_t cy, const float &tx, const float &ty) {
+    float wx[4], wy[4];
+    catmull_rom_weights(wx, constrain(tx, 0, 1), cx, GRID_MAX_POINTS_X - 2);
+    catmull_rom_weights(wy, constrain(ty, 0, 1), cy, GRID_MAX_POINTS_Y - 2);
+    float sum = 0;
+    for (int8_t j = 0; j < 4; j++) {
+      const int8_t y = cy - 1 + j;
+      if (wy[j] && WITHIN(y, 0, GRID_MAX_POINTS_Y - 1)) sum += wy[j] * mesh_row(z, cx, y, wx);
+    }
+    return sum;
+  }
+
+  // The Catmull-Rom weight polynomials, lowest power of t first
+  static const float catmull_rom_poly[4][4] PROGMEM = {
+    { 0, -0.5,  1.0, -0.5 },
+    { 1,  0.0, -2.5,  1.5 },
+    { 0,  0.5,  2.0, -1.5 },
+    { 0,  0.0, -0.5,  0.5 }
+  };
+
+  /**
+   * The weights for the points t, t + h, t + 2h... as forward differences. Each
+   * w[i] gets the weight at 't' and its 1st..3rd differences. These come from the
+   * polynomials, since differencing sampled weights loses too much precision.
+   */
+  static void catmull_rom_differences(float w[4][4], const float &t, const float &h, const int8_t cell, const int8_t last_cell) {
+    for (uint8_t i = 0; i < 4; i++) {
+      const float c0 = pgm_read_float(&catmull_rom_poly[i][0]),
+                  c1 = pgm_read_float(&catmull_rom_poly[i][1]),
+                  c2 = pgm_read_float(&catmull_rom_poly[i][2]),
+                  c3 = pgm_read_float(&catmull_rom_poly[i][3]),
+                  k1 = h * (c1 + t * (2 * c2 + 3 * c3 * t)), // Terms of the cubic in steps of 'h'
+                  k2 = sq(h) * (c2 + 3 * c3 * t),
+                  k3 = sq(h) * h * c3;
+      w[i][0] = c0 + t * (c1 + t * (c2 + t * c3));
+      w[i][1] = k1 + k2 + k3;
+      w[i][2] = 2 * k2 + 6 * k3;
+      w[i][3] = 6 * k3;
+    }
+    for (uint8_t k = 0; k < 4; k++) {
+      if (cell == 0) {
+        w[1][k] += 2 * w[0][k];
+        w[2][k] -= w[0][k];
+        w[0][k] = 0;
+      }
+      if (cell == last_cell) {
+        w[2][k] += 2 * w[3][k];
+        w[1][k] -= w[3][k];
+        w[3][k] = 0;
+      }
+    }
+  }
+
+  bool bicubic_walk_start(bicubic_walk_t &walk, const mesh_z_t &z, const int8_t cx, const int8_t cy, const float &tx, const float &ty, const float &dtx, const float &dty) {
+    float wx[4][4];
+    catmull_rom_differences(wx, constrain(tx, 0, 1), dtx, cx, GRID_MAX_POINTS_X - 2);
+    catmull_rom_differences(walk.weight, constrain(ty, 0, 1), dty, cy, GRID_MAX_POINTS_Y - 2);
+
+    // Each row is a weighted sum, and so are its differences
+    for (int8_t j = 0; j < 4; j++) {
+      const int8_t y = cy - 1 + j;
+      for (uint8_t k = 0; k < 4; k++) {
+        float sum = 0;
+        if (WITHIN(y, 0, GRID_MAX_POINTS_Y - 1))
+          for (int8_t i = 0; i < 4; i++) {
+            const int8_t x = cx - 1 + i;
+            if (WITHIN(x, 0, GRID_MAX_POINTS_X - 1)) sum += wx[i][k] * mesh_point(z, x, y);
+          }
+        walk.row[j][k] = sum;
+      }
+    }
+
+    return WITHIN(tx, 0, 1) && WITHIN(ty, 0, 1);
+  }
+
+  float bicubic_walk_next(bicubic_walk_t &walk) {
+    float sum = 0;
+    for (uint8_t j = 0; j < 4; j++) {
+      float * const r = walk.row[j], * const w = walk.weight[j];
+      sum += r[0] * w[0];
+      r[0] += r[1]; r[1] += r[2]; r[2] += r[3];
+      w[0] += w[1]; w[1] += w[2]; w[2] += w[3];
+    }
+    return sum;
+  }
+
+#endif // MESH_BICUBIC_INTERPOLATION
+
 #if HAS_PROBING_PROCEDURE
   void out_of_range_error(const char* p_edge) {
     SERIAL_PROTOCOLPGM("?Probe ");
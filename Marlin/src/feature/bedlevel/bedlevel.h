@@ -71,6 +71,40 @@ void reset_bed_level();
   void out_of_range_error(const char* p_edge);
 #endif
 
+#if ENABLED(MESH_BICUBIC_INTERPOLATION)
+
+  /**
+   * Catmull-Rom interpolation of a mesh. The surface passes through every
+   * mesh point, with a smooth slope across the cell borders. Past the edge
+   * of the mesh the height at the edge is held. Points that were never
+   * probed (NaN) are taken as zero.
+   */
+  typedef float mesh_z_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+
+  // The height at 'tx', 'ty' (0..1, held outside) of the way across mesh cell (cx, cy)
+  float bicubic_z(const mesh_z_t &z, const int8_t cx, const int8_t cy, const float &tx, const float &ty);
+
+  /**
+   * Heights at evenly spaced points along a line within one mesh cell.
+   *
+   * Along a line the mesh rows and the Y weights are cubics, so each is
+   * advanced by forward differences. After setup every point costs 24
+   * additions and 4 multiplications instead of a full bicubic_z().
+   */
+  typedef struct {
+    float row[4][4],    // Each row interpolated in X, and its 1st..3rd differences
+          weight[4][4]; // Each Y weight, and its 1st..3rd differences
+  } bicubic_walk_t;
+
+  // Start at 'tx', 'ty' in cell (cx, cy), stepping by 'dtx', 'dty'. Return false
+  // if the start is outside the cell: it is held at the edge, and only good for one step.
+  bool bicubic_walk_start(bicubic_walk_t &walk, const mesh_z_t &z, const int8_t cx, const int8_t cy, const float &tx, const float &ty, const float &dtx, const float &dty);
+
+  // Return the height at the current point and step to the next one
+  float bicubic_walk_next(bicubic_walk_t &walk);
+
+#endif
+
 #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
   #define _GET_MESH_X(I) (bilinear_start[X_AXIS] + (I) * bilinear_grid_spacing[X_AXIS])
   #define _GET_MESH_Y(J) (bilinear_start[Y_AXIS] + (J) * bilinear_grid_spacing[Y_AXIS])
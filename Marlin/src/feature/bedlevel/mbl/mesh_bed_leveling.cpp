@@ -71,7 +71,14 @@
 
       // Start and end in the same cell? No split needed.
       if (cx1 == cx2 && cy1 == cy2) {
-        buffer_line_to_destination(fr_mm_s);
+        #if ENABLED(ADAPTIVE_LEVELED_SEGMENTS)
+          cell_line_to_destination(fr_mm_s,
+            mbl.z_values[cx1][cy1] - mbl.z_values[cx1 + 1][cy1] - mbl.z_values[cx1][cy1 + 1] + mbl.z_values[cx1 + 1][cy1 + 1],
+            MESH_X_DIST, MESH_Y_DIST
+          );
+        #else
+          buffer_line_to_destination(fr_mm_s);
+        #endif
         set_current_from_destination();
         return;
       }
@@ -173,22 +173,32 @@ class unified_bed_leveling {
     }
 
     /**
-     *                           z2   --|
-     *                 z0        |      |
-     *                  |        |      + (z2-z1)
-     *   z1             |        |      |
-     * ---+-------------+--------+--  --|
-     *   a1            a0        a2
-     *    |<---delta_a---------->|
+     *   z01 +-----------+ z11
+     *       |           |
+     *       |     * z   |  yratio
+     *       |           |
+     *   z00 +-----------+ z10
+     *          xratio
      *
-     *  calc_z0 is the basis for all the Mesh Based correction. It is used to
-     *  find the expected Z Height at a position between two known Z-Height locations.
+     *  cell_z is the basis for all the Mesh Based correction. It finds the Z height
+     *  at a position within the mesh cell (cx, cy), given as the fraction of the way
+     *  across the cell in X and Y.
      *
-     *  It is fairly expensive with its 4 floating point additions and 2 floating point
-     *  multiplications.
+     *  The bilinear surface is z00 + b*x + c*y + d*x*y, so this takes 3 floating
+     *  point multiplications and no divisions. The coefficients are just differences
+     *  of the corner heights, so they aren't worth keeping in RAM for every cell.
+     *
+     *  With MESH_BICUBIC_INTERPOLATION the neighboring cells shape a smooth surface.
      */
-    FORCE_INLINE static float calc_z0(const float &a0, const float &a1, const float &z1, const float &a2, const float &z2) {
-      return z1 + (z2 - z1) * (a0 - a1) / (a2 - a1);
+    FORCE_INLINE static float cell_z(const int8_t cx, const int8_t cy, const float &xratio, const float &yratio) {
+      #if ENABLED(MESH_BICUBIC_INTERPOLATION)
+        return bicubic_z(z_values, cx, cy, xratio, yratio);
+      #endif
+      const float z00 = z_values[cx][cy],
+                  b = z_values[cx + 1][cy] - z00,
+                  c = z_values[cx][cy + 1] - z00,
+                  d = z_values[cx + 1][cy + 1] - z_values[cx][cy + 1] - b;
+      return z00 + xratio * b + yratio * (c + xratio * d);
     }
 
     /**
@@ -241,10 +251,9 @@ class unified_bed_leveling {
     }
 
     /**
-     * This is the generic Z-Correction. It works anywhere within a Mesh Cell. It first
-     * does a linear interpolation along both of the bounding X-Mesh-Lines to find the
-     * Z-Height at both ends. Then it does a linear interpolation of these heights based
-     * on the Y position within the cell.
+     * This is the generic Z-Correction. It works anywhere within a Mesh Cell. It finds
+     * the cell and the fractional position within it, then evaluates the cell's bilinear
+     * surface with cell_z().
      */
     static float get_z_correction(const float &rx0, const float &ry0) {
       const int8_t cx = get_cell_index_x(rx0),
@@ -264,17 +273,9 @@ class unified_bed_leveling {
         return NAN;
       }
 
-      const float z1 = calc_z0(rx0,
-                               mesh_index_to_xpos(cx), z_values[cx][cy],
-                               mesh_index_to_xpos(cx + 1), z_values[cx + 1][cy]);
-
-      const float z2 = calc_z0(rx0,
-                               mesh_index_to_xpos(cx), z_values[cx][cy + 1],
-                               mesh_index_to_xpos(cx + 1), z_values[cx + 1][cy + 1]);
-
-      float z0 = calc_z0(ry0,
-                         mesh_index_to_ypos(cy), z1,
-                         mesh_index_to_ypos(cy + 1), z2);
+      float z0 = cell_z(cx, cy,
+                        (rx0 - mesh_index_to_xpos(cx)) * (1.0 / (MESH_X_DIST)),
+                        (ry0 - mesh_index_to_ypos(cy)) * (1.0 / (MESH_Y_DIST)));
 
       #if ENABLED(DEBUG_LEVELING_FEATURE)
         if (DEBUGGING(MESH_ADJUST)) {
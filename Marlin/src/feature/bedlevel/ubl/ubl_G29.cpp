@@ -746,6 +746,23 @@
 
       uint16_t max_iterations = GRID_MAX_POINTS;
 
+      #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+        reset_probe_statistics();
+        float worst_error = 0;
+        int8_t worst_x_index = -1, worst_y_index = -1;
+      #endif
+
+      #if ENABLED(PROBE_ON_THE_FLY)
+        // Walk to the nearest unprobed point each time, and predict its
+        // height from the point just probed when the two are neighbors.
+        float near_x = rx, near_y = ry, predicted_z = NAN;
+        int8_t last_x_index = -1, last_y_index = -1;
+        const millis_t probe_start_ms = millis();
+        probe_touches_saved = 0;
+      #else
+        const float &near_x = rx, &near_y = ry;
+      #endif
+
       do {
         if (do_ubl_mesh_map) display_map(g29_map_type);
 
@@ -765,18 +782,58 @@
         if (close_or_far)
           location = find_furthest_invalid_mesh_point();
         else
-          location = find_closest_mesh_point_of_type(INVALID, rx, ry, USE_PROBE_AS_REFERENCE, NULL);
+          location = find_closest_mesh_point_of_type(INVALID, near_x, near_y, USE_PROBE_AS_REFERENCE, NULL);
 
         if (location.x_index >= 0) {    // mesh point found and is reachable by probe
           const float rawx = mesh_index_to_xpos(location.x_index),
                       rawy = mesh_index_to_ypos(location.y_index);
 
-          const float measured_z = probe_pt(rawx, rawy, stow_probe, g29_verbose_level); // TODO: Needs error handling
+          #if ENABLED(PROBE_ON_THE_FLY)
+            const bool neighbor = !stow_probe
+              && abs(location.x_index - last_x_index) <= 1
+              && abs(location.y_index - last_y_index) <= 1;
+          #endif
+
+          const float measured_z = probe_pt(rawx, rawy, stow_probe, g29_verbose_level, true // TODO: Needs error handling
+            #if ENABLED(PROBE_ON_THE_FLY)
+              , neighbor ? predicted_z : NAN
+            #endif
+          );
           z_values[location.x_index][location.y_index] = measured_z;
+
+          #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+            if (probe_std_error > worst_error) {
+              worst_error = probe_std_error;
+              worst_x_index = location.x_index;
+              worst_y_index = location.y_index;
+            }
+          #endif
+
+          #if ENABLED(PROBE_ON_THE_FLY)
+            near_x = rawx + (X_PROBE_OFFSET_FROM_EXTRUDER); // Search from the probe's position
+            near_y = rawy + (Y_PROBE_OFFSET_FROM_EXTRUDER);
+            predicted_z = measured_z;
+            last_x_index = location.x_index;
+            last_y_index = location.y_index;
+          #endif
         }
 
       } while (location.x_index >= 0 && --max_iterations);
 
+      #if ENABLED(PROBE_ON_THE_FLY)
+        finish_probe_raise();
+        report_probing_time(probe_start_ms);
+      #endif
+
+      #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+        if (worst_x_index >= 0) {
+          SERIAL_PROTOCOLPAIR("Worst probe std error: ", worst_error);
+          SERIAL_PROTOCOLPAIR(" at (", worst_x_index);
+          SERIAL_PROTOCOLPAIR(",", worst_y_index);
+          SERIAL_PROTOCOLLNPGM(")");
+        }
+      #endif
+
       STOW_PROBE();
       restore_ubl_active_state_and_leave();
 
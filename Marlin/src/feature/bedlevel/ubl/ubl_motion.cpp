@@ -151,28 +151,16 @@
       FINAL_MOVE:
 
       /**
-       * Optimize some floating point operations here. We could call float get_z_correction(float x0, float y0) to
-       * generate the correction for us. But we can lighten the load on the CPU by doing a modified version of the function.
-       * We are going to only calculate the amount we are from the first mesh line towards the second mesh line once.
-       * We will use this fraction in both of the original two Z Height calculations for the bi-linear interpolation. And,
-       * instead of doing a generic divide of the distance, we know the distance is MESH_X_DIST so we can use the preprocessor
-       * to create a 1-over number for us. That will allow us to do a floating point multiply instead of a floating point divide.
+       * The destination cell is already known, so skip the lookup in get_z_correction()
+       * and evaluate the cell's bilinear surface directly. The ratios use the preprocessor
+       * to create a 1-over number, so there's a multiply instead of a floating point divide.
        */
-
-      const float xratio = (end[X_AXIS] - mesh_index_to_xpos(cell_dest_xi)) * (1.0 / (MESH_X_DIST));
-
-      float z1 = z_values[cell_dest_xi    ][cell_dest_yi    ] + xratio *
-                (z_values[cell_dest_xi + 1][cell_dest_yi    ] - z_values[cell_dest_xi][cell_dest_yi    ]),
-            z2 = z_values[cell_dest_xi    ][cell_dest_yi + 1] + xratio *
-                (z_values[cell_dest_xi + 1][cell_dest_yi + 1] - z_values[cell_dest_xi][cell_dest_yi + 1]);
-
-      if (cell_dest_xi >= GRID_MAX_POINTS_X - 1) z1 = z2 = 0.0;
-
-      // we are done with the fractional X distance into the cell. Now with the two Z-Heights we have calculated, we
-      // are going to apply the Y-Distance into the cell to interpolate the final Z correction.
-
-      const float yratio = (end[Y_AXIS] - mesh_index_to_ypos(cell_dest_yi)) * (1.0 / (MESH_Y_DIST));
-      float z0 = cell_dest_yi < GRID_MAX_POINTS_Y - 1 ? (z1 + (z2 - z1) * yratio) * planner.fade_scaling_factor_for_z(end[Z_AXIS]) : 0.0;
+      float z0 = 0.0;
+      if (cell_dest_xi < GRID_MAX_POINTS_X - 1 && cell_dest_yi < GRID_MAX_POINTS_Y - 1)
+        z0 = cell_z(cell_dest_xi, cell_dest_yi,
+                    (end[X_AXIS] - mesh_index_to_xpos(cell_dest_xi)) * (1.0 / (MESH_X_DIST)),
+                    (end[Y_AXIS] - mesh_index_to_ypos(cell_dest_yi)) * (1.0 / (MESH_Y_DIST))
+             ) * planner.fade_scaling_factor_for_z(end[Z_AXIS]);
 
       /**
        * If part of the Mesh is undefined, it will show up as NAN
@@ -592,62 +580,80 @@
 
         // Compute mesh cell invariants that remain constant for all segments within cell.
         // Note for cell index, if point is outside the mesh grid (in MESH_INSET perimeter)
-        // the bilinear interpolation from the adjacent cell within the mesh will still work.
+        // the interpolation from the adjacent cell within the mesh will still work.
         // Inner loop will exit each time (because out of cell bounds) but will come back
         // in top of loop and again re-find same adjacent cell and use it, just less efficient
-        // for mesh inset area.
+        // for mesh inset area. The edge cells are the last whole cells, so the corners
+        // never index past the mesh.
 
         int8_t cell_xi = (raw[X_AXIS] - (MESH_MIN_X)) * (1.0 / (MESH_X_DIST)),
-               cell_yi = (raw[Y_AXIS] - (MESH_MIN_Y)) * (1.0 / (MESH_X_DIST));
+               cell_yi = (raw[Y_AXIS] - (MESH_MIN_Y)) * (1.0 / (MESH_Y_DIST));
 
-        cell_xi = constrain(cell_xi, 0, (GRID_MAX_POINTS_X) - 1);
-        cell_yi = constrain(cell_yi, 0, (GRID_MAX_POINTS_Y) - 1);
+        cell_xi = constrain(cell_xi, 0, (GRID_MAX_POINTS_X) - 2);
+        cell_yi = constrain(cell_yi, 0, (GRID_MAX_POINTS_Y) - 2);
 
         const float x0 = mesh_index_to_xpos(cell_xi),   // 64 byte table lookup avoids mul+add
                     y0 = mesh_index_to_ypos(cell_yi);
 
-        float z_x0y0 = z_values[cell_xi  ][cell_yi  ],  // z at lower left corner
-              z_x1y0 = z_values[cell_xi+1][cell_yi  ],  // z at upper left corner
-              z_x0y1 = z_values[cell_xi  ][cell_yi+1],  // z at lower right corner
-              z_x1y1 = z_values[cell_xi+1][cell_yi+1];  // z at upper right corner
-
-        if (isnan(z_x0y0)) z_x0y0 = 0;              // ideally activating planner.leveling_active (G29 A)
-        if (isnan(z_x1y0)) z_x1y0 = 0;              //   should refuse if any invalid mesh points
-        if (isnan(z_x0y1)) z_x0y1 = 0;              //   in order to avoid isnan tests per cell,
-        if (isnan(z_x1y1)) z_x1y1 = 0;              //   thus guessing zero for undefined points
-
         float cx = raw[X_AXIS] - x0,   // cell-relative x and y
               cy = raw[Y_AXIS] - y0;
 
-        const float z_xmy0 = (z_x1y0 - z_x0y0) * (1.0 / (MESH_X_DIST)),   // z slope per x along y0 (lower left to lower right)
-                    z_xmy1 = (z_x1y1 - z_x0y1) * (1.0 / (MESH_X_DIST));   // z slope per x along y1 (upper left to upper right)
+        #if ENABLED(MESH_BICUBIC_INTERPOLATION)
 
-              float z_cxy0 = z_x0y0 + z_xmy0 * cx;            // z height along y0 at cx (changes for each cx in cell)
+          // Walk the segments through the cell's smooth surface. In the mesh inset
+          // the height at the edge is held, so find it again for every segment.
+          bicubic_walk_t walk;
+          const bool walk_on = bicubic_walk_start(walk, z_values, cell_xi, cell_yi,
+            cx * (1.0 / (MESH_X_DIST)), cy * (1.0 / (MESH_Y_DIST)),
+            diff[X_AXIS] * (1.0 / (MESH_X_DIST)), diff[Y_AXIS] * (1.0 / (MESH_Y_DIST))
+          );
 
-        const float z_cxy1 = z_x0y1 + z_xmy1 * cx,            // z height along y1 at cx
-                    z_cxyd = z_cxy1 - z_cxy0;                 // z height difference along cx from y0 to y1
+        #else
 
-              float z_cxym = z_cxyd * (1.0 / (MESH_Y_DIST));  // z slope per y along cx from y0 to y1 (changes for each cx in cell)
+          float z_x0y0 = z_values[cell_xi  ][cell_yi  ],  // z at lower left corner
+                z_x1y0 = z_values[cell_xi+1][cell_yi  ],  // z at upper left corner
+                z_x0y1 = z_values[cell_xi  ][cell_yi+1],  // z at lower right corner
+                z_x1y1 = z_values[cell_xi+1][cell_yi+1];  // z at upper right corner
 
-        //    float z_cxcy = z_cxy0 + z_cxym * cy;            // interpolated mesh z height along cx at cy (do inside the segment loop)
+          if (isnan(z_x0y0)) z_x0y0 = 0;              // ideally activating planner.leveling_active (G29 A)
+          if (isnan(z_x1y0)) z_x1y0 = 0;              //   should refuse if any invalid mesh points
+          if (isnan(z_x0y1)) z_x0y1 = 0;              //   in order to avoid isnan tests per cell,
+          if (isnan(z_x1y1)) z_x1y1 = 0;              //   thus guessing zero for undefined points
 
-        // As subsequent segments step through this cell, the z_cxy0 intercept will change
-        // and the z_cxym slope will change, both as a function of cx within the cell, and
-        // each change by a constant for fixed segment lengths.
+          const float z_xmy0 = (z_x1y0 - z_x0y0) * (1.0 / (MESH_X_DIST)),   // z slope per x along y0 (lower left to lower right)
+                      z_xmy1 = (z_x1y1 - z_x0y1) * (1.0 / (MESH_X_DIST));   // z slope per x along y1 (upper left to upper right)
 
-        const float z_sxy0 = z_xmy0 * diff[X_AXIS],                                     // per-segment adjustment to z_cxy0
-                    z_sxym = (z_xmy1 - z_xmy0) * (1.0 / (MESH_Y_DIST)) * diff[X_AXIS];  // per-segment adjustment to z_cxym
+                float z_cxy0 = z_x0y0 + z_xmy0 * cx;            // z height along y0 at cx (changes for each cx in cell)
+
+          const float z_cxy1 = z_x0y1 + z_xmy1 * cx,            // z height along y1 at cx
+                      z_cxyd = z_cxy1 - z_cxy0;                 // z height difference along cx from y0 to y1
+
+                float z_cxym = z_cxyd * (1.0 / (MESH_Y_DIST));  // z slope per y along cx from y0 to y1 (changes for each cx in cell)
+
+          //    float z_cxcy = z_cxy0 + z_cxym * cy;            // interpolated mesh z height along cx at cy (do inside the segment loop)
+
+          // As subsequent segments step through this cell, the z_cxy0 intercept will change
+          // and the z_cxym slope will change, both as a function of cx within the cell, and
+          // each change by a constant for fixed segment lengths.
+
+          const float z_sxy0 = z_xmy0 * diff[X_AXIS],                                     // per-segment adjustment to z_cxy0
+                      z_sxym = (z_xmy1 - z_xmy0) * (1.0 / (MESH_Y_DIST)) * diff[X_AXIS];  // per-segment adjustment to z_cxym
+
+        #endif
 
         for(;;) {  // for all segments within this mesh cell
 
           if (--segments == 0)                      // if this is last segment, use rtarget for exact
-            COPY(raw, rtarget);
+            LOOP_XYZE(i) raw[i] = rtarget[i];       // (COPY can't size a parameter)
 
-          const float z_cxcy = (z_cxy0 + z_cxym * cy) // interpolated mesh z height along cx at cy
-            #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
-              * fade_scaling_factor                   // apply fade factor to interpolated mesh height
-            #endif
-          ;
+          #if ENABLED(MESH_BICUBIC_INTERPOLATION)
+            float z_cxcy = bicubic_walk_next(walk);   // mesh z height at this segment, stepping to the next
+          #else
+            float z_cxcy = z_cxy0 + z_cxym * cy;      // interpolated mesh z height along cx at cy
+          #endif
+          #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
+            z_cxcy *= fade_scaling_factor;            // apply fade factor to interpolated mesh height
+          #endif
 
           const float z = raw[Z_AXIS];
           raw[Z_AXIS] += z_cxcy;
@@ -665,11 +671,17 @@
           if (!WITHIN(cx, 0, MESH_X_DIST) || !WITHIN(cy, 0, MESH_Y_DIST))    // done within this cell, break to next
             break;
 
-          // Next segment still within same mesh cell, adjust the per-segment
-          // slope and intercept to compute next z height.
+          #if ENABLED(MESH_BICUBIC_INTERPOLATION)
+            if (!walk_on) break;                    // started in the inset, so start again
+          #endif
+
+          #if DISABLED(MESH_BICUBIC_INTERPOLATION)
+            // Next segment still within same mesh cell, adjust the per-segment
+            // slope and intercept to compute next z height.
 
-          z_cxy0 += z_sxy0;   // adjust z_cxy0 by per-segment z_sxy0
-          z_cxym += z_sxym;   // adjust z_cxym by per-segment z_sxym
+            z_cxy0 += z_sxy0;   // adjust z_cxy0 by per-segment z_sxy0
+            z_cxym += z_sxym;   // adjust z_cxym by per-segment z_sxym
+          #endif
 
         } // segment loop
       } // cell loop
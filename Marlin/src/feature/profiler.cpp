@@ -0,0 +1,97 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * profiler.cpp - Time the stepper and temperature ISRs, the planner and the main tasks
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(CPU_PROFILER)
+
+#include "profiler.h"
+
+profile_stats_t Profiler::stats[PROFILE_REGIONS];
+millis_t Profiler::reset_ms;
+
+void Profiler::init() {
+  #if !defined(__AVR__) && !defined(__PLAT_LINUX__)
+    PROFILER_DEMCR |= _BV(24);      // TRCENA: enable the DWT
+    PROFILER_DWT_CTRL |= _BV(0);    // CYCCNTENA: start the cycle counter
+  #endif
+  reset();
+}
+
+void Profiler::reset() {
+  CRITICAL_SECTION_START;
+  for (uint8_t r = 0; r < PROFILE_REGIONS; r++) {
+    stats[r].count = stats[r].max = 0;
+    stats[r].min = 0xFFFFFFFF;
+    stats[r].total = 0;
+  }
+  CRITICAL_SECTION_END;
+  reset_ms = ms();
+}
+
+static const char* region_name(const uint8_t r) {
+  switch (r) {
+    case PROFILE_STEPPER_ISR:   return PSTR("Stepper ISR");
+    case PROFILE_ADVANCE_ISR:   return PSTR("Advance ISR");
+    case PROFILE_TEMP_ISR:      return PSTR("Temperature ISR");
+    case PROFILE_MANAGE_HEATER: return PSTR("manage_heater");
+    case PROFILE_LCD_UPDATE:    return PSTR("lcd_update");
+    case PROFILE_GET_COMMANDS:  return PSTR("get_available_commands");
+    default:                    return PSTR("Planner");
+  }
+}
+
+/**
+ * One line per region that ran: calls, min / avg / max µs per call, and
+ * the share of the time since the last reset spent in the region.
+ */
+void Profiler::report() {
+  profile_stats_t copy[PROFILE_REGIONS];
+  CRITICAL_SECTION_START;
+  memcpy(copy, stats, sizeof(copy));
+  CRITICAL_SECTION_END;
+  const millis_t elapsed_ms = ms() - reset_ms;
+  const float elapsed_us = elapsed_ms * 1000.0;
+
+  SERIAL_ECHO_START();
+  SERIAL_ECHOLNPAIR("Profile over ms:", elapsed_ms);
+  for (uint8_t r = 0; r < PROFILE_REGIONS; r++) {
+    const profile_stats_t &s = copy[r];
+    if (!s.count) continue;
+    const float total_us = float(s.total) / (PROFILER_TICKS_PER_US);
+    SERIAL_ECHO_START();
+    serialprintPGM(region_name(r));
+    SERIAL_ECHOPAIR(" calls:", s.count);
+    SERIAL_ECHOPAIR(" min:", float(s.min) / (PROFILER_TICKS_PER_US));
+    SERIAL_ECHOPAIR(" avg:", total_us / s.count);
+    SERIAL_ECHOPAIR(" max:", float(s.max) / (PROFILER_TICKS_PER_US));
+    SERIAL_ECHOPAIR(" us load:", elapsed_us > 0 ? total_us * 100.0 / elapsed_us : 0);
+    SERIAL_CHAR('%');
+    SERIAL_EOL();
+  }
+}
+
+#endif // CPU_PROFILER
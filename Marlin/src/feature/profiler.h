@@ -0,0 +1,114 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * profiler.h - Time the stepper and temperature ISRs, the planner and the main tasks
+ *
+ * Each region keeps a call count and the minimum, total and maximum time
+ * of a call, measured wall-clock so it includes any interrupt that preempts
+ * it. Times come from the DWT cycle counter on ARM, micros() on AVR (4µs
+ * resolution, but averages stay unbiased) and the host clock on Linux.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "../inc/MarlinConfig.h"
+
+#ifdef __AVR__
+  #define PROFILER_TICKS_PER_US 1
+#elif defined(__PLAT_LINUX__)
+  #define PROFILER_TICKS_PER_US 1000
+#else
+  // Cortex-M3/M4 Data Watchpoint and Trace unit
+  #define PROFILER_DEMCR      (*(volatile uint32_t*)0xE000EDFC)
+  #define PROFILER_DWT_CTRL   (*(volatile uint32_t*)0xE0001000)
+  #define PROFILER_DWT_CYCCNT (*(volatile uint32_t*)0xE0001004)
+  #define PROFILER_TICKS_PER_US (CYCLES_PER_MICROSECOND)
+#endif
+
+enum ProfileRegion : char {
+  PROFILE_STEPPER_ISR,
+  PROFILE_ADVANCE_ISR,
+  PROFILE_TEMP_ISR,
+  PROFILE_MANAGE_HEATER,
+  PROFILE_LCD_UPDATE,
+  PROFILE_GET_COMMANDS,
+  PROFILE_PLANNER,
+  PROFILE_REGIONS
+};
+
+typedef struct {
+  uint32_t count, min, max; // Calls, and ticks per call
+  uint64_t total;
+} profile_stats_t;
+
+class Profiler {
+public:
+  static profile_stats_t stats[PROFILE_REGIONS];
+  static millis_t reset_ms;
+
+  static void init();
+  static void reset();
+  static void report();
+
+  // Milliseconds on the same clock as ticks(), for the load figures
+  FORCE_INLINE static millis_t ms() {
+    #ifdef __PLAT_LINUX__
+      return host_nanos() / 1000000UL;
+    #else
+      return millis();
+    #endif
+  }
+
+  FORCE_INLINE static uint32_t ticks() {
+    #ifdef __AVR__
+      return micros();
+    #elif defined(__PLAT_LINUX__)
+      return host_nanos();
+    #else
+      return PROFILER_DWT_CYCCNT;
+    #endif
+  }
+
+  FORCE_INLINE static void record(const ProfileRegion r, const uint32_t elapsed) {
+    profile_stats_t &s = stats[r];
+    s.count++;
+    s.total += elapsed;
+    NOMORE(s.min, elapsed);
+    NOLESS(s.max, elapsed);
+  }
+};
+
+/**
+ * Time the rest of the enclosing scope, on every way out of it
+ */
+class ProfileScope {
+public:
+  FORCE_INLINE ProfileScope(const ProfileRegion r) : region(r), start(Profiler::ticks()) {}
+  FORCE_INLINE ~ProfileScope() { Profiler::record(region, Profiler::ticks() - start); }
+private:
+  const ProfileRegion region;
+  const uint32_t start;
+};
+
+#endif // PROFILER_H
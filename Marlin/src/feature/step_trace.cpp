@@ -0,0 +1,124 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * step_trace.cpp - Record the step pulses emitted by the stepper ISR
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEP_TRACE)
+
+#include "step_trace.h"
+#include "../Marlin.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../sd/cardreader.h"
+#endif
+
+StepTrace step_trace;
+
+StepTraceMode StepTrace::mode; // = STEP_TRACE_OFF
+uint32_t StepTrace::event_count, StepTrace::block_count, StepTrace::timer_base;
+step_event_t StepTrace::events[STEP_TRACE_SIZE];
+step_block_t StepTrace::blocks[STEP_TRACE_BLOCKS];
+
+void StepTrace::start(const StepTraceMode m) {
+  stop();
+  event_count = block_count = 0;
+  mode = m;
+}
+
+void StepTrace::block(const block_t * const b) {
+  if (!mode) return;
+  step_block_t &t = blocks[block_count++ & (STEP_TRACE_BLOCKS - 1)];
+  t.first_event = event_count;
+  t.step_event_count = b->step_event_count;
+  t.accelerate_until = b->accelerate_until;
+  t.decelerate_after = b->decelerate_after;
+  t.initial_rate = b->initial_rate;
+  t.nominal_rate = b->nominal_rate;
+  t.final_rate = b->final_rate;
+  t.acceleration_steps_per_s2 = b->acceleration_steps_per_s2;
+  LOOP_XYZE(i) t.steps[i] = b->steps[i];
+}
+
+static void trace_line(char * const line, const bool to_sd) {
+  #if ENABLED(SDSUPPORT)
+    if (to_sd) { card.write_command(line); return; }
+  #else
+    UNUSED(to_sd);
+  #endif
+  SERIAL_PROTOCOLLN(line);
+}
+
+/**
+ * The trace as text, oldest first:
+ *
+ *   step_trace rate:<ticks/s> events:<first>-<end> blocks:<first>-<end>
+ *   b <first event> <step events> <accelerate until> <decelerate after>
+ *     <initial rate> <nominal rate> <final rate> <accel steps/s2> <X> <Y> <Z> <E>
+ *   s <time> <step bits> <direction bits>
+ *   step_trace end
+ *
+ * Sequence numbers count from the start of recording, so each block's
+ * first event number places it among the events.
+ */
+void StepTrace::dump(const bool to_sd/*=false*/) {
+  stop();
+
+  // Room for the longest line, plus the line end added by write_command
+  char line[16 + 12 * 12];
+
+  const uint32_t first_event = event_count > STEP_TRACE_SIZE ? event_count - (STEP_TRACE_SIZE) : 0,
+                 first_block = block_count > STEP_TRACE_BLOCKS ? block_count - (STEP_TRACE_BLOCKS) : 0;
+
+  sprintf_P(line, PSTR("step_trace rate:%lu events:%lu-%lu blocks:%lu-%lu"),
+    (unsigned long)(HAL_STEPPER_TIMER_RATE), (unsigned long)first_event, (unsigned long)event_count,
+    (unsigned long)first_block, (unsigned long)block_count
+  );
+  trace_line(line, to_sd);
+
+  for (uint32_t i = first_block; i < block_count; i++) {
+    const step_block_t &t = blocks[i & (STEP_TRACE_BLOCKS - 1)];
+    sprintf_P(line, PSTR("b %lu %lu %ld %ld %lu %lu %lu %lu %ld %ld %ld %ld"),
+      (unsigned long)t.first_event, (unsigned long)t.step_event_count,
+      (long)t.accelerate_until, (long)t.decelerate_after,
+      (unsigned long)t.initial_rate, (unsigned long)t.nominal_rate, (unsigned long)t.final_rate,
+      (unsigned long)t.acceleration_steps_per_s2,
+      (long)t.steps[X_AXIS], (long)t.steps[Y_AXIS], (long)t.steps[Z_AXIS], (long)t.steps[E_AXIS]
+    );
+    trace_line(line, to_sd);
+  }
+
+  for (uint32_t i = first_event; i < event_count; i++) {
+    const step_event_t &e = events[i & (STEP_TRACE_SIZE - 1)];
+    sprintf_P(line, PSTR("s %lu %x %x"), (unsigned long)e.time, e.steps, e.dirs);
+    trace_line(line, to_sd);
+    idle();
+  }
+
+  strcpy_P(line, PSTR("step_trace end"));
+  trace_line(line, to_sd);
+}
+
+#endif // STEP_TRACE
@@ -0,0 +1,102 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * step_trace.h - Record the step pulses emitted by the stepper ISR
+ *
+ * Each step event is logged with the stepper timer time it was emitted at,
+ * into a ring buffer that keeps the latest STEP_TRACE_SIZE events. Times
+ * are the sum of the stepper timer periods plus the count within the
+ * current period, so they include ISR latency but stay exact to the tick.
+ * The trapezoid of each block started is kept alongside, so the analyzer
+ * (buildroot/share/scripts/step_trace.py) can set what was emitted against
+ * what was planned.
+ */
+
+#ifndef STEP_TRACE_H
+#define STEP_TRACE_H
+
+#include "../inc/MarlinConfig.h"
+#include "../module/planner.h"
+
+#define STEP_TRACE_ADVANCE 7  // Flag bit of an E step from the LIN_ADVANCE ISR
+
+enum StepTraceMode : char {
+  STEP_TRACE_OFF,
+  STEP_TRACE_RING,     // Keep recording, overwriting the oldest events
+  STEP_TRACE_ONESHOT   // Stop when the buffer is full
+};
+
+typedef struct {
+  uint32_t time;       // Stepper timer ticks
+  uint8_t steps,       // Bit per axis that stepped, plus STEP_TRACE_ADVANCE
+          dirs;        // Bit per axis moving in the negative direction
+} step_event_t;
+
+typedef struct {
+  uint32_t first_event,                    // Sequence number of the block's first step event
+           step_event_count;
+  int32_t accelerate_until,
+          decelerate_after;
+  uint32_t initial_rate,
+           nominal_rate,
+           final_rate,
+           acceleration_steps_per_s2;
+  int32_t steps[NUM_AXIS];
+} step_block_t;
+
+class StepTrace {
+public:
+  static StepTraceMode mode;
+  static uint32_t event_count,             // Events recorded since start(); the buffer keeps the latest
+                  block_count,
+                  timer_base;              // Stepper timer ticks at the start of the current period
+
+  static step_event_t events[STEP_TRACE_SIZE];
+  static step_block_t blocks[STEP_TRACE_BLOCKS];
+
+  static void start(const StepTraceMode m);
+  static void stop() { mode = STEP_TRACE_OFF; }
+
+  // Print the trace over serial, or write it to the open SD file
+  static void dump(const bool to_sd=false);
+
+  // Stepper ISR entry: a timer period of the given length has ended
+  FORCE_INLINE static void period(const uint32_t ticks) { timer_base += ticks; }
+
+  // A step event, at the given count into the current timer period
+  FORCE_INLINE static void step(const uint32_t count, const uint8_t steps, const uint8_t dirs) {
+    if (!mode) return;
+    if (mode == STEP_TRACE_ONESHOT && event_count >= STEP_TRACE_SIZE) { mode = STEP_TRACE_OFF; return; }
+    step_event_t &e = events[event_count++ & (STEP_TRACE_SIZE - 1)];
+    e.time = timer_base + count;
+    e.steps = steps;
+    e.dirs = dirs;
+  }
+
+  // The stepper ISR took a new block
+  static void block(const block_t * const b);
+};
+
+extern StepTrace step_trace;
+
+#endif // STEP_TRACE_H
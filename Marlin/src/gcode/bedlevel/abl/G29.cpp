@@ -627,12 +627,29 @@ void GcodeSuite::G29() {
 
     measured_z = 0;
 
+    #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+      reset_probe_statistics();
+      #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+        for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
+          for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++)
+            z_std_error[x][y] = NAN;
+      #endif
+    #endif
+
     #if ABL_GRID
 
       bool zig = PR_OUTER_END & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
 
       measured_z = 0;
 
+      #if ENABLED(PROBE_ON_THE_FLY)
+        // The zig-zag order keeps each point next to the one before,
+        // so the last result is a good prediction for the next.
+        float predicted_z = NAN;
+        const millis_t probe_start_ms = millis();
+        probe_touches_saved = 0;
+      #endif
+
       // Outer loop is Y with PROBE_Y_FIRST disabled
       for (uint8_t PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_END && !isnan(measured_z); PR_OUTER_VAR++) {
 
@@ -669,13 +686,21 @@ void GcodeSuite::G29() {
             if (!position_is_reachable_by_probe(xProbe, yProbe)) continue;
           #endif
 
-          measured_z = faux ? 0.001 * random(-100, 101) : probe_pt(xProbe, yProbe, stow_probe_after_each, verbose_level);
+          measured_z = faux ? 0.001 * random(-100, 101) : probe_pt(xProbe, yProbe, stow_probe_after_each, verbose_level, true
+            #if ENABLED(PROBE_ON_THE_FLY)
+              , predicted_z
+            #endif
+          );
 
           if (isnan(measured_z)) {
             planner.leveling_active = abl_should_enable;
             break;
           }
 
+          #if ENABLED(PROBE_ON_THE_FLY)
+            if (!stow_probe_after_each) predicted_z = measured_z;
+          #endif
+
           #if ENABLED(AUTO_BED_LEVELING_LINEAR)
 
             mean += measured_z;
@@ -684,11 +709,20 @@ void GcodeSuite::G29() {
             eqnAMatrix[abl_probe_index + 1 * abl2] = yProbe;
             eqnAMatrix[abl_probe_index + 2 * abl2] = 1;
 
-            incremental_LSF(&lsf_results, xProbe, yProbe, measured_z);
+            #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+              // Weigh each point by how well its height is known
+              if (!faux && !isnan(probe_std_error))
+                incremental_WLSF(&lsf_results, xProbe, yProbe, measured_z, sq(PROBE_SAMPLE_TOLERANCE) / sq(max(probe_std_error, 0.5 * (PROBE_SAMPLE_TOLERANCE))));
+              else
+            #endif
+                incremental_LSF(&lsf_results, xProbe, yProbe, measured_z);
 
           #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
 
             z_values[xCount][yCount] = measured_z + zoffset;
+            #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+              if (!faux) z_std_error[xCount][yCount] = probe_std_error;
+            #endif
 
           #endif
 
@@ -698,6 +732,11 @@ void GcodeSuite::G29() {
         } // inner
       } // outer
 
+      #if ENABLED(PROBE_ON_THE_FLY)
+        finish_probe_raise();
+        if (!faux) report_probing_time(probe_start_ms);
+      #endif
+
     #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
       // Probe at 3 arbitrary points
@@ -764,6 +803,9 @@ void GcodeSuite::G29() {
 
       if (!dryrun) extrapolate_unprobed_bed_level();
       print_bilinear_leveling_grid();
+      #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+        if (verbose_level > 1) print_bilinear_std_error_grid();
+      #endif
 
       refresh_bed_level();
 
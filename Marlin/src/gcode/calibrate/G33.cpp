@@ -135,9 +135,17 @@ static void G33_cleanup(
   #endif
 }
 
+#if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+  static float probe_noise; // Worst standard error of the probed points
+#endif
+
 inline float calibration_probe(const float nx, const float ny, const bool stow) {
   #if HAS_BED_PROBE
-    return probe_pt(nx, ny, stow, 0, false);
+    const float z = probe_pt(nx, ny, stow, 0, false);
+    #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+      if (!isnan(probe_std_error)) NOLESS(probe_noise, probe_std_error);
+    #endif
+    return z;
   #else
     UNUSED(stow);
     return lcd_probe_pt(nx, ny);
@@ -164,6 +172,10 @@ static float probe_G33_points(float z_at_pt[NPP + 1], const int8_t probe_points,
 
   LOOP_CAL_ALL(axis) z_at_pt[axis] = 0.0;
 
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+    probe_noise = 0;
+  #endif
+
   if (!_0p_calibration) {
 
     if (!_7p_no_intermediates && !_7p_4_intermediates && !_7p_11_intermediates) { // probe the center
@@ -359,6 +371,281 @@ static float probe_G33_points(float z_at_pt[NPP + 1], const int8_t probe_points,
 
 #endif // HAS_BED_PROBE
 
+#if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+
+  /**
+   * Least-squares calibration (G33 L)
+   *
+   * Probe any number of points once and fit the geometry to all of them.
+   *
+   * Probing fixes the height of each carriage above its endstop when the
+   * nozzle met the bed at each point. With the right geometry the forward
+   * kinematics of those carriage heights put the nozzle at Z=0, so the
+   * heights they give are the residuals to minimize. Levenberg-Marquardt
+   * steps are taken from a numerical Jacobian. As in least_squares_fit
+   * the normal equations are accumulated point by point, so the Jacobian
+   * is never stored.
+   */
+
+  #define LSQ_MAX_FACTORS 9
+  #define LSQ_MAX_POINTS (1 + (DELTA_LSQ_MAX_RING_POINTS) + (DELTA_LSQ_MAX_RING_POINTS) / 2)
+  #define LSQ_STEP 0.1 // (mm or degrees) Parameter change for the Jacobian
+
+  static float * const lsq_params[] = {
+    &delta_endstop_adj[A_AXIS], &delta_endstop_adj[B_AXIS], &delta_endstop_adj[C_AXIS],
+    &delta_radius,
+    &delta_tower_angle_trim[A_AXIS], &delta_tower_angle_trim[B_AXIS],
+    &delta_diagonal_rod,
+    &delta_diagonal_rod_trim[A_AXIS], &delta_diagonal_rod_trim[B_AXIS], &delta_diagonal_rod_trim[C_AXIS]
+  };
+
+  // The parameter for factor 'f'. 9 factors trim each rod instead of the common length.
+  FORCE_INLINE static float& lsq_param(const uint8_t f, const uint8_t factors) {
+    return *lsq_params[factors == 9 && f >= 6 ? f + 1 : f];
+  }
+
+  /**
+   * The nozzle height the current geometry gives for carriages at
+   * 'above_endstop' mm from the point where homing leaves them.
+   */
+  static float lsq_height(const float above_endstop[ABC]) {
+    const float home_pos[XYZ] = { 0, 0, delta_height };
+    inverse_kinematics(home_pos);
+    const float carriage[ABC] = {
+      above_endstop[A_AXIS] - delta_endstop_adj[A_AXIS] + delta[A_AXIS],
+      above_endstop[B_AXIS] - delta_endstop_adj[B_AXIS] + delta[B_AXIS],
+      above_endstop[C_AXIS] - delta_endstop_adj[C_AXIS] + delta[C_AXIS]
+    };
+    forward_kinematics_DELTA(carriage[A_AXIS], carriage[B_AXIS], carriage[C_AXIS]);
+    return cartes[Z_AXIS];
+  }
+
+  // Sum of squared residuals over all points
+  static float lsq_error(const float (*above_endstop)[ABC], const uint8_t points, const float &offset) {
+    recalc_delta_towers();
+    float ss = 0;
+    for (uint8_t i = 0; i < points; i++) ss += sq(lsq_height(above_endstop[i]) + offset);
+    return ss;
+  }
+
+  /**
+   * Solve A.x = b for the 'n' unknowns by Gaussian elimination with
+   * partial pivoting. Each row of 'm' is a row of A followed by b.
+   * Return false if A is singular.
+   */
+  static bool lsq_solve(float m[LSQ_MAX_FACTORS][LSQ_MAX_FACTORS + 1], const uint8_t n, float x[LSQ_MAX_FACTORS]) {
+    for (uint8_t c = 0; c < n; c++) {
+      uint8_t pivot = c;
+      for (uint8_t r = c + 1; r < n; r++) if (FABS(m[r][c]) > FABS(m[pivot][c])) pivot = r;
+      if (m[pivot][c] == 0) return false;
+      if (pivot != c) for (uint8_t k = c; k <= n; k++) { const float t = m[c][k]; m[c][k] = m[pivot][k]; m[pivot][k] = t; }
+      for (uint8_t r = c + 1; r < n; r++) {
+        const float f = m[r][c] / m[c][c];
+        for (uint8_t k = c; k <= n; k++) m[r][k] -= f * m[c][k];
+      }
+    }
+    for (int8_t c = n - 1; c >= 0; c--) {
+      float s = m[c][n];
+      for (uint8_t k = c + 1; k < n; k++) s -= m[c][k] * x[k];
+      x[c] = s / m[c][c];
+    }
+    return true;
+  }
+
+  /**
+   * Fit 'factors' parameters to the probed points, leaving the result in
+   * the delta settings. Return the RMS height error of the fitted model.
+   */
+  static float lsq_fit(const float (*above_endstop)[ABC], const uint8_t points, const float &offset, const uint8_t factors) {
+    float lambda = 0.001,
+          ss = lsq_error(above_endstop, points, offset);
+
+    for (uint8_t iteration = 0; iteration < 20 && lambda < 1e6; iteration++) {
+      float JtJ[LSQ_MAX_FACTORS][LSQ_MAX_FACTORS] = { { 0 } },
+            Jtr[LSQ_MAX_FACTORS] = { 0 };
+
+      // Accumulate the normal equations one point at a time
+      for (uint8_t i = 0; i < points; i++) {
+        idle(); // Each point takes a few kinematics solutions per factor. Keep the heaters and watchdog going.
+        const float r = lsq_height(above_endstop[i]) + offset;
+        float row[LSQ_MAX_FACTORS];
+        for (uint8_t f = 0; f < factors; f++) {
+          float &p = lsq_param(f, factors);
+          p += LSQ_STEP;
+          recalc_delta_towers();
+          row[f] = (lsq_height(above_endstop[i]) + offset - r) * (1.0 / (LSQ_STEP));
+          p -= LSQ_STEP;
+        }
+        recalc_delta_towers();
+        for (uint8_t f = 0; f < factors; f++) {
+          for (uint8_t g = 0; g <= f; g++) JtJ[f][g] += row[f] * row[g];
+          Jtr[f] += row[f] * r;
+        }
+      }
+      for (uint8_t f = 0; f < factors; f++)
+        for (uint8_t g = f + 1; g < factors; g++) JtJ[f][g] = JtJ[g][f];
+
+      // Take the largest step that lowers the error, damping as needed
+      const float old_ss = ss;
+      for (; lambda < 1e6; lambda *= 10) {
+        float m[LSQ_MAX_FACTORS][LSQ_MAX_FACTORS + 1], step[LSQ_MAX_FACTORS];
+        for (uint8_t f = 0; f < factors; f++) {
+          for (uint8_t g = 0; g < factors; g++) m[f][g] = JtJ[f][g];
+          m[f][f] *= 1 + lambda;
+          m[f][factors] = -Jtr[f];
+        }
+        if (!lsq_solve(m, factors, step)) continue;
+
+        for (uint8_t f = 0; f < factors; f++) lsq_param(f, factors) += step[f];
+        const float new_ss = lsq_error(above_endstop, points, offset);
+        if (new_ss < ss) {
+          ss = new_ss;
+          lambda *= 0.1;
+          break;
+        }
+        for (uint8_t f = 0; f < factors; f++) lsq_param(f, factors) -= step[f];
+      }
+      recalc_delta_towers();
+
+      if (old_ss - ss < 1e-8) break; // No longer improving
+    }
+
+    return SQRT(ss / points);
+  }
+
+  /**
+   * G33 L - Probe 'ring_points' around the calibration radius, half as
+   *         many around half the radius, and the center. Then fit.
+   */
+  static void G33_least_squares(const uint8_t factors, const uint8_t ring_points, const int8_t verbose_level, const bool stow_after_each) {
+    if (factors != 3 && factors != 4 && factors != 6 && factors != 7 && factors != 9) {
+      SERIAL_PROTOCOLLNPGM("?(L)east-squares factors is implausible (3, 4, 6, 7 or 9).");
+      return;
+    }
+    if (!WITHIN(ring_points, 6, DELTA_LSQ_MAX_RING_POINTS)) {
+      SERIAL_PROTOCOLPAIR("?(P)oints is implausible (6-", int(DELTA_LSQ_MAX_RING_POINTS));
+      SERIAL_PROTOCOLLNPGM(").");
+      return;
+    }
+    for (uint8_t i = 0; i < ring_points; i++) { // test if the outer ring is reachable
+      const float a = RADIANS(210 + 360.0 * i / ring_points);
+      if (!position_is_reachable(cos(a) * delta_calibration_radius, sin(a) * delta_calibration_radius)) {
+        SERIAL_PROTOCOLLNPGM("?(M665 B)ed radius is implausible.");
+        return;
+      }
+    }
+
+    SERIAL_PROTOCOLLNPGM("G33 Least-Squares Calibrate");
+
+    stepper.synchronize();
+    #if HAS_LEVELING
+      reset_bed_level(); // After calibration bed-level data is no longer valid
+    #endif
+
+    #if HOTENDS > 1
+      const uint8_t old_tool_index = active_extruder;
+      tool_change(0, 0, true);
+      #define G33_LSQ_CLEANUP() G33_cleanup(old_tool_index)
+    #else
+      #define G33_LSQ_CLEANUP() G33_cleanup()
+    #endif
+
+    setup_for_endstop_or_probe_move();
+    #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+      reset_probe_statistics();
+    #endif
+    endstops.enable(true);
+    if (!home_delta())
+      return;
+    endstops.not_homing();
+
+    float above_endstop[LSQ_MAX_POINTS][ABC];
+    const float offset =
+      #if HAS_BED_PROBE
+        zprobe_zoffset
+      #else
+        0
+      #endif
+    ;
+
+    // Carriage heights at home, relative to the endstops
+    const float home_pos[XYZ] = { 0, 0, delta_height };
+    inverse_kinematics(home_pos);
+    float home_adj[ABC];
+    LOOP_XYZ(axis) home_adj[axis] = delta[axis] - delta_endstop_adj[axis];
+
+    // Probe the points
+    float ss = 0;
+    uint8_t points = 0;
+    for (uint8_t ring = 0; ring < 3; ring++) {
+      const uint8_t count = ring == 0 ? 1 : ring == 1 ? ring_points / 2 : ring_points;
+      const float r = delta_calibration_radius * 0.5 * ring;
+      for (uint8_t i = 0; i < count; i++) {
+        const float a = RADIANS(210 + 360.0 * i / count),
+                    nx = cos(a) * r, ny = sin(a) * r,
+                    z = calibration_probe(nx, ny, stow_after_each);
+        if (isnan(z)) { G33_LSQ_CLEANUP(); return; }
+        if (verbose_level > 2) {
+          SERIAL_PROTOCOLPAIR(".X:", nx);
+          SERIAL_PROTOCOLPAIR(" Y:", ny);
+          SERIAL_PROTOCOLLNPAIR(" Z:", z);
+        }
+        const float raw[XYZ] = { nx, ny, z - offset };
+        inverse_kinematics(raw);
+        LOOP_XYZ(axis) above_endstop[points][axis] = delta[axis] - home_adj[axis];
+        ss += sq(z);
+        points++;
+      }
+    }
+
+    SERIAL_PROTOCOLPGM("Probed std dev:");
+    SERIAL_PROTOCOL_F(SQRT(ss / points), 3);
+    SERIAL_EOL();
+
+    // Keep the old settings for a dry run
+    const float old_height = delta_height;
+    float old_params[COUNT(lsq_params)];
+    for (uint8_t p = 0; p < COUNT(lsq_params); p++) old_params[p] = *lsq_params[p];
+
+    const float rms = lsq_fit(above_endstop, points, offset, factors);
+
+    // Move the highest endstop to zero, as the iterative method does
+    const float z_temp = MAX3(delta_endstop_adj[A_AXIS], delta_endstop_adj[B_AXIS], delta_endstop_adj[C_AXIS]);
+    delta_height -= z_temp;
+    LOOP_XYZ(axis) delta_endstop_adj[axis] -= z_temp;
+
+    SERIAL_PROTOCOLPAIR("Fitted ", factors);
+    SERIAL_PROTOCOLPGM(" factors. Model std dev:");
+    SERIAL_PROTOCOL_F(rms, 3);
+    SERIAL_EOL();
+    print_G33_settings(true, true);
+    if (factors >= 7) {
+      SERIAL_PROTOCOLPAIR(".Diag Rod:", delta_diagonal_rod);
+      if (factors == 9) {
+        print_signed_float(PSTR("Di"), delta_diagonal_rod_trim[A_AXIS]);
+        print_signed_float(PSTR("Dj"), delta_diagonal_rod_trim[B_AXIS]);
+        print_signed_float(PSTR("Dk"), delta_diagonal_rod_trim[C_AXIS]);
+      }
+      SERIAL_EOL();
+    }
+
+    if (verbose_level == 0) {                                    // dry run
+      delta_height = old_height;
+      for (uint8_t p = 0; p < COUNT(lsq_params); p++) *lsq_params[p] = old_params[p];
+      SERIAL_PROTOCOLLNPGM("End DRY-RUN");
+    }
+    else
+      SERIAL_PROTOCOLLNPGM("Save with M500 and/or copy to Configuration.h");
+
+    recalc_delta_settings();
+    endstops.enable(true);
+    home_delta();
+    endstops.not_homing();
+    G33_LSQ_CLEANUP();
+  }
+
+#endif // DELTA_CALIBRATION_LEAST_SQUARES
+
 /**
  * G33 - Delta '1-4-7-point' Auto-Calibration
  *       Calibrate height, endstops, delta radius, and tower angles.
@@ -380,6 +667,14 @@ static float probe_G33_points(float z_at_pt[NPP + 1], const int8_t probe_points,
  *
  *   A   Auto tune calibartion factors (set in Configuration.h)
  *
+ *   Ln  Least-squares fit of n factors in a single probing round (DELTA_CALIBRATION_LEAST_SQUARES):
+ *      L3  Endstops
+ *      L4  Endstops and delta radius
+ *      L6  Endstops, delta radius and tower angles
+ *      L7  As L6, plus the diagonal rod length
+ *      L9  As L6, plus a diagonal rod trim for each tower
+ *      With L, Pn is the number of points around the calibration radius (6-DELTA_LSQ_MAX_RING_POINTS)
+ *
  *   Vn  Verbose level:
  *      V0  Dry-run mode. Report settings and probe results. No calibration.
  *      V1  Report start and end settings only
@@ -390,19 +685,32 @@ static float probe_G33_points(float z_at_pt[NPP + 1], const int8_t probe_points,
  */
 void GcodeSuite::G33() {
 
-  const int8_t probe_points = parser.intval('P', DELTA_CALIBRATION_DEFAULT_POINTS);
-  if (!WITHIN(probe_points, 0, 10)) {
-    SERIAL_PROTOCOLLNPGM("?(P)oints is implausible (0-10).");
-    return;
-  }
-
   const int8_t verbose_level = parser.byteval('V', 1);
   if (!WITHIN(verbose_level, 0, 3)) {
     SERIAL_PROTOCOLLNPGM("?(V)erbose level is implausible (0-3).");
     return;
   }
 
-  const float calibration_precision = parser.floatval('C', 0.0);
+  #if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+    // A separate procedure, where P counts the points around the outer ring
+    if (parser.seen('L')) {
+      G33_least_squares(parser.value_byte(), parser.byteval('P', 12), verbose_level, parser.boolval('E'));
+      return;
+    }
+  #endif
+
+  const int8_t probe_points = parser.intval('P', DELTA_CALIBRATION_DEFAULT_POINTS);
+  if (!WITHIN(probe_points, 0, 10)) {
+    SERIAL_PROTOCOLLNPGM("?(P)oints is implausible (0-10).");
+    return;
+  }
+
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+    float
+  #else
+    const float
+  #endif
+      calibration_precision = parser.floatval('C', 0.0);
   if (calibration_precision < 0) {
     SERIAL_PROTOCOLLNPGM("?(C)alibration precision is implausible (>=0).");
     return;
@@ -472,6 +780,9 @@ void GcodeSuite::G33() {
   #endif
 
   setup_for_endstop_or_probe_move();
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+    reset_probe_statistics();
+  #endif
   endstops.enable(true);
   if (!_0p_calibration) {
     if (!home_delta())
@@ -516,6 +827,18 @@ void GcodeSuite::G33() {
       return G33_CLEANUP();
     }
 
+    #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+      // Deviations within the probe's own noise can't be calibrated out
+      if (probe_noise > calibration_precision) {
+        calibration_precision = probe_noise;
+        if (verbose_level > 1) {
+          SERIAL_PROTOCOLPGM("Probe noise:");
+          SERIAL_PROTOCOL_F(probe_noise, 3);
+          SERIAL_EOL();
+        }
+      }
+    #endif
+
     // Solve matrices
 
     if ((zero_std_dev < test_precision || iterations <= force_iterations) && zero_std_dev > calibration_precision) {
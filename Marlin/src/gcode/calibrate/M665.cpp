@@ -41,6 +41,9 @@
    *    X = Alpha (Tower 1) angle trim
    *    Y = Beta (Tower 2) angle trim
    *    Z = Rotate A and B by this angle
+   *    I = Alpha (Tower 1) diagonal rod trim
+   *    J = Beta (Tower 2) diagonal rod trim
+   *    K = Gamma (Tower 3) diagonal rod trim
    */
   void GcodeSuite::M665() {
     if (parser.seen('H')) delta_height                   = parser.value_linear_units();
@@ -51,6 +54,9 @@
     if (parser.seen('X')) delta_tower_angle_trim[A_AXIS] = parser.value_float();
     if (parser.seen('Y')) delta_tower_angle_trim[B_AXIS] = parser.value_float();
     if (parser.seen('Z')) delta_tower_angle_trim[C_AXIS] = parser.value_float();
+    if (parser.seen('I')) delta_diagonal_rod_trim[A_AXIS] = parser.value_linear_units();
+    if (parser.seen('J')) delta_diagonal_rod_trim[B_AXIS] = parser.value_linear_units();
+    if (parser.seen('K')) delta_diagonal_rod_trim[C_AXIS] = parser.value_linear_units();
     recalc_delta_settings();
   }
 
@@ -0,0 +1,73 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MPC_HOTEND)
+
+#include "../gcode.h"
+#include "../../module/temperature.h"
+
+/**
+ * M306: Set the MPC hotend model (as found by M303)
+ *
+ *   E[int]   Hotend (default 0)
+ *   P[float] Heater power (W)
+ *   C[float] Block heat capacity (J/K)
+ *   R[float] Sensor responsiveness (1/s)
+ *   A[float] Ambient heat transfer coefficient (W/K)
+ *   H[float] Filament heat capacity per mm (J/K/mm)
+ *   T[float] Ambient temperature (C)
+ */
+void GcodeSuite::M306() {
+  const uint8_t e = parser.byteval('E');
+
+  if (e < HOTENDS) {
+    Temperature::mpc_t &m = thermalManager.mpc[e];
+    if (parser.seen('P')) m.heater_power = parser.value_float();
+    if (parser.seen('C')) m.block_heat_capacity = parser.value_float();
+    if (parser.seen('R')) m.sensor_responsiveness = parser.value_float();
+    if (parser.seen('A')) m.ambient_xfer_coeff = parser.value_float();
+    if (parser.seen('H')) m.filament_heat_capacity_permm = parser.value_float();
+    if (parser.seen('T')) m.ambient_temp = parser.value_float();
+
+    if (parser.seen('P') || parser.seen('C') || parser.seen('R') || parser.seen('A') || parser.seen('H') || parser.seen('T'))
+      thermalManager.updateMPC(e);
+
+    SERIAL_ECHO_START();
+    #if HOTENDS > 1
+      SERIAL_ECHOPAIR(" e:", e);
+    #endif
+    SERIAL_ECHOPAIR(" p:", m.heater_power);
+    SERIAL_ECHOPAIR(" c:", m.block_heat_capacity);
+    SERIAL_ECHOPGM(" r:"); SERIAL_ECHO_F(m.sensor_responsiveness, 4);
+    SERIAL_ECHOPGM(" a:"); SERIAL_ECHO_F(m.ambient_xfer_coeff, 4);
+    SERIAL_ECHOPGM(" h:"); SERIAL_ECHO_F(m.filament_heat_capacity_permm, 6);
+    SERIAL_ECHOLNPAIR(" t:", m.ambient_temp);
+  }
+  else {
+    SERIAL_ERROR_START();
+    SERIAL_ERRORLN(MSG_INVALID_EXTRUDER);
+  }
+}
+
+#endif // MPC_HOTEND
@@ -24,18 +24,53 @@
 #include "../../module/configuration_store.h"
 #include "../../inc/MarlinConfig.h"
 
+#if ENABLED(EEPROM_SETTINGS)
+
+  /**
+   * Get the settings record given with 'R', if any.
+   * Return false if the record number is invalid.
+   */
+  static bool get_settings_record(uint8_t &record) {
+    record = SR_ALL;
+    if (parser.seenval('R')) {
+      record = parser.value_byte();
+      if (!WITHIN(record, 1, SR_COUNT - 1)) {
+        SERIAL_ERROR_START();
+        SERIAL_ERRORLNPGM("?Invalid settings record.");
+        return false;
+      }
+    }
+    return true;
+  }
+
+#endif
+
 /**
  * M500: Store settings in EEPROM
+ *
+ *  R<record> Store only this settings record
  */
 void GcodeSuite::M500() {
-  (void)settings.save();
+  #if ENABLED(EEPROM_SETTINGS)
+    uint8_t record;
+    if (get_settings_record(record)) (void)settings.save(record);
+  #else
+    (void)settings.save();
+  #endif
 }
 
 /**
  * M501: Read settings from EEPROM
+ *
+ *  R<record> Read only this settings record
  */
 void GcodeSuite::M501() {
-  (void)settings.load();
+  #if ENABLED(EEPROM_SETTINGS)
+    uint8_t record;
+    if (get_settings_record(record)) (void)settings.load(record);
+  #else
+    (void)settings.load();
+  #endif
 }
 
 /**
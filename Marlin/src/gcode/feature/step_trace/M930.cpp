@@ -0,0 +1,74 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(STEP_TRACE)
+
+#include "../../gcode.h"
+#include "../../../feature/step_trace.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../../../sd/cardreader.h"
+#endif
+
+/**
+ * M930: Step pulse trace
+ *
+ *  S<mode>  0 = Stop, 1 = Record continuously, 2 = Record until full
+ *  D        Stop and dump the trace over serial
+ *  W        Stop and write the trace to STEPTRC.TXT on the SD card
+ *
+ * With no parameters, report the recording state.
+ */
+void GcodeSuite::M930() {
+  if (parser.seen('S')) {
+    const uint8_t mode = parser.value_byte();
+    if (mode) step_trace.start(mode == 2 ? STEP_TRACE_ONESHOT : STEP_TRACE_RING); else step_trace.stop();
+  }
+
+  if (parser.seen('D')) step_trace.dump();
+
+  #if ENABLED(SDSUPPORT)
+    if (parser.seen('W')) {
+      if (card.isFileOpen()) {
+        SERIAL_ERROR_START();
+        SERIAL_ERRORLNPGM("SD file busy");
+      }
+      else {
+        char name[] = "STEPTRC.TXT";
+        card.openFile(name, false);
+        if (card.saving) {
+          step_trace.dump(true);
+          card.closefile();
+        }
+      }
+    }
+  #endif
+
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPGM("Step trace ");
+  serialprintPGM(step_trace.mode ? PSTR("on") : PSTR("off"));
+  SERIAL_ECHOLNPAIR(", events:", step_trace.event_count);
+}
+
+#endif // STEP_TRACE
@@ -435,6 +435,7 @@ void GcodeSuite::process_parsed_command() {
       case 114: M114(); break;    // M114: Report current position
 
       case 115: M115(); break;    // M115: Report capabilities
+      case 116: M116(); break;    // M116: Wait for all heaters to reach target
 
       case 117: M117(); break;    // M117: Set LCD message text, if possible
       case 118: M118(); break;    // M118: Display a message in the host console
@@ -533,6 +534,10 @@ void GcodeSuite::process_parsed_command() {
         case 304: M304(); break;  // M304: Set bed PID parameters
       #endif
 
+      #if ENABLED(MPC_HOTEND)
+        case 306: M306(); break;  // M306: Set the MPC hotend model
+      #endif
+
       #if defined(CHDK) || HAS_PHOTOGRAPH
         case 240: M240(); break;  // M240: Trigger a camera by emulating a Canon RC-1 : http://www.doc-diy.net/photo/rc-1_hacked/
       #endif
@@ -669,6 +674,14 @@ void GcodeSuite::process_parsed_command() {
         #endif
       #endif
 
+      #if ENABLED(STEP_TRACE)
+        case 930: M930(); break;    // M930: Record step pulses
+      #endif
+
+      #if ENABLED(CPU_PROFILER)
+        case 931: M931(); break;    // M931: Report ISR and task timings
+      #endif
+
       #if HAS_MICROSTEPS
         case 350: M350(); break;    // M350: Set microstepping mode. Warning: Steps per unit remains unchanged. S code sets stepping mode for all drivers.
         case 351: M351(); break;    // M351: Toggle MS1 MS2 pins directly, S# determines MS1 or MS2, X# sets the pin high/low.
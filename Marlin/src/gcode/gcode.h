@@ -125,6 +125,7 @@
  * M113 - Get or set the timeout interval for Host Keepalive "busy" messages. (Requires HOST_KEEPALIVE_FEATURE)
  * M114 - Report current position.
  * M115 - Report capabilities. (Extended capabilities requires EXTENDED_CAPABILITIES_REPORT)
+ * M116 - Wait for all heaters to reach their target temperatures. Waits only when heating.
  * M117 - Display a message on the controller screen. (Requires an LCD)
  * M118 - Display a message in the host console.
  * M119 - Report endstops status.
@@ -173,8 +174,9 @@
  * M300 - Play beep sound S<frequency Hz> P<duration ms>
  * M301 - Set PID parameters P I and D. (Requires PIDTEMP)
  * M302 - Allow cold extrudes, or set the minimum extrude S<temperature>. (Requires PREVENT_COLD_EXTRUSION)
- * M303 - PID relay autotune S<temperature> sets the target temperature. Default 150C. (Requires PIDTEMP)
+ * M303 - PID relay autotune S<temperature> sets the target temperature. Default 150C. W0 tunes in the background. (Requires PIDTEMP)
  * M304 - Set bed PID parameters P I and D. (Requires PIDTEMPBED)
+ * M306 - Set the hotend model P C R A H T, as found by M303. (Requires MPC_HOTEND)
  * M350 - Set microstepping mode. (Requires digital microstepping pins.)
  * M351 - Toggle MS1 MS2 pins directly. (Requires digital microstepping pins.)
  * M355 - Set Case Light on/off and set brightness. (Requires CASE_LIGHT_PIN)
@@ -231,6 +233,8 @@
  *
  * ************ Custom codes - This can change to suit future G-code regulations
  * M928 - Start SD logging: "M928 filename.gco". Stop with M29. (Requires SDSUPPORT)
+ * M930 - Record step pulses: "M930 S<0|1|2>", dump with D or W. (Requires STEP_TRACE)
+ * M931 - Report ISR and main loop task timings. R to reset. (Requires CPU_PROFILER)
  * M999 - Restart after being stopped by error
  *
  * "T" Codes
@@ -506,6 +510,7 @@ private:
 
   static void M114();
   static void M115();
+  static void M116();
   static void M117();
   static void M118();
   static void M119();
@@ -628,6 +633,10 @@ private:
     static void M304();
   #endif
 
+  #if ENABLED(MPC_HOTEND)
+    static void M306();
+  #endif
+
   #if HAS_MICROSTEPS
     static void M350();
     static void M351();
@@ -754,6 +763,14 @@ private:
     static void M928();
   #endif
 
+  #if ENABLED(STEP_TRACE)
+    static void M930();
+  #endif
+
+  #if ENABLED(CPU_PROFILER)
+    static void M931();
+  #endif
+
   static void M999();
 
   static void T(const uint8_t tmp_extruder);
@@ -36,6 +36,10 @@
   #include "../feature/leds/leds.h"
 #endif
 
+#if ENABLED(CPU_PROFILER)
+  #include "../feature/profiler.h"
+#endif
+
 /**
  * GCode line number handling. Hosts may opt to include line numbers when
  * sending commands to Marlin, and lines will be checked for sequentiality.
@@ -419,6 +423,10 @@ inline void get_serial_commands() {
  */
 void get_available_commands() {
 
+  #if ENABLED(CPU_PROFILER)
+    ProfileScope profile(PROFILE_GET_COMMANDS);
+  #endif
+
   // if any immediate commands remain, don't get other commands yet
   if (drain_injected_commands_P()) return;
 
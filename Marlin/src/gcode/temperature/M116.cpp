@@ -0,0 +1,68 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../gcode.h"
+#include "../../module/temperature.h"
+#include "../../Marlin.h" // for wait_for_heatup and idle()
+
+/**
+ * M116: Wait for all heaters to reach their target temperatures.
+ *       Waits only when heating. Heaters without a target are ignored.
+ *
+ * M109 and M190 wait for one heater at a time. Set all the targets with
+ * M104 and M140 first, then M116 lets the heaters come up together.
+ */
+void GcodeSuite::M116() {
+  if (DEBUGGING(DRYRUN)) return;
+
+  #if DISABLED(BUSY_WHILE_HEATING)
+    KEEPALIVE_STATE(NOT_BUSY);
+  #endif
+
+  millis_t next_temp_ms = 0;
+  wait_for_heatup = true;
+
+  while (wait_for_heatup) {
+    bool heating = false;
+    HOTEND_LOOP() if (thermalManager.isHeatingHotend(e)) heating = true;
+    #if HAS_HEATER_BED && HAS_TEMP_BED
+      if (thermalManager.isHeatingBed()) heating = true;
+    #endif
+    if (!heating) break;
+
+    const millis_t now = millis();
+    if (ELAPSED(now, next_temp_ms)) { // Print temperatures every 1s while waiting
+      next_temp_ms = now + 1000UL;
+      thermalManager.print_heaterstates();
+      SERIAL_EOL();
+    }
+
+    idle();
+    refresh_cmd_timeout(); // to prevent stepper_inactive_time from running out
+  }
+
+  wait_for_heatup = false;
+
+  #if DISABLED(BUSY_WHILE_HEATING)
+    KEEPALIVE_STATE(IN_HANDLER);
+  #endif
+}
@@ -30,11 +30,17 @@
  *       E<extruder> (-1 for the bed) (default 0)
  *       C<cycles>
  *       U<bool> with a non-zero value will apply the result to current settings
+ *       W<bool> with a zero value tunes in the background and returns at once.
+ *               Otherwise wait until all running autotunes have finished.
+ *
+ * With MPC_HOTEND a hotend gets its thermal model identified instead,
+ * heating from ambient to S<temperature>. C<cycles> is ignored.
  */
 void GcodeSuite::M303() {
   #if HAS_PID_HEATING
     const int e = parser.intval('E'), c = parser.intval('C', 5);
-    const bool u = parser.boolval('U');
+    const bool u = parser.boolval('U'),
+               w = !parser.seen('W') || parser.boolval('W');
 
     int16_t temp = parser.celsiusval('S', e < 0 ? 70 : 150);
 
@@ -45,7 +51,12 @@ void GcodeSuite::M303() {
       KEEPALIVE_STATE(NOT_BUSY);
     #endif
 
-    thermalManager.PID_autotune(temp, e, c, u);
+    #if ENABLED(MPC_HOTEND)
+      if (e >= 0)
+        thermalManager.MPC_autotune(temp, e, u);
+      else
+    #endif
+        thermalManager.PID_autotune(temp, e, c, u, w);
 
     #if DISABLED(BUSY_WHILE_HEATING)
       KEEPALIVE_STATE(IN_HANDLER);
@@ -996,6 +996,10 @@
   #define LEVELED_SEGMENT_LENGTH 5
 #endif
 
+#if defined(LEVELED_SEGMENT_ERROR) && IS_CARTESIAN && (ENABLED(MESH_BED_LEVELING) || ENABLED(AUTO_BED_LEVELING_BILINEAR))
+  #define ADAPTIVE_LEVELED_SEGMENTS
+#endif
+
 /**
  * Bed Probing rectangular bounds
  * These can be further constrained in code for Delta and SCARA
@@ -542,6 +542,17 @@ static_assert(X_MAX_LENGTH >= X_BED_SIZE && Y_MAX_LENGTH >= Y_BED_SIZE,
   #error "You must set DISPLAY_CHARSET_HD44780 to JAPANESE, WESTERN or CYRILLIC for your LCD controller."
 #endif
 
+/**
+ * ST7920 dirty rows
+ */
+#if ENABLED(ST7920_DIRTY_ROWS) && DISABLED(U8GLIB_ST7920)
+  #error "ST7920_DIRTY_ROWS requires an ST7920 display (e.g., REPRAP_DISCOUNT_FULL_GRAPHIC_SMART_CONTROLLER)."
+#endif
+
+#if ENABLED(DOGM_HARDWARE_SPI) && (ENABLED(REPRAPWORLD_GRAPHICAL_LCD) || (DISABLED(U8GLIB_ST7920) && DISABLED(U8GLIB_ST7565_64128N)))
+  #error "DOGM_HARDWARE_SPI requires an ST7920 or ST7565 (64128N) display."
+#endif
+
 /**
  * Bed Heating Options - PID vs Limit Switching
  */
@@ -549,6 +560,19 @@ static_assert(X_MAX_LENGTH >= X_BED_SIZE && Y_MAX_LENGTH >= Y_BED_SIZE,
   #error "To use BED_LIMIT_SWITCHING you must disable PIDTEMPBED."
 #endif
 
+/**
+ * Hotend Model Predictive Control
+ */
+#if ENABLED(MPC_HOTEND)
+  #if DISABLED(PIDTEMP)
+    #error "MPC_HOTEND requires PIDTEMP."
+  #elif ENABLED(PID_EXTRUSION_SCALING)
+    #error "MPC_HOTEND already compensates for extrusion. Disable PID_EXTRUSION_SCALING."
+  #elif ENABLED(PID_OPENLOOP)
+    #error "MPC_HOTEND is not compatible with PID_OPENLOOP."
+  #endif
+#endif
+
 /**
  * Kinematics
  */
@@ -599,6 +623,10 @@ static_assert(1 >= 0
     #error "ENABLE_LEVELING_FADE_HEIGHT on DELTA requires AUTO_BED_LEVELING_BILINEAR or AUTO_BED_LEVELING_UBL."
   #elif ENABLED(DELTA_AUTO_CALIBRATION) && !(HAS_BED_PROBE || ENABLED(ULTIPANEL))
     #error "DELTA_AUTO_CALIBRATION requires a probe or LCD Controller."
+  #elif ENABLED(DELTA_CALIBRATION_LEAST_SQUARES) && DISABLED(DELTA_AUTO_CALIBRATION)
+    #error "DELTA_CALIBRATION_LEAST_SQUARES requires DELTA_AUTO_CALIBRATION."
+  #elif ENABLED(DELTA_CALIBRATION_LEAST_SQUARES) && !WITHIN(DELTA_LSQ_MAX_RING_POINTS, 6, 48)
+    #error "DELTA_LSQ_MAX_RING_POINTS must be from 6 to 48."
   #elif ABL_GRID
     #if (GRID_MAX_POINTS_X & 1) == 0 || (GRID_MAX_POINTS_Y & 1) == 0
       #error "DELTA requires GRID_MAX_POINTS_X and GRID_MAX_POINTS_Y to be odd numbers."
@@ -608,6 +636,35 @@ static_assert(1 >= 0
   #endif
 #endif
 
+/**
+ * Chord error segmentation
+ */
+#if ENABLED(KINEMATIC_CHORD_SEGMENTS)
+  #if !IS_KINEMATIC
+    #error "KINEMATIC_CHORD_SEGMENTS requires DELTA, MORGAN_SCARA or MAKERARM_SCARA."
+  #elif UBL_DELTA
+    #error "KINEMATIC_CHORD_SEGMENTS is not compatible with AUTO_BED_LEVELING_UBL."
+  #endif
+#endif
+
+#ifdef LEVELED_SEGMENT_ERROR
+  #if IS_KINEMATIC
+    #error "LEVELED_SEGMENT_ERROR is for Cartesian machines. Use KINEMATIC_CHORD_SEGMENTS instead."
+  #elif DISABLED(MESH_BED_LEVELING) && DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "LEVELED_SEGMENT_ERROR requires MESH_BED_LEVELING or AUTO_BED_LEVELING_BILINEAR."
+  #endif
+#endif
+
+#if ENABLED(MESH_BICUBIC_INTERPOLATION)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR) && DISABLED(AUTO_BED_LEVELING_UBL)
+    #error "MESH_BICUBIC_INTERPOLATION requires AUTO_BED_LEVELING_BILINEAR or AUTO_BED_LEVELING_UBL."
+  #elif ENABLED(ABL_BILINEAR_SUBDIVISION)
+    #error "MESH_BICUBIC_INTERPOLATION and ABL_BILINEAR_SUBDIVISION are incompatible. Enable only one."
+  #elif IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+    #error "MESH_BICUBIC_INTERPOLATION requires SEGMENT_LEVELED_MOVES on Cartesian machines."
+  #endif
+#endif
+
 /**
  * Probes
  */
@@ -705,6 +762,32 @@ static_assert(1 >= 0
     #error "Probes need Z_CLEARANCE_BETWEEN_PROBES >= 0."
   #endif
 
+  /**
+   * On-the-fly mesh probing
+   */
+  #if ENABLED(PROBE_ON_THE_FLY)
+    #if !ABL_GRID && DISABLED(AUTO_BED_LEVELING_UBL)
+      #error "PROBE_ON_THE_FLY requires AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR, or AUTO_BED_LEVELING_UBL."
+    #endif
+    static_assert(PROBE_PREDICT_MARGIN > 0 && PROBE_PREDICT_MARGIN < Z_CLEARANCE_BETWEEN_PROBES, "PROBE_PREDICT_MARGIN must be greater than 0 and less than Z_CLEARANCE_BETWEEN_PROBES.");
+  #endif
+
+  /**
+   * Adaptive probe sampling
+   */
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+    #if PROBE_SAMPLES_MIN < 1
+      #error "PROBE_SAMPLES_MIN must be at least 1."
+    #elif PROBE_SAMPLES_MAX < PROBE_SAMPLES_MIN || PROBE_SAMPLES_MAX < 2
+      #error "PROBE_SAMPLES_MAX must be at least 2 and no less than PROBE_SAMPLES_MIN."
+    #elif PROBE_SAMPLES_MAX > 10
+      #error "PROBE_SAMPLES_MAX must be 10 or less."
+    #endif
+    static_assert(PROBE_SAMPLE_TOLERANCE > 0, "PROBE_SAMPLE_TOLERANCE must be greater than 0.");
+    static_assert(PROBE_OUTLIER_LIMIT > 0, "PROBE_OUTLIER_LIMIT must be greater than 0.");
+    static_assert(PROBE_SAMPLE_LIFT > 0, "PROBE_SAMPLE_LIFT must be greater than 0.");
+  #endif
+
 #else
 
   /**
@@ -718,6 +801,14 @@ static_assert(1 >= 0
     #error "Z_MIN_PROBE_REPEATABILITY_TEST requires a probe: FIX_MOUNTED_PROBE, BLTOUCH, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or Z Servo."
   #endif
 
+  #if ENABLED(PROBE_ON_THE_FLY)
+    #error "PROBE_ON_THE_FLY requires a probe: FIX_MOUNTED_PROBE, BLTOUCH, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or Z Servo."
+  #endif
+
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+    #error "PROBE_ADAPTIVE_SAMPLING requires a probe: FIX_MOUNTED_PROBE, BLTOUCH, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or Z Servo."
+  #endif
+
 #endif
 
 /**
@@ -895,6 +986,35 @@ static_assert(1 >= 0
   #error "FILAMENT_WIDTH_SENSOR requires a FILWIDTH_PIN to be defined."
 #endif
 
+/**
+ * Continuous ADC Scan
+ */
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+  #if ENABLED(ADC_KEYPAD)
+    #error "ADC_CONTINUOUS_SCAN is not compatible with ADC_KEYPAD."
+  #elif defined(ADC_SCAN_LOWPASS_K_VALUE) && (ADC_SCAN_LOWPASS_K_VALUE < 0 || ADC_SCAN_LOWPASS_K_VALUE > 8)
+    #error "ADC_SCAN_LOWPASS_K_VALUE must be between 0 and 8."
+  #endif
+#endif
+
+/**
+ * Hardware PWM Heaters
+ */
+#if ENABLED(HARDWARE_PWM_HEATERS) && ENABLED(SLOW_PWM_HEATERS)
+  #error "HARDWARE_PWM_HEATERS is not compatible with SLOW_PWM_HEATERS."
+#endif
+
+/**
+ * Heater power budget
+ */
+#if ENABLED(HEATER_POWER_BUDGET)
+  #if ENABLED(SLOW_PWM_HEATERS)
+    #error "HEATER_POWER_BUDGET is not compatible with SLOW_PWM_HEATERS."
+  #elif HAS_HEATER_BED && BED_HEATER_WATTS > HEATER_BUDGET_WATTS
+    #error "BED_HEATER_WATTS must not exceed HEATER_BUDGET_WATTS or the bed will never heat."
+  #endif
+#endif
+
 /**
  * ULTIPANEL encoder
  */
@@ -1480,6 +1600,10 @@ static_assert(COUNT(sanity_arr_3) <= XYZE_N, "DEFAULT_MAX_ACCELERATION has too m
   #error "BLOCK_BUFFER_SIZE must be a power of 2."
 #endif
 
+#if ENABLED(STEP_TRACE) && (!IS_POWER_OF_2(STEP_TRACE_SIZE) || !IS_POWER_OF_2(STEP_TRACE_BLOCKS))
+  #error "STEP_TRACE_SIZE and STEP_TRACE_BLOCKS must be powers of 2."
+#endif
+
 #if ENABLED(LED_CONTROL_MENU) && DISABLED(ULTIPANEL)
   #error "LED_CONTROL_MENU requires an LCD controller."
 #endif
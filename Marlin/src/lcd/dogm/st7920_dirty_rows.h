@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016, 2017 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * ST7920 dirty-row tracking
+ *
+ * The ST7920 is addressed a row at a time, and most frames change only
+ * a few digits. Keep a CRC of every row sent to the display and skip the
+ * rows that haven't changed. A full frame is resent every so often in
+ * case noise on the cable has garbled the display.
+ */
+
+#ifndef _ST7920_DIRTY_ROWS_H_
+#define _ST7920_DIRTY_ROWS_H_
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(ST7920_DIRTY_ROWS)
+
+#define ST7920_ROWS 64
+#define ST7920_REFRESH_FRAMES 16 // Resend every row once in this many frames
+
+// Defined in u8g_dev_st7920_128x64_HAL.cpp
+extern uint16_t st7920_row_crc[ST7920_ROWS];
+extern uint8_t st7920_frame_count;
+
+// Resend every row in the next frame
+inline void st7920_rows_invalidate() { st7920_frame_count = ST7920_REFRESH_FRAMES - 1; }
+
+// Call for each page. The frame count advances on the top page.
+inline void st7920_rows_page(const uint8_t page_y0) {
+  if (page_y0 == 0 && ++st7920_frame_count >= ST7920_REFRESH_FRAMES) st7920_frame_count = 0;
+}
+
+// Return true if row 'y' must be sent, and remember its CRC
+inline bool st7920_row_changed(const uint8_t y, const uint8_t *row, const uint8_t len) {
+  uint16_t crc = 0xFFFF;
+  for (uint8_t i = 0; i < len; i++) {   // CRC-CCITT, as _crc_ccitt_update in avr-libc
+    uint8_t d = row[i] ^ (uint8_t)crc;
+    d ^= d << 4;
+    crc = (((uint16_t)d << 8) | (crc >> 8)) ^ (uint8_t)(d >> 4) ^ ((uint16_t)d << 3);
+  }
+  if (st7920_frame_count && crc == st7920_row_crc[y]) return false;
+  st7920_row_crc[y] = crc;
+  return true;
+}
+
+#endif // ST7920_DIRTY_ROWS
+
+#endif // _ST7920_DIRTY_ROWS_H_
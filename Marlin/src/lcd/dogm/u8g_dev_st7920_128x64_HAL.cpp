@@ -63,6 +63,13 @@
 #include <U8glib.h>
 
 #include "HAL_LCD_com_defines.h"
+#include "st7920_dirty_rows.h"
+
+#if ENABLED(ST7920_DIRTY_ROWS)
+  // The one copy, also used by ultralcd_st7920_u8glib_rrd_AVR.cpp
+  uint16_t st7920_row_crc[ST7920_ROWS];
+  uint8_t st7920_frame_count;
+#endif
 
 #define WIDTH 128
 #define HEIGHT 64
@@ -96,6 +103,9 @@ uint8_t u8g_dev_st7920_128x64_HAL_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_400NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7920_128x64_HAL_init_seq);
+      #if ENABLED(ST7920_DIRTY_ROWS)
+        st7920_rows_invalidate();
+      #endif
       break;
     case U8G_DEV_MSG_STOP:
       break;
@@ -109,8 +119,18 @@ uint8_t u8g_dev_st7920_128x64_HAL_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
         u8g_SetChipSelect(u8g, dev, 1);
         y = pb->p.page_y0;
         ptr = (uint8_t *)pb->buf;
+        #if ENABLED(ST7920_DIRTY_ROWS)
+          st7920_rows_page(y);
+        #endif
         for( i = 0; i < 8; i ++ )
         {
+          #if ENABLED(ST7920_DIRTY_ROWS)
+            if (!st7920_row_changed(y, ptr, WIDTH/8)) {
+              ptr += WIDTH/8;
+              y++;
+              continue;
+            }
+          #endif
           u8g_SetAddress(u8g, dev, 0);           /* cmd mode */
           u8g_WriteByte(u8g, dev, 0x03e );      /* enable extended mode */
 
@@ -144,6 +164,9 @@ uint8_t u8g_dev_st7920_128x64_HAL_4x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_400NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7920_128x64_HAL_init_seq);
+      #if ENABLED(ST7920_DIRTY_ROWS)
+        st7920_rows_invalidate();
+      #endif
       break;
 
     case U8G_DEV_MSG_STOP:
@@ -159,8 +182,18 @@ uint8_t u8g_dev_st7920_128x64_HAL_4x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
         u8g_SetChipSelect(u8g, dev, 1);
         y = pb->p.page_y0;
         ptr = (uint8_t *)pb->buf;
+        #if ENABLED(ST7920_DIRTY_ROWS)
+          st7920_rows_page(y);
+        #endif
         for( i = 0; i < 32; i ++ )
         {
+          #if ENABLED(ST7920_DIRTY_ROWS)
+            if (!st7920_row_changed(y, ptr, WIDTH/8)) {
+              ptr += WIDTH/8;
+              y++;
+              continue;
+            }
+          #endif
           u8g_SetAddress(u8g, dev, 0);           /* cmd mode */
           u8g_WriteByte(u8g, dev, 0x03e );      /* enable extended mode */
 
@@ -41,6 +41,7 @@
 #define LCD_PIXEL_HEIGHT 64
 
 #include <U8glib.h>
+#include "st7920_dirty_rows.h"
 
 //set optimization so ARDUINO optimizes this file
 #pragma GCC optimize (3)
@@ -135,6 +136,10 @@ uint8_t u8g_dev_rrd_st7920_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
       ST7920_WRITE_NIBBLES(0x0C); //display on, cursor+blink off
 
       ST7920_NCS();
+
+      #if ENABLED(ST7920_DIRTY_ROWS)
+        st7920_rows_invalidate();
+      #endif
     }
     break;
 
@@ -146,8 +151,19 @@ uint8_t u8g_dev_rrd_st7920_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
       y = pb->p.page_y0;
       ptr = (uint8_t*)pb->buf;
 
+      #if ENABLED(ST7920_DIRTY_ROWS)
+        st7920_rows_page(y);
+      #endif
+
       ST7920_CS();
       for (i = 0; i < PAGE_HEIGHT; i ++) {
+        #if ENABLED(ST7920_DIRTY_ROWS)
+          if (!st7920_row_changed(y, ptr, (LCD_PIXEL_WIDTH) / 8)) {
+            ptr += (LCD_PIXEL_WIDTH) / 8;
+            y++;
+            continue;
+          }
+        #endif
         ST7920_SET_CMD();
         if (y < 32) {
           ST7920_WRITE_NIBBLES(0x80 | y);       //y
@@ -51,6 +51,10 @@
   #include "../module/endstops.h"
 #endif
 
+#if ENABLED(CPU_PROFILER)
+  #include "../feature/profiler.h"
+#endif
+
 #if HAS_LEVELING
   #include "../feature/bedlevel/bedlevel.h"
 #endif
@@ -4598,6 +4602,10 @@ bool lcd_blink() {
  */
 void lcd_update() {
 
+  #if ENABLED(CPU_PROFILER)
+    ProfileScope profile(PROFILE_LCD_UPDATE);
+  #endif
+
   #if ENABLED(ULTIPANEL)
     static millis_t return_to_status_ms = 0;
 
@@ -4736,7 +4744,7 @@ void lcd_update() {
           + 3
         #endif
       ;
-      max_display_update_time--;
+      if (max_display_update_time) max_display_update_time--;
       lcdDrawUpdate = LCDVIEW_REDRAW_NOW;
     }
 
@@ -4754,13 +4762,30 @@ void lcd_update() {
     // then we want to use 1/2 of the time only.
     uint16_t bbr2 = planner.block_buffer_runtime() >> 1;
 
+    // Only an empty planner has nothing to lose. A nearly empty one has
+    // a runtime that rounds to zero, but is the worst time to draw.
+    bool planner_has_time = !planner.movesplanned() || bbr2 > max_display_update_time;
+
     #if ENABLED(DOGLCD)
       #define IS_DRAWING drawing_screen
     #else
       #define IS_DRAWING false
     #endif
 
-    if ((lcdDrawUpdate || IS_DRAWING) && (!bbr2 || bbr2 > max_display_update_time)) {
+    // Don't put a redraw off forever, or the screen and its handler would
+    // never run while a print keeps the planner short of time.
+    static uint8_t deferred_updates = 0;
+    if (planner_has_time || !(lcdDrawUpdate || IS_DRAWING))
+      deferred_updates = 0;
+    else if (++deferred_updates > LCD_MAX_DEFERRED_UPDATES) {
+      deferred_updates = 0;
+      planner_has_time = true;
+    }
+
+    if ((lcdDrawUpdate || IS_DRAWING) && planner_has_time) {
+
+      // Time only the drawing, which is what has to fit in the planner's time
+      const millis_t draw_ms = millis();
 
       if (!IS_DRAWING) switch (lcdDrawUpdate) {
         case LCDVIEW_CALL_NO_REDRAW:
@@ -4793,11 +4818,15 @@ void lcd_update() {
         u8g.setColorIndex(1);                         // And reset the color
         CURRENTSCREEN();                              // Draw and process the current screen
 
+        #if ENABLED(DOGM_HARDWARE_SPI)
+          spiInit(DOGM_SPI_RATE);                     // The SD card may have used the bus since the last page
+        #endif
+
         // The screen handler can clear drawing_screen for an action that changes the screen.
         // If still drawing and there's another page, update max-time and return now.
         // The nextPage will already be set up on the next call.
         if (drawing_screen && (drawing_screen = u8g.nextPage())) {
-          NOLESS(max_display_update_time, millis() - ms);
+          NOLESS(max_display_update_time, millis() - draw_ms);
           return;
         }
       #else
@@ -4806,7 +4835,7 @@ void lcd_update() {
 
       // Keeping track of the longest time for an individual LCD update.
       // Used to do screen throttling when the planner starts to fill up.
-      NOLESS(max_display_update_time, millis() - ms);
+      NOLESS(max_display_update_time, millis() - draw_ms);
     }
 
     #if ENABLED(ULTIPANEL)
@@ -4826,7 +4855,7 @@ void lcd_update() {
         lcdDrawUpdate = LCDVIEW_REDRAW_NOW;
         break;
       case LCDVIEW_REDRAW_NOW:
-        lcdDrawUpdate = LCDVIEW_NONE;
+        if (planner_has_time) lcdDrawUpdate = LCDVIEW_NONE; // Keep a deferred redraw for later
         break;
       case LCDVIEW_NONE:
         break;
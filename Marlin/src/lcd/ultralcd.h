@@ -89,6 +89,7 @@
   #endif
 
   #define LCD_UPDATE_INTERVAL 100
+  #define LCD_MAX_DEFERRED_UPDATES 10 // Draw anyway after this many updates waiting on the planner
 
   #if ENABLED(ULTIPANEL)
 
@@ -41,7 +41,9 @@ void print_hex_byte(const uint8_t b);
 void print_hex_word(const uint16_t w);
 void print_hex_address(const void * const w);
 
-#ifdef CPU_32_BIT
+#ifdef __PLAT_LINUX__
+  typedef uintptr_t ptr_int_t;
+#elif defined(CPU_32_BIT)
   typedef uint32_t ptr_int_t;
 #else
   typedef uint16_t ptr_int_t;
@@ -26,9 +26,11 @@
  * Settings and EEPROM storage
  *
  * IMPORTANT:  Whenever there are changes made to the variables stored in EEPROM
- * in the functions below, also increment the version number. This makes sure that
- * the default values are used whenever there is a change to the data, to prevent
- * wrong data being written to the variables.
+ * in the functions below, also increment the version number of the record that
+ * holds them (see record_version). This makes sure that the default values are
+ * used whenever there is a change to the data, to prevent wrong data being written
+ * to the variables. Other records keep loading. EEPROM_VERSION only needs to change
+ * when the header or record framing changes.
  *
  * ALSO: Variables in the Store and Retrieve sections must be in the same order.
  *       If a feature is disabled, some data must still be written that, when read,
@@ -36,147 +38,178 @@
  *
  */
 
-#define EEPROM_VERSION "V46"
+#define EEPROM_VERSION "V48"
 
 // Change EEPROM version if these are changed:
 #define EEPROM_OFFSET 100
 
 /**
- * V46 EEPROM Layout:
+ * V48 EEPROM Layout:
  *
  *  100  Version                                    (char x4)
- *  104  EEPROM CRC16                               (uint16_t)
+ *  104  Size of all the records                    (uint16_t)
  *
- *  106            E_STEPPERS                       (uint8_t)
- *  107  M92 XYZE  planner.axis_steps_per_mm        (float x4 ... x8) + 64
- *  123  M203 XYZE planner.max_feedrate_mm_s        (float x4 ... x8) + 64
- *  139  M201 XYZE planner.max_acceleration_mm_per_s2 (uint32_t x4 ... x8) + 64
- *  155  M204 P    planner.acceleration             (float)
- *  159  M204 R    planner.retract_acceleration     (float)
- *  163  M204 T    planner.travel_acceleration      (float)
- *  167  M205 S    planner.min_feedrate_mm_s        (float)
- *  171  M205 T    planner.min_travel_feedrate_mm_s (float)
- *  175  M205 B    planner.min_segment_time_us      (ulong)
- *  179  M205 X    planner.max_jerk[X_AXIS]         (float)
- *  183  M205 Y    planner.max_jerk[Y_AXIS]         (float)
- *  187  M205 Z    planner.max_jerk[Z_AXIS]         (float)
- *  191  M205 E    planner.max_jerk[E_AXIS]         (float)
- *  195  M206 XYZ  home_offset                      (float x3)
- *  207  M218 XYZ  hotend_offset                    (float x3 per additional hotend) +16
+ * Each record header holds the record's tag, version, data size and the
+ * CRC16 of its data. Offsets are for the smallest configuration.
  *
+ *  106  Record header: SR_STEPPERS                 (uint8_t x2, uint16_t x2)
+ *  112            E_STEPPERS                       (uint8_t)
+ *  113  M92 XYZE  planner.axis_steps_per_mm        (float x4 ... x8) + 64
+ *  129  M203 XYZE planner.max_feedrate_mm_s        (float x4 ... x8) + 64
+ *  145  M201 XYZE planner.max_acceleration_mm_per_s2 (uint32_t x4 ... x8) + 64
+ *
+ *  161  Record header: SR_MOTION                   (uint8_t x2, uint16_t x2)
+ *  167  M204 P    planner.acceleration             (float)
+ *  171  M204 R    planner.retract_acceleration     (float)
+ *  175  M204 T    planner.travel_acceleration      (float)
+ *  179  M205 S    planner.min_feedrate_mm_s        (float)
+ *  183  M205 T    planner.min_travel_feedrate_mm_s (float)
+ *  187  M205 B    planner.min_segment_time_us      (ulong)
+ *  191  M205 X    planner.max_jerk[X_AXIS]         (float)
+ *  195  M205 Y    planner.max_jerk[Y_AXIS]         (float)
+ *  199  M205 Z    planner.max_jerk[Z_AXIS]         (float)
+ *  203  M205 E    planner.max_jerk[E_AXIS]         (float)
+ *  207  M206 XYZ  home_offset                      (float x3)
+ *  219  M218 XYZ  hotend_offset                    (float x3 per additional hotend) +16
+ *
+ *  231  Record header: SR_LEVELING                 (uint8_t x2, uint16_t x2)
  * Global Leveling:                                 4 bytes
- *  219            z_fade_height                    (float)
+ *  237            z_fade_height                    (float)
  *
  * MESH_BED_LEVELING:                               43 bytes
- *  223  M420 S    planner.leveling_active          (bool)
- *  224            mbl.z_offset                     (float)
- *  228            GRID_MAX_POINTS_X                (uint8_t)
- *  229            GRID_MAX_POINTS_Y                (uint8_t)
- *  230 G29 S3 XYZ z_values[][]                     (float x9, up to float x81) +288
+ *  241  M420 S    planner.leveling_active          (bool)
+ *  242            mbl.z_offset                     (float)
+ *  246            GRID_MAX_POINTS_X                (uint8_t)
+ *  247            GRID_MAX_POINTS_Y                (uint8_t)
+ *  248 G29 S3 XYZ z_values[][]                     (float x9, up to float x81) +288
  *
  * HAS_BED_PROBE:                                   4 bytes
- *  266  M851      zprobe_zoffset                   (float)
+ *  284  M851      zprobe_zoffset                   (float)
  *
  * ABL_PLANAR:                                      36 bytes
- *  270            planner.bed_level_matrix         (matrix_3x3 = float x9)
+ *  288            planner.bed_level_matrix         (matrix_3x3 = float x9)
  *
  * AUTO_BED_LEVELING_BILINEAR:                      46 bytes
- *  306            GRID_MAX_POINTS_X                (uint8_t)
- *  307            GRID_MAX_POINTS_Y                (uint8_t)
- *  308            bilinear_grid_spacing            (int x2)
- *  312  G29 L F   bilinear_start                   (int x2)
- *  316            z_values[][]                     (float x9, up to float x256) +988
+ *  324            GRID_MAX_POINTS_X                (uint8_t)
+ *  325            GRID_MAX_POINTS_Y                (uint8_t)
+ *  326            bilinear_grid_spacing            (int x2)
+ *  330  G29 L F   bilinear_start                   (int x2)
+ *  334            z_values[][]                     (float x9, up to float x256) +988
  *
  * AUTO_BED_LEVELING_UBL:                           2 bytes
- *  352  G29 A     planner.leveling_active          (bool)
- *  353  G29 S     ubl.storage_slot                 (int8_t)
+ *  370  G29 A     planner.leveling_active          (bool)
+ *  371  G29 S     ubl.storage_slot                 (int8_t)
  *
- * DELTA:                                           44 bytes
- *  354  M666 H    delta_height                     (float)
- *  358  M666 XYZ  delta_endstop_adj                (float x3)
- *  370  M665 R    delta_radius                     (float)
- *  374  M665 L    delta_diagonal_rod               (float)
- *  378  M665 S    delta_segments_per_second        (float)
- *  382  M665 B    delta_calibration_radius         (float)
- *  386  M665 X    delta_tower_angle_trim[A]        (float)
- *  390  M665 Y    delta_tower_angle_trim[B]        (float)
- *  394  M665 Z    delta_tower_angle_trim[C]        (float)
+ *  372  Record header: SR_DELTA                    (uint8_t x2, uint16_t x2)
+ * DELTA:                                           56 bytes
+ *  378  M666 H    delta_height                     (float)
+ *  382  M666 XYZ  delta_endstop_adj                (float x3)
+ *  394  M665 R    delta_radius                     (float)
+ *  398  M665 L    delta_diagonal_rod               (float)
+ *  402  M665 S    delta_segments_per_second        (float)
+ *  406  M665 B    delta_calibration_radius         (float)
+ *  410  M665 X    delta_tower_angle_trim[A]        (float)
+ *  414  M665 Y    delta_tower_angle_trim[B]        (float)
+ *  418  M665 Z    delta_tower_angle_trim[C]        (float)
+ *  422  M665 I    delta_diagonal_rod_trim[A]       (float)
+ *  426  M665 J    delta_diagonal_rod_trim[B]       (float)
+ *  430  M665 K    delta_diagonal_rod_trim[C]       (float)
  *
  * [XYZ]_DUAL_ENDSTOPS:                             12 bytes
- *  354  M666 X    x_endstop_adj                    (float)
- *  358  M666 Y    y_endstop_adj                    (float)
- *  362  M666 Z    z_endstop_adj                    (float)
+ *  378  M666 X    x_endstop_adj                    (float)
+ *  382  M666 Y    y_endstop_adj                    (float)
+ *  386  M666 Z    z_endstop_adj                    (float)
  *
+ *  434  Record header: SR_PREHEAT                  (uint8_t x2, uint16_t x2)
  * ULTIPANEL:                                       6 bytes
- *  398  M145 S0 H lcd_preheat_hotend_temp          (int x2)
- *  402  M145 S0 B lcd_preheat_bed_temp             (int x2)
- *  406  M145 S0 F lcd_preheat_fan_speed            (int x2)
+ *  440  M145 S0 H lcd_preheat_hotend_temp          (int x2)
+ *  444  M145 S0 B lcd_preheat_bed_temp             (int x2)
+ *  448  M145 S0 F lcd_preheat_fan_speed            (int x2)
  *
+ *  452  Record header: SR_TEMPERATURE              (uint8_t x2, uint16_t x2)
  * PIDTEMP:                                         82 bytes
- *  410  M301 E0 PIDC  Kp[0], Ki[0], Kd[0], Kc[0]   (float x4)
- *  426  M301 E1 PIDC  Kp[1], Ki[1], Kd[1], Kc[1]   (float x4)
- *  442  M301 E2 PIDC  Kp[2], Ki[2], Kd[2], Kc[2]   (float x4)
- *  458  M301 E3 PIDC  Kp[3], Ki[3], Kd[3], Kc[3]   (float x4)
- *  474  M301 E4 PIDC  Kp[3], Ki[3], Kd[3], Kc[3]   (float x4)
- *  490  M301 L        lpq_len                      (int)
+ *  458  M301 E0 PIDC  Kp[0], Ki[0], Kd[0], Kc[0]   (float x4)
+ *  474  M301 E1 PIDC  Kp[1], Ki[1], Kd[1], Kc[1]   (float x4)
+ *  490  M301 E2 PIDC  Kp[2], Ki[2], Kd[2], Kc[2]   (float x4)
+ *  506  M301 E3 PIDC  Kp[3], Ki[3], Kd[3], Kc[3]   (float x4)
+ *  522  M301 E4 PIDC  Kp[3], Ki[3], Kd[3], Kc[3]   (float x4)
+ *  538  M301 L        lpq_len                      (int)
  *
  * PIDTEMPBED:                                      12 bytes
- *  492  M304 PID  bedKp, .bedKi, .bedKd            (float x3)
+ *  540  M304 PID  bedKp, .bedKi, .bedKd            (float x3)
+ *
+ * MPC_HOTEND:                                      120 bytes
+ *  552  M306 E0 PCRAHT thermalManager.mpc[0]       (float x6)
+ *  576  M306 E1 PCRAHT thermalManager.mpc[1]       (float x6)
+ *  600  M306 E2 PCRAHT thermalManager.mpc[2]       (float x6)
+ *  624  M306 E3 PCRAHT thermalManager.mpc[3]       (float x6)
+ *  648  M306 E4 PCRAHT thermalManager.mpc[4]       (float x6)
  *
+ *  672  Record header: SR_LCD_CONTRAST             (uint8_t x2, uint16_t x2)
  * DOGLCD:                                          2 bytes
- *  504  M250 C    lcd_contrast                     (uint16_t)
+ *  678  M250 C    lcd_contrast                     (uint16_t)
  *
+ *  680  Record header: SR_RETRACT                  (uint8_t x2, uint16_t x2)
  * FWRETRACT:                                       33 bytes
- *  506  M209 S    autoretract_enabled              (bool)
- *  507  M207 S    retract_length                   (float)
- *  511  M207 F    retract_feedrate_mm_s            (float)
- *  515  M207 Z    retract_zlift                    (float)
- *  519  M208 S    retract_recover_length           (float)
- *  523  M208 F    retract_recover_feedrate_mm_s    (float)
- *  527  M207 W    swap_retract_length              (float)
- *  531  M208 W    swap_retract_recover_length      (float)
- *  535  M208 R    swap_retract_recover_feedrate_mm_s (float)
+ *  686  M209 S    autoretract_enabled              (bool)
+ *  687  M207 S    retract_length                   (float)
+ *  691  M207 F    retract_feedrate_mm_s            (float)
+ *  695  M207 Z    retract_zlift                    (float)
+ *  699  M208 S    retract_recover_length           (float)
+ *  703  M208 F    retract_recover_feedrate_mm_s    (float)
+ *  707  M207 W    swap_retract_length              (float)
+ *  711  M208 W    swap_retract_recover_length      (float)
+ *  715  M208 R    swap_retract_recover_feedrate_mm_s (float)
  *
+ *  719  Record header: SR_FILAMENT                 (uint8_t x2, uint16_t x2)
  * Volumetric Extrusion:                            21 bytes
- *  539  M200 D    parser.volumetric_enabled        (bool)
- *  540  M200 T D  planner.filament_size            (float x5) (T0..3)
+ *  725  M200 D    parser.volumetric_enabled        (bool)
+ *  726  M200 T D  planner.filament_size            (float x5) (T0..3)
  *
+ *  746  Record header: SR_TMC_CURRENT              (uint8_t x2, uint16_t x2)
  * HAVE_TMC2130:                                    22 bytes
- *  560  M906 X    Stepper X current                (uint16_t)
- *  562  M906 Y    Stepper Y current                (uint16_t)
- *  564  M906 Z    Stepper Z current                (uint16_t)
- *  566  M906 X2   Stepper X2 current               (uint16_t)
- *  568  M906 Y2   Stepper Y2 current               (uint16_t)
- *  570  M906 Z2   Stepper Z2 current               (uint16_t)
- *  572  M906 E0   Stepper E0 current               (uint16_t)
- *  574  M906 E1   Stepper E1 current               (uint16_t)
- *  576  M906 E2   Stepper E2 current               (uint16_t)
- *  578  M906 E3   Stepper E3 current               (uint16_t)
- *  580  M906 E4   Stepper E4 current               (uint16_t)
+ *  752  M906 X    Stepper X current                (uint16_t)
+ *  754  M906 Y    Stepper Y current                (uint16_t)
+ *  756  M906 Z    Stepper Z current                (uint16_t)
+ *  758  M906 X2   Stepper X2 current               (uint16_t)
+ *  760  M906 Y2   Stepper Y2 current               (uint16_t)
+ *  762  M906 Z2   Stepper Z2 current               (uint16_t)
+ *  764  M906 E0   Stepper E0 current               (uint16_t)
+ *  766  M906 E1   Stepper E1 current               (uint16_t)
+ *  768  M906 E2   Stepper E2 current               (uint16_t)
+ *  770  M906 E3   Stepper E3 current               (uint16_t)
+ *  772  M906 E4   Stepper E4 current               (uint16_t)
  *
+ *  774  Record header: SR_LIN_ADVANCE              (uint8_t x2, uint16_t x2)
  * LIN_ADVANCE:                                     8 bytes
- *  582  M900 K    extruder_advance_k               (float)
- *  586  M900 WHD  advance_ed_ratio                 (float)
+ *  780  M900 K    extruder_advance_k               (float)
+ *  784  M900 WHD  advance_ed_ratio                 (float)
  *
+ *  788  Record header: SR_MOTOR_CURRENT            (uint8_t x2, uint16_t x2)
  * HAS_MOTOR_CURRENT_PWM:
- *  590  M907 X    Stepper XY current               (uint32_t)
- *  594  M907 Z    Stepper Z current                (uint32_t)
- *  598  M907 E    Stepper E current                (uint32_t)
+ *  794  M907 X    Stepper XY current               (uint32_t)
+ *  798  M907 Z    Stepper Z current                (uint32_t)
+ *  802  M907 E    Stepper E current                (uint32_t)
  *
+ *  806  Record header: SR_COORDINATES              (uint8_t x2, uint16_t x2)
  * CNC_COORDINATE_SYSTEMS                           108 bytes
- *  602  G54-G59.3 coordinate_system                (float x 27)
+ *  812  G54-G59.3 coordinate_system                (float x 27)
  *
+ *  920  Record header: SR_SKEW                     (uint8_t x2, uint16_t x2)
  * SKEW_CORRECTION:                                 12 bytes
- *  710  M852 I    planner.xy_skew_factor           (float)
- *  714  M852 J    planner.xz_skew_factor           (float)
- *  718  M852 K    planner.yz_skew_factor           (float)
+ *  926  M852 I    planner.xy_skew_factor           (float)
+ *  930  M852 J    planner.xz_skew_factor           (float)
+ *  934  M852 K    planner.yz_skew_factor           (float)
  *
- *  722                                   Minimum end-point
- * 2251 (722 + 208 + 36 + 9 + 288 + 988)  Maximum end-point
+ *  938                                   Minimum end-point
+ * 2467 (938 + 208 + 36 + 9 + 288 + 988)  Maximum end-point
  *
  * ========================================================================
  * meshes_begin (between max and min end-point, directly above)
  * -- MESHES --
+ *   UBL_MESH_COMPRESSION: Each slot is the base plane (float x 3),
+ *   each point's height above the plane in microns (int16_t x GRID_MAX_POINTS),
+ *   and the slot's CRC (uint16_t)
  * meshes_end
  * -- MAT (Mesh Allocation Table) --                128 bytes (placeholder size)
  * mat_end = E2END (0xFFF)
@@ -198,6 +231,9 @@ MarlinSettings settings;
 
 #if HAS_LEVELING
   #include "../feature/bedlevel/bedlevel.h"
+  #if ENABLED(UBL_MESH_COMPRESSION)
+    #include "../libs/least_squares_fit.h"
+  #endif
 #endif
 
 #if HAS_BED_PROBE
@@ -280,7 +316,8 @@ void MarlinSettings::postprocess() {
   #define EEPROM_START() int eeprom_index = EEPROM_OFFSET; HAL::PersistentStore::access_start()
   #define EEPROM_FINISH() HAL::PersistentStore::access_finish()
   #define EEPROM_SKIP(VAR) eeprom_index += sizeof(VAR)
-  #define EEPROM_WRITE(VAR) HAL::PersistentStore::write_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc)
+  #define EEPROM_PUT(VAR) HAL::PersistentStore::write_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc)
+  #define EEPROM_WRITE(VAR) do{ if (record_writing) EEPROM_PUT(VAR); else EEPROM_SKIP(VAR); }while(0)
   #define EEPROM_READ(VAR) HAL::PersistentStore::read_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc)
   #define EEPROM_ASSERT(TST,ERR) if (!(TST)) do{ SERIAL_ERROR_START(); SERIAL_ERRORLNPGM(ERR); eeprom_read_error = true; }while(0)
 
@@ -293,22 +330,75 @@ void MarlinSettings::postprocess() {
   #endif
 
   /**
-   * M500 - Store Configuration
+   * Every record starts with this header. The CRC covers only the record's
+   * own data, so one record can be rewritten without touching the others.
    */
-  bool MarlinSettings::save() {
-    float dummy = 0.0f;
-    char ver[4] = "000";
+  typedef struct {
+    uint8_t tag, version;
+    uint16_t size, crc;
+  } record_header_t;
+
+  #define RECORDS_BEGIN (EEPROM_OFFSET + 6) // After the version string and the records size
+
+  // Bump a record's version whenever the data stored in it changes
+  static const uint8_t record_version[SR_COUNT] PROGMEM = {
+    0,
+    1,  // SR_STEPPERS
+    1,  // SR_MOTION
+    1,  // SR_LEVELING
+    1,  // SR_DELTA
+    1,  // SR_PREHEAT
+    2,  // SR_TEMPERATURE
+    1,  // SR_LCD_CONTRAST
+    1,  // SR_RETRACT
+    1,  // SR_FILAMENT
+    1,  // SR_TMC_CURRENT
+    1,  // SR_LIN_ADVANCE
+    1,  // SR_MOTOR_CURRENT
+    1,  // SR_COORDINATES
+    1   // SR_SKEW
+  };
+
+  // Records that describe their own grid and stepper counts, so they still load after those change
+  #define SELF_SIZING_RECORDS (_BV(SR_STEPPERS) | _BV(SR_LEVELING))
+  #define ALL_RECORDS ((uint16_t)((1UL << SR_COUNT) - 2))
+
+  static_assert(SR_COUNT <= 16, "Too many settings records for a 16-bit record mask.");
+
+  #define RECORD_BEGIN(TAG) do{ \
+    record_start = eeprom_index; \
+    eeprom_index += sizeof(record_header_t); \
+    working_crc = 0; \
+    record_writing = (only == SR_ALL || only == (TAG)); \
+  }while(0)
+
+  #define RECORD_END(TAG) record_end(TAG, record_start, eeprom_index, working_crc, record_writing, sizes)
+
+  static void record_end(const uint8_t tag, int pos, const int end, uint16_t crc, const bool writing, uint16_t sizes[SR_COUNT]) {
+    const uint16_t size = end - pos - sizeof(record_header_t);
+    if (sizes) sizes[tag] = size;
+    if (writing) {
+      record_header_t header;
+      header.tag = tag;
+      header.version = pgm_read_byte(&record_version[tag]);
+      header.size = size;
+      header.crc = crc;
+      HAL::PersistentStore::write_data(pos, (uint8_t*)&header, sizeof(header), &crc);
+    }
+  }
 
+  /**
+   * Write all the settings records, or only one, from eeprom_index onward.
+   * Records are written in tag order. With SR_MEASURE nothing is written
+   * and only the record sizes are filled in. Return the end of the records.
+   */
+  static int write_records(int eeprom_index, const uint8_t only, uint16_t sizes[SR_COUNT]=NULL) {
+    float dummy = 0.0f;
     uint16_t working_crc = 0;
+    int record_start;
+    bool record_writing;
 
-    EEPROM_START();
-
-    eeprom_error = false;
-
-    EEPROM_WRITE(ver);     // invalidate data first
-    EEPROM_SKIP(working_crc); // Skip the checksum slot
-
-    working_crc = 0;  // Init to 0. Accumulated by EEPROM_READ
+    RECORD_BEGIN(SR_STEPPERS);
 
     const uint8_t esteppers = COUNT(planner.axis_steps_per_mm) - XYZ;
     EEPROM_WRITE(esteppers);
@@ -317,6 +407,9 @@ void MarlinSettings::postprocess() {
     EEPROM_WRITE(planner.max_feedrate_mm_s);
     EEPROM_WRITE(planner.max_acceleration_mm_per_s2);
 
+    RECORD_END(SR_STEPPERS);
+    RECORD_BEGIN(SR_MOTION);
+
     EEPROM_WRITE(planner.acceleration);
     EEPROM_WRITE(planner.retract_acceleration);
     EEPROM_WRITE(planner.travel_acceleration);
@@ -335,6 +428,9 @@ void MarlinSettings::postprocess() {
         LOOP_XYZ(i) EEPROM_WRITE(hotend_offset[i][e]);
     #endif
 
+    RECORD_END(SR_MOTION);
+    RECORD_BEGIN(SR_LEVELING);
+
     //
     // Global Leveling
     //
@@ -427,7 +523,10 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(storage_slot);
     #endif // AUTO_BED_LEVELING_UBL
 
-    // 11 floats for DELTA / [XYZ]_DUAL_ENDSTOPS
+    RECORD_END(SR_LEVELING);
+    RECORD_BEGIN(SR_DELTA);
+
+    // 14 floats for DELTA / [XYZ]_DUAL_ENDSTOPS
     #if ENABLED(DELTA)
       EEPROM_WRITE(delta_height);              // 1 float
       EEPROM_WRITE(delta_endstop_adj);         // 3 floats
@@ -436,6 +535,7 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(delta_segments_per_second); // 1 float
       EEPROM_WRITE(delta_calibration_radius);  // 1 float
       EEPROM_WRITE(delta_tower_angle_trim);    // 3 floats
+      EEPROM_WRITE(delta_diagonal_rod_trim);   // 3 floats
 
     #elif ENABLED(X_DUAL_ENDSTOPS) || ENABLED(Y_DUAL_ENDSTOPS) || ENABLED(Z_DUAL_ENDSTOPS)
       // Write dual endstops in X, Y, Z order. Unused = 0.0
@@ -458,13 +558,16 @@ void MarlinSettings::postprocess() {
         EEPROM_WRITE(dummy);
       #endif
 
-      for (uint8_t q = 8; q--;) EEPROM_WRITE(dummy);
+      for (uint8_t q = 11; q--;) EEPROM_WRITE(dummy);
 
     #else
       dummy = 0.0f;
-      for (uint8_t q = 11; q--;) EEPROM_WRITE(dummy);
+      for (uint8_t q = 14; q--;) EEPROM_WRITE(dummy);
     #endif
 
+    RECORD_END(SR_DELTA);
+    RECORD_BEGIN(SR_PREHEAT);
+
     #if DISABLED(ULTIPANEL)
       constexpr int lcd_preheat_hotend_temp[2] = { PREHEAT_1_TEMP_HOTEND, PREHEAT_2_TEMP_HOTEND },
                     lcd_preheat_bed_temp[2] = { PREHEAT_1_TEMP_BED, PREHEAT_2_TEMP_BED },
@@ -475,6 +578,9 @@ void MarlinSettings::postprocess() {
     EEPROM_WRITE(lcd_preheat_bed_temp);
     EEPROM_WRITE(lcd_preheat_fan_speed);
 
+    RECORD_END(SR_PREHEAT);
+    RECORD_BEGIN(SR_TEMPERATURE);
+
     for (uint8_t e = 0; e < MAX_EXTRUDERS; e++) {
 
       #if ENABLED(PIDTEMP)
@@ -514,11 +620,38 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(thermalManager.bedKd);
     #endif
 
+    for (uint8_t e = 0; e < MAX_EXTRUDERS; e++) {
+      #if ENABLED(MPC_HOTEND)
+        if (e < HOTENDS) {
+          const Temperature::mpc_t &m = thermalManager.mpc[e];
+          EEPROM_WRITE(m.heater_power);
+          EEPROM_WRITE(m.block_heat_capacity);
+          EEPROM_WRITE(m.sensor_responsiveness);
+          EEPROM_WRITE(m.ambient_xfer_coeff);
+          EEPROM_WRITE(m.filament_heat_capacity_permm);
+          EEPROM_WRITE(m.ambient_temp);
+        }
+        else
+      #endif
+        {
+          dummy = DUMMY_PID_VALUE; // When read, will not change the existing value
+          EEPROM_WRITE(dummy); // heater_power
+          dummy = 0.0f;
+          for (uint8_t q = 5; q--;) EEPROM_WRITE(dummy);
+        }
+    }
+
+    RECORD_END(SR_TEMPERATURE);
+    RECORD_BEGIN(SR_LCD_CONTRAST);
+
     #if !HAS_LCD_CONTRAST
       const uint16_t lcd_contrast = 32;
     #endif
     EEPROM_WRITE(lcd_contrast);
 
+    RECORD_END(SR_LCD_CONTRAST);
+    RECORD_BEGIN(SR_RETRACT);
+
     #if DISABLED(FWRETRACT)
       const bool autoretract_enabled = false;
       const float autoretract_defaults[] = { 3, 45, 0, 0, 0, 13, 0, 8 };
@@ -536,6 +669,9 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(fwretract.swap_retract_recover_feedrate_mm_s);
     #endif
 
+    RECORD_END(SR_RETRACT);
+    RECORD_BEGIN(SR_FILAMENT);
+
     EEPROM_WRITE(parser.volumetric_enabled);
 
     // Save filament sizes
@@ -544,6 +680,9 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(dummy);
     }
 
+    RECORD_END(SR_FILAMENT);
+    RECORD_BEGIN(SR_TMC_CURRENT);
+
     // Save TMC2130 Configuration, and placeholder values
     uint16_t val;
     #if ENABLED(HAVE_TMC2130)
@@ -618,10 +757,13 @@ void MarlinSettings::postprocess() {
       for (uint8_t q = 11; q--;) EEPROM_WRITE(val);
     #endif
 
+    RECORD_END(SR_TMC_CURRENT);
+
     //
     // Linear Advance
     //
 
+    RECORD_BEGIN(SR_LIN_ADVANCE);
     #if ENABLED(LIN_ADVANCE)
       EEPROM_WRITE(planner.extruder_advance_k);
       EEPROM_WRITE(planner.advance_ed_ratio);
@@ -630,29 +772,35 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(dummy);
       EEPROM_WRITE(dummy);
     #endif
+    RECORD_END(SR_LIN_ADVANCE);
 
+    RECORD_BEGIN(SR_MOTOR_CURRENT);
     #if HAS_MOTOR_CURRENT_PWM
       for (uint8_t q = 3; q--;) EEPROM_WRITE(stepper.motor_current_setting[q]);
     #else
       const uint32_t dummyui32 = 0;
       for (uint8_t q = 3; q--;) EEPROM_WRITE(dummyui32);
     #endif
+    RECORD_END(SR_MOTOR_CURRENT);
 
     //
     // CNC Coordinate Systems
     //
 
+    RECORD_BEGIN(SR_COORDINATES);
     #if ENABLED(CNC_COORDINATE_SYSTEMS)
       EEPROM_WRITE(coordinate_system); // 27 floats
     #else
       dummy = 0.0f;
       for (uint8_t q = 27; q--;) EEPROM_WRITE(dummy);
     #endif
+    RECORD_END(SR_COORDINATES);
 
     //
     // Skew correction factors
     //
 
+    RECORD_BEGIN(SR_SKEW);
     #if ENABLED(SKEW_CORRECTION)
       EEPROM_WRITE(planner.xy_skew_factor);
       EEPROM_WRITE(planner.xz_skew_factor);
@@ -661,32 +809,133 @@ void MarlinSettings::postprocess() {
       dummy = 0.0f;
       for (uint8_t q = 3; q--;) EEPROM_WRITE(dummy);
     #endif
+    RECORD_END(SR_SKEW);
 
-    if (!eeprom_error) {
-      #if ENABLED(EEPROM_CHITCHAT)
-        const int eeprom_size = eeprom_index;
-      #endif
+    return eeprom_index;
+  }
 
-      const uint16_t final_crc = working_crc;
+  // Position of a record's header in a store written by this build
+  static int record_position(const uint16_t sizes[SR_COUNT], const uint8_t tag) {
+    int pos = RECORDS_BEGIN;
+    for (uint8_t t = 1; t < tag; t++) pos += sizeof(record_header_t) + sizes[t];
+    return pos;
+  }
 
-      // Write the EEPROM header
-      eeprom_index = EEPROM_OFFSET;
+  /**
+   * Find the stored records that this build can use, filling in the record
+   * sizes for this build and the positions of the usable stored records.
+   * A record is usable if its tag, version and CRC are good and its size
+   * matches. Self-sizing records may differ in size unless 'exact' is set.
+   * Return a bitmask of usable records, or 0 if the EEPROM version differs.
+   */
+  static uint16_t index_records(int positions[SR_COUNT], uint16_t sizes[SR_COUNT], const bool exact) {
+    write_records(RECORDS_BEGIN, SR_MEASURE, sizes);
 
-      EEPROM_WRITE(version);
-      EEPROM_WRITE(final_crc);
+    int pos = EEPROM_OFFSET;
+    char stored_ver[4];
+    uint16_t crc = 0, records_size;
+    HAL::PersistentStore::read_data(pos, (uint8_t*)stored_ver, sizeof(stored_ver), &crc);
+    HAL::PersistentStore::read_data(pos, (uint8_t*)&records_size, sizeof(records_size), &crc);
+    if (strncmp(version, stored_ver, 3) != 0) return 0;
+
+    uint16_t usable = 0;
+    const int end = pos + records_size;
+    while (pos + (int)sizeof(record_header_t) <= end) {
+      const int start = pos;
+      record_header_t header;
+      HAL::PersistentStore::read_data(pos, (uint8_t*)&header, sizeof(header), &crc);
+      if (pos + header.size > end) break;
+
+      // Check the record's CRC a few bytes at a time
+      crc = 0;
+      for (uint16_t n = header.size; n;) {
+        uint8_t chunk[16];
+        const uint8_t c = n > sizeof(chunk) ? sizeof(chunk) : n;
+        HAL::PersistentStore::read_data(pos, chunk, c, &crc);
+        n -= c;
+      }
 
-      // Report storage size
+      if (WITHIN(header.tag, 1, SR_COUNT - 1)
+        && header.version == pgm_read_byte(&record_version[header.tag])
+        && header.crc == crc
+        && (header.size == sizes[header.tag] || (!exact && TEST(SELF_SIZING_RECORDS, header.tag)))
+      ) {
+        positions[header.tag] = start;
+        SBI(usable, header.tag);
+      }
+    }
+    return usable;
+  }
+
+  /**
+   * M500 - Store Configuration
+   *
+   * With a record tag only that record is rewritten, in place, provided the
+   * stored record is good and sits where this build would put it. Otherwise
+   * all the records are written.
+   */
+  bool MarlinSettings::save(const uint8_t only/*=SR_ALL*/) {
+    uint16_t working_crc = 0;
+
+    EEPROM_START();
+
+    eeprom_error = false;
+
+    bool stored = false;
+    if (only != SR_ALL) {
+      uint16_t sizes[SR_COUNT];
+      int positions[SR_COUNT];
+      if (TEST(index_records(positions, sizes, true), only) && positions[only] == record_position(sizes, only)) {
+        write_records(RECORDS_BEGIN, only);
+        stored = true;
+        #if ENABLED(EEPROM_CHITCHAT)
+          SERIAL_ECHO_START();
+          SERIAL_ECHOPAIR("Settings record ", only);
+          SERIAL_ECHOPAIR(" stored (", sizes[only]);
+          SERIAL_ECHOLNPGM(" bytes)");
+        #endif
+      }
       #if ENABLED(EEPROM_CHITCHAT)
-        SERIAL_ECHO_START();
-        SERIAL_ECHOPAIR("Settings Stored (", eeprom_size - (EEPROM_OFFSET));
-        SERIAL_ECHOPAIR(" bytes; crc ", (uint32_t)final_crc);
-        SERIAL_ECHOLNPGM(")");
+        else {
+          SERIAL_ECHO_START();
+          SERIAL_ECHOLNPGM("Stored settings don't match, storing all records");
+        }
       #endif
     }
+
+    if (!stored) {
+      char ver[4] = "000";
+      uint16_t records_size = 0;
+      EEPROM_PUT(ver);              // invalidate data first
+      EEPROM_SKIP(records_size);    // Skip the records size slot
+
+      eeprom_index = write_records(eeprom_index, SR_ALL);
+
+      if (!eeprom_error) {
+        #if ENABLED(EEPROM_CHITCHAT)
+          const int eeprom_size = eeprom_index;
+        #endif
+
+        records_size = eeprom_index - (RECORDS_BEGIN);
+
+        // Write the EEPROM header
+        eeprom_index = EEPROM_OFFSET;
+
+        EEPROM_PUT(version);
+        EEPROM_PUT(records_size);
+
+        // Report storage size
+        #if ENABLED(EEPROM_CHITCHAT)
+          SERIAL_ECHO_START();
+          SERIAL_ECHOPAIR("Settings Stored (", eeprom_size - (EEPROM_OFFSET));
+          SERIAL_ECHOLNPGM(" bytes)");
+        #endif
+      }
+    }
     EEPROM_FINISH();
 
     #if ENABLED(UBL_SAVE_ACTIVE_ON_M500)
-      if (ubl.storage_slot >= 0)
+      if (ubl.storage_slot >= 0 && (only == SR_ALL || only == SR_LEVELING))
         store_mesh(ubl.storage_slot);
     #endif
 
@@ -695,8 +944,11 @@ void MarlinSettings::postprocess() {
 
   /**
    * M501 - Retrieve Configuration
+   *
+   * Records that are missing, stale or fail their CRC keep their defaults.
+   * With a record tag only that record is loaded.
    */
-  bool MarlinSettings::load() {
+  bool MarlinSettings::load(const uint8_t only/*=SR_ALL*/) {
     uint16_t working_crc = 0;
 
     EEPROM_START();
@@ -704,9 +956,6 @@ void MarlinSettings::postprocess() {
     char stored_ver[4];
     EEPROM_READ(stored_ver);
 
-    uint16_t stored_crc;
-    EEPROM_READ(stored_crc);
-
     // Version has to match or defaults are used
     if (strncmp(version, stored_ver, 3) != 0) {
       if (stored_ver[0] != 'V') {
@@ -719,460 +968,516 @@ void MarlinSettings::postprocess() {
         SERIAL_ECHOPAIR("(EEPROM=", stored_ver);
         SERIAL_ECHOLNPGM(" Marlin=" EEPROM_VERSION ")");
       #endif
-      reset();
+      if (only == SR_ALL) reset();
     }
     else {
-      float dummy = 0;
-      bool dummyb;
+      uint16_t sizes[SR_COUNT];
+      int positions[SR_COUNT];
+      const uint16_t usable = index_records(positions, sizes, false),
+                     wanted = only == SR_ALL ? ALL_RECORDS : _BV(only);
 
-      working_crc = 0; //clear before reading first "real data"
+      // Start from the defaults if any record can't be used
+      if (only == SR_ALL && usable != ALL_RECORDS) reset();
 
-      // Number of esteppers may change
-      uint8_t esteppers;
-      EEPROM_READ(esteppers);
+      #define RECORD_LOAD(TAG) (TEST(usable & wanted, TAG) && ((eeprom_index = positions[TAG] + sizeof(record_header_t)), true))
 
-      //
-      // Planner Motion
-      //
+      float dummy = 0;
+      bool dummyb;
 
-      // Get only the number of E stepper parameters previously stored
-      // Any steppers added later are set to their defaults
-      const float def1[] = DEFAULT_AXIS_STEPS_PER_UNIT, def2[] = DEFAULT_MAX_FEEDRATE;
-      const uint32_t def3[] = DEFAULT_MAX_ACCELERATION;
-      float tmp1[XYZ + esteppers], tmp2[XYZ + esteppers];
-      uint32_t tmp3[XYZ + esteppers];
-      EEPROM_READ(tmp1);
-      EEPROM_READ(tmp2);
-      EEPROM_READ(tmp3);
-      LOOP_XYZE_N(i) {
-        planner.axis_steps_per_mm[i]          = i < XYZ + esteppers ? tmp1[i] : def1[i < COUNT(def1) ? i : COUNT(def1) - 1];
-        planner.max_feedrate_mm_s[i]          = i < XYZ + esteppers ? tmp2[i] : def2[i < COUNT(def2) ? i : COUNT(def2) - 1];
-        planner.max_acceleration_mm_per_s2[i] = i < XYZ + esteppers ? tmp3[i] : def3[i < COUNT(def3) ? i : COUNT(def3) - 1];
+      if (RECORD_LOAD(SR_STEPPERS)) {
+        // Number of esteppers may change
+        uint8_t esteppers;
+        EEPROM_READ(esteppers);
+
+        //
+        // Planner Motion
+        //
+
+        // Get only the number of E stepper parameters previously stored
+        // Any steppers added later are set to their defaults
+        const float def1[] = DEFAULT_AXIS_STEPS_PER_UNIT, def2[] = DEFAULT_MAX_FEEDRATE;
+        const uint32_t def3[] = DEFAULT_MAX_ACCELERATION;
+        float tmp1[XYZ + esteppers], tmp2[XYZ + esteppers];
+        uint32_t tmp3[XYZ + esteppers];
+        EEPROM_READ(tmp1);
+        EEPROM_READ(tmp2);
+        EEPROM_READ(tmp3);
+        LOOP_XYZE_N(i) {
+          planner.axis_steps_per_mm[i]          = i < XYZ + esteppers ? tmp1[i] : def1[i < COUNT(def1) ? i : COUNT(def1) - 1];
+          planner.max_feedrate_mm_s[i]          = i < XYZ + esteppers ? tmp2[i] : def2[i < COUNT(def2) ? i : COUNT(def2) - 1];
+          planner.max_acceleration_mm_per_s2[i] = i < XYZ + esteppers ? tmp3[i] : def3[i < COUNT(def3) ? i : COUNT(def3) - 1];
+        }
       }
 
-      EEPROM_READ(planner.acceleration);
-      EEPROM_READ(planner.retract_acceleration);
-      EEPROM_READ(planner.travel_acceleration);
-      EEPROM_READ(planner.min_feedrate_mm_s);
-      EEPROM_READ(planner.min_travel_feedrate_mm_s);
-      EEPROM_READ(planner.min_segment_time_us);
-      EEPROM_READ(planner.max_jerk);
-
-      //
-      // Home Offset (M206)
-      //
-
-      #if !HAS_HOME_OFFSET
-        float home_offset[XYZ];
-      #endif
-      EEPROM_READ(home_offset);
+      if (RECORD_LOAD(SR_MOTION)) {
+        EEPROM_READ(planner.acceleration);
+        EEPROM_READ(planner.retract_acceleration);
+        EEPROM_READ(planner.travel_acceleration);
+        EEPROM_READ(planner.min_feedrate_mm_s);
+        EEPROM_READ(planner.min_travel_feedrate_mm_s);
+        EEPROM_READ(planner.min_segment_time_us);
+        EEPROM_READ(planner.max_jerk);
+
+        //
+        // Home Offset (M206)
+        //
+
+        #if !HAS_HOME_OFFSET
+          float home_offset[XYZ];
+        #endif
+        EEPROM_READ(home_offset);
 
-      //
-      // Hotend Offsets, if any
-      //
+        //
+        // Hotend Offsets, if any
+        //
 
-      #if HOTENDS > 1
-        // Skip hotend 0 which must be 0
-        for (uint8_t e = 1; e < HOTENDS; e++)
-          LOOP_XYZ(i) EEPROM_READ(hotend_offset[i][e]);
-      #endif
+        #if HOTENDS > 1
+          // Skip hotend 0 which must be 0
+          for (uint8_t e = 1; e < HOTENDS; e++)
+            LOOP_XYZ(i) EEPROM_READ(hotend_offset[i][e]);
+        #endif
+      }
 
       //
       // Global Leveling
       //
 
-      #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
-        EEPROM_READ(new_z_fade_height);
-      #else
-        EEPROM_READ(dummy);
-      #endif
+      if (RECORD_LOAD(SR_LEVELING)) {
+        #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
+          EEPROM_READ(new_z_fade_height);
+        #else
+          EEPROM_READ(dummy);
+        #endif
 
-      //
-      // Mesh (Manual) Bed Leveling
-      //
+        //
+        // Mesh (Manual) Bed Leveling
+        //
 
-      bool leveling_is_on;
-      uint8_t mesh_num_x, mesh_num_y;
-      EEPROM_READ(leveling_is_on);
-      EEPROM_READ(dummy);
-      EEPROM_READ(mesh_num_x);
-      EEPROM_READ(mesh_num_y);
-
-      #if ENABLED(MESH_BED_LEVELING)
-        mbl.has_mesh = leveling_is_on;
-        mbl.z_offset = dummy;
-        if (mesh_num_x == GRID_MAX_POINTS_X && mesh_num_y == GRID_MAX_POINTS_Y) {
-          // EEPROM data fits the current mesh
-          EEPROM_READ(mbl.z_values);
-        }
-        else {
-          // EEPROM data is stale
-          mbl.reset();
+        bool leveling_is_on;
+        uint8_t mesh_num_x, mesh_num_y;
+        EEPROM_READ(leveling_is_on);
+        EEPROM_READ(dummy);
+        EEPROM_READ(mesh_num_x);
+        EEPROM_READ(mesh_num_y);
+
+        #if ENABLED(MESH_BED_LEVELING)
+          mbl.has_mesh = leveling_is_on;
+          mbl.z_offset = dummy;
+          if (mesh_num_x == GRID_MAX_POINTS_X && mesh_num_y == GRID_MAX_POINTS_Y) {
+            // EEPROM data fits the current mesh
+            EEPROM_READ(mbl.z_values);
+          }
+          else {
+            // EEPROM data is stale
+            mbl.reset();
+            for (uint16_t q = mesh_num_x * mesh_num_y; q--;) EEPROM_READ(dummy);
+          }
+        #else
+          // MBL is disabled - skip the stored data
           for (uint16_t q = mesh_num_x * mesh_num_y; q--;) EEPROM_READ(dummy);
-        }
-      #else
-        // MBL is disabled - skip the stored data
-        for (uint16_t q = mesh_num_x * mesh_num_y; q--;) EEPROM_READ(dummy);
-      #endif // MESH_BED_LEVELING
+        #endif // MESH_BED_LEVELING
 
-      #if !HAS_BED_PROBE
-        float zprobe_zoffset;
-      #endif
-      EEPROM_READ(zprobe_zoffset);
-
-      //
-      // Planar Bed Leveling matrix
-      //
+        #if !HAS_BED_PROBE
+          float zprobe_zoffset;
+        #endif
+        EEPROM_READ(zprobe_zoffset);
 
-      #if ABL_PLANAR
-        EEPROM_READ(planner.bed_level_matrix);
-      #else
-        for (uint8_t q = 9; q--;) EEPROM_READ(dummy);
-      #endif
+        //
+        // Planar Bed Leveling matrix
+        //
 
-      //
-      // Bilinear Auto Bed Leveling
-      //
+        #if ABL_PLANAR
+          EEPROM_READ(planner.bed_level_matrix);
+        #else
+          for (uint8_t q = 9; q--;) EEPROM_READ(dummy);
+        #endif
 
-      uint8_t grid_max_x, grid_max_y;
-      EEPROM_READ(grid_max_x);                       // 1 byte
-      EEPROM_READ(grid_max_y);                       // 1 byte
-      #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
-        if (grid_max_x == GRID_MAX_POINTS_X && grid_max_y == GRID_MAX_POINTS_Y) {
-          set_bed_leveling_enabled(false);
-          EEPROM_READ(bilinear_grid_spacing);        // 2 ints
-          EEPROM_READ(bilinear_start);               // 2 ints
-          EEPROM_READ(z_values);                     // 9 to 256 floats
-        }
-        else // EEPROM data is stale
-      #endif // AUTO_BED_LEVELING_BILINEAR
-        {
-          // Skip past disabled (or stale) Bilinear Grid data
-          int bgs[2], bs[2];
-          EEPROM_READ(bgs);
-          EEPROM_READ(bs);
-          for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_READ(dummy);
-        }
+        //
+        // Bilinear Auto Bed Leveling
+        //
+
+        uint8_t grid_max_x, grid_max_y;
+        EEPROM_READ(grid_max_x);                       // 1 byte
+        EEPROM_READ(grid_max_y);                       // 1 byte
+        #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+          if (grid_max_x == GRID_MAX_POINTS_X && grid_max_y == GRID_MAX_POINTS_Y) {
+            set_bed_leveling_enabled(false);
+            EEPROM_READ(bilinear_grid_spacing);        // 2 ints
+            EEPROM_READ(bilinear_start);               // 2 ints
+            EEPROM_READ(z_values);                     // 9 to 256 floats
+          }
+          else // EEPROM data is stale
+        #endif // AUTO_BED_LEVELING_BILINEAR
+          {
+            // Skip past disabled (or stale) Bilinear Grid data
+            int bgs[2], bs[2];
+            EEPROM_READ(bgs);
+            EEPROM_READ(bs);
+            for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_READ(dummy);
+          }
 
-      //
-      // Unified Bed Leveling active state
-      //
+        //
+        // Unified Bed Leveling active state
+        //
 
-      #if ENABLED(AUTO_BED_LEVELING_UBL)
-        EEPROM_READ(planner.leveling_active);
-        EEPROM_READ(ubl.storage_slot);
-      #else
-        uint8_t dummyui8;
-        EEPROM_READ(dummyb);
-        EEPROM_READ(dummyui8);
-      #endif // AUTO_BED_LEVELING_UBL
+        #if ENABLED(AUTO_BED_LEVELING_UBL)
+          EEPROM_READ(planner.leveling_active);
+          EEPROM_READ(ubl.storage_slot);
+        #else
+          uint8_t dummyui8;
+          EEPROM_READ(dummyb);
+          EEPROM_READ(dummyui8);
+        #endif // AUTO_BED_LEVELING_UBL
+      }
 
       //
       // DELTA Geometry or Dual Endstops offsets
       //
 
-      #if ENABLED(DELTA)
-        EEPROM_READ(delta_height);              // 1 float
-        EEPROM_READ(delta_endstop_adj);         // 3 floats
-        EEPROM_READ(delta_radius);              // 1 float
-        EEPROM_READ(delta_diagonal_rod);        // 1 float
-        EEPROM_READ(delta_segments_per_second); // 1 float
-        EEPROM_READ(delta_calibration_radius);  // 1 float
-        EEPROM_READ(delta_tower_angle_trim);    // 3 floats
+      if (RECORD_LOAD(SR_DELTA)) {
+        #if ENABLED(DELTA)
+          EEPROM_READ(delta_height);              // 1 float
+          EEPROM_READ(delta_endstop_adj);         // 3 floats
+          EEPROM_READ(delta_radius);              // 1 float
+          EEPROM_READ(delta_diagonal_rod);        // 1 float
+          EEPROM_READ(delta_segments_per_second); // 1 float
+          EEPROM_READ(delta_calibration_radius);  // 1 float
+          EEPROM_READ(delta_tower_angle_trim);    // 3 floats
+          EEPROM_READ(delta_diagonal_rod_trim);   // 3 floats
+
+        #elif ENABLED(X_DUAL_ENDSTOPS) || ENABLED(Y_DUAL_ENDSTOPS) || ENABLED(Z_DUAL_ENDSTOPS)
+
+          #if ENABLED(X_DUAL_ENDSTOPS)
+            EEPROM_READ(endstops.x_endstop_adj);  // 1 float
+          #else
+            EEPROM_READ(dummy);
+          #endif
+          #if ENABLED(Y_DUAL_ENDSTOPS)
+            EEPROM_READ(endstops.y_endstop_adj);  // 1 float
+          #else
+            EEPROM_READ(dummy);
+          #endif
+          #if ENABLED(Z_DUAL_ENDSTOPS)
+            EEPROM_READ(endstops.z_endstop_adj); // 1 float
+          #else
+            EEPROM_READ(dummy);
+          #endif
 
-      #elif ENABLED(X_DUAL_ENDSTOPS) || ENABLED(Y_DUAL_ENDSTOPS) || ENABLED(Z_DUAL_ENDSTOPS)
+          for (uint8_t q=11; q--;) EEPROM_READ(dummy);
 
-        #if ENABLED(X_DUAL_ENDSTOPS)
-          EEPROM_READ(endstops.x_endstop_adj);  // 1 float
-        #else
-          EEPROM_READ(dummy);
-        #endif
-        #if ENABLED(Y_DUAL_ENDSTOPS)
-          EEPROM_READ(endstops.y_endstop_adj);  // 1 float
-        #else
-          EEPROM_READ(dummy);
-        #endif
-        #if ENABLED(Z_DUAL_ENDSTOPS)
-          EEPROM_READ(endstops.z_endstop_adj); // 1 float
         #else
-          EEPROM_READ(dummy);
-        #endif
-
-        for (uint8_t q=8; q--;) EEPROM_READ(dummy);
-
-      #else
 
-        for (uint8_t q=11; q--;) EEPROM_READ(dummy);
+          for (uint8_t q=14; q--;) EEPROM_READ(dummy);
 
-      #endif
+        #endif
+      }
 
       //
       // LCD Preheat settings
       //
 
-      #if DISABLED(ULTIPANEL)
-        int lcd_preheat_hotend_temp[2], lcd_preheat_bed_temp[2], lcd_preheat_fan_speed[2];
-      #endif
+      if (RECORD_LOAD(SR_PREHEAT)) {
+        #if DISABLED(ULTIPANEL)
+          int lcd_preheat_hotend_temp[2], lcd_preheat_bed_temp[2], lcd_preheat_fan_speed[2];
+        #endif
 
-      EEPROM_READ(lcd_preheat_hotend_temp); // 2 floats
-      EEPROM_READ(lcd_preheat_bed_temp);    // 2 floats
-      EEPROM_READ(lcd_preheat_fan_speed);   // 2 floats
+        EEPROM_READ(lcd_preheat_hotend_temp); // 2 floats
+        EEPROM_READ(lcd_preheat_bed_temp);    // 2 floats
+        EEPROM_READ(lcd_preheat_fan_speed);   // 2 floats
 
-      //EEPROM_ASSERT(
-      //  WITHIN(lcd_preheat_fan_speed, 0, 255),
-      //  "lcd_preheat_fan_speed out of range"
-      //);
+        //EEPROM_ASSERT(
+        //  WITHIN(lcd_preheat_fan_speed, 0, 255),
+        //  "lcd_preheat_fan_speed out of range"
+        //);
+      }
 
       //
       // Hotend PID
       //
 
-      #if ENABLED(PIDTEMP)
-        for (uint8_t e = 0; e < MAX_EXTRUDERS; e++) {
-          EEPROM_READ(dummy); // Kp
-          if (e < HOTENDS && dummy != DUMMY_PID_VALUE) {
-            // do not need to scale PID values as the values in EEPROM are already scaled
-            PID_PARAM(Kp, e) = dummy;
-            EEPROM_READ(PID_PARAM(Ki, e));
-            EEPROM_READ(PID_PARAM(Kd, e));
-            #if ENABLED(PID_EXTRUSION_SCALING)
-              EEPROM_READ(PID_PARAM(Kc, e));
-            #else
-              EEPROM_READ(dummy);
-            #endif
-          }
-          else {
-            for (uint8_t q=3; q--;) EEPROM_READ(dummy); // Ki, Kd, Kc
+      if (RECORD_LOAD(SR_TEMPERATURE)) {
+        #if ENABLED(PIDTEMP)
+          for (uint8_t e = 0; e < MAX_EXTRUDERS; e++) {
+            EEPROM_READ(dummy); // Kp
+            if (e < HOTENDS && dummy != DUMMY_PID_VALUE) {
+              // do not need to scale PID values as the values in EEPROM are already scaled
+              PID_PARAM(Kp, e) = dummy;
+              EEPROM_READ(PID_PARAM(Ki, e));
+              EEPROM_READ(PID_PARAM(Kd, e));
+              #if ENABLED(PID_EXTRUSION_SCALING)
+                EEPROM_READ(PID_PARAM(Kc, e));
+              #else
+                EEPROM_READ(dummy);
+              #endif
+            }
+            else {
+              for (uint8_t q=3; q--;) EEPROM_READ(dummy); // Ki, Kd, Kc
+            }
           }
-        }
-      #else // !PIDTEMP
-        // 4 x 4 = 16 slots for PID parameters
-        for (uint8_t q = MAX_EXTRUDERS * 4; q--;) EEPROM_READ(dummy);  // Kp, Ki, Kd, Kc
-      #endif // !PIDTEMP
+        #else // !PIDTEMP
+          // 4 x 4 = 16 slots for PID parameters
+          for (uint8_t q = MAX_EXTRUDERS * 4; q--;) EEPROM_READ(dummy);  // Kp, Ki, Kd, Kc
+        #endif // !PIDTEMP
 
-      //
-      // PID Extrusion Scaling
-      //
+        //
+        // PID Extrusion Scaling
+        //
 
-      #if DISABLED(PID_EXTRUSION_SCALING)
-        int lpq_len;
-      #endif
-      EEPROM_READ(lpq_len);
+        #if DISABLED(PID_EXTRUSION_SCALING)
+          int lpq_len;
+        #endif
+        EEPROM_READ(lpq_len);
+
+        //
+        // Heated Bed PID
+        //
+
+        #if ENABLED(PIDTEMPBED)
+          EEPROM_READ(dummy); // bedKp
+          if (dummy != DUMMY_PID_VALUE) {
+            thermalManager.bedKp = dummy;
+            EEPROM_READ(thermalManager.bedKi);
+            EEPROM_READ(thermalManager.bedKd);
+          }
+        #else
+          for (uint8_t q=3; q--;) EEPROM_READ(dummy); // bedKp, bedKi, bedKd
+        #endif
 
-      //
-      // Heated Bed PID
-      //
+        //
+        // Hotend MPC model
+        //
 
-      #if ENABLED(PIDTEMPBED)
-        EEPROM_READ(dummy); // bedKp
-        if (dummy != DUMMY_PID_VALUE) {
-          thermalManager.bedKp = dummy;
-          EEPROM_READ(thermalManager.bedKi);
-          EEPROM_READ(thermalManager.bedKd);
+        for (uint8_t e = 0; e < MAX_EXTRUDERS; e++) {
+          EEPROM_READ(dummy); // heater_power
+          #if ENABLED(MPC_HOTEND)
+            if (e < HOTENDS && dummy != DUMMY_PID_VALUE) {
+              Temperature::mpc_t &m = thermalManager.mpc[e];
+              m.heater_power = dummy;
+              EEPROM_READ(m.block_heat_capacity);
+              EEPROM_READ(m.sensor_responsiveness);
+              EEPROM_READ(m.ambient_xfer_coeff);
+              EEPROM_READ(m.filament_heat_capacity_permm);
+              EEPROM_READ(m.ambient_temp);
+              continue;
+            }
+          #endif
+          for (uint8_t q = 5; q--;) EEPROM_READ(dummy);
         }
-      #else
-        for (uint8_t q=3; q--;) EEPROM_READ(dummy); // bedKp, bedKi, bedKd
-      #endif
+      }
 
       //
       // LCD Contrast
       //
 
-      #if !HAS_LCD_CONTRAST
-        uint16_t lcd_contrast;
-      #endif
-      EEPROM_READ(lcd_contrast);
+      if (RECORD_LOAD(SR_LCD_CONTRAST)) {
+        #if !HAS_LCD_CONTRAST
+          uint16_t lcd_contrast;
+        #endif
+        EEPROM_READ(lcd_contrast);
+      }
 
       //
       // Firmware Retraction
       //
 
-      #if ENABLED(FWRETRACT)
-        EEPROM_READ(fwretract.autoretract_enabled);
-        EEPROM_READ(fwretract.retract_length);
-        EEPROM_READ(fwretract.retract_feedrate_mm_s);
-        EEPROM_READ(fwretract.retract_zlift);
-        EEPROM_READ(fwretract.retract_recover_length);
-        EEPROM_READ(fwretract.retract_recover_feedrate_mm_s);
-        EEPROM_READ(fwretract.swap_retract_length);
-        EEPROM_READ(fwretract.swap_retract_recover_length);
-        EEPROM_READ(fwretract.swap_retract_recover_feedrate_mm_s);
-      #else
-        EEPROM_READ(dummyb);
-        for (uint8_t q=8; q--;) EEPROM_READ(dummy);
-      #endif
+      if (RECORD_LOAD(SR_RETRACT)) {
+        #if ENABLED(FWRETRACT)
+          EEPROM_READ(fwretract.autoretract_enabled);
+          EEPROM_READ(fwretract.retract_length);
+          EEPROM_READ(fwretract.retract_feedrate_mm_s);
+          EEPROM_READ(fwretract.retract_zlift);
+          EEPROM_READ(fwretract.retract_recover_length);
+          EEPROM_READ(fwretract.retract_recover_feedrate_mm_s);
+          EEPROM_READ(fwretract.swap_retract_length);
+          EEPROM_READ(fwretract.swap_retract_recover_length);
+          EEPROM_READ(fwretract.swap_retract_recover_feedrate_mm_s);
+        #else
+          EEPROM_READ(dummyb);
+          for (uint8_t q=8; q--;) EEPROM_READ(dummy);
+        #endif
+      }
 
       //
       // Volumetric & Filament Size
       //
 
-      EEPROM_READ(parser.volumetric_enabled);
-      for (uint8_t q = 0; q < MAX_EXTRUDERS; q++) {
-        EEPROM_READ(dummy);
-        if (q < COUNT(planner.filament_size)) planner.filament_size[q] = dummy;
+      if (RECORD_LOAD(SR_FILAMENT)) {
+        EEPROM_READ(parser.volumetric_enabled);
+        for (uint8_t q = 0; q < MAX_EXTRUDERS; q++) {
+          EEPROM_READ(dummy);
+          if (q < COUNT(planner.filament_size)) planner.filament_size[q] = dummy;
+        }
       }
 
       //
       // TMC2130 Stepper Current
       //
 
-      uint16_t val;
-      #if ENABLED(HAVE_TMC2130)
-        EEPROM_READ(val);
-        #if ENABLED(X_IS_TMC2130)
-          stepperX.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
-        #endif
-        EEPROM_READ(val);
-        #if ENABLED(Y_IS_TMC2130)
-          stepperY.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
-        #endif
-        EEPROM_READ(val);
-        #if ENABLED(Z_IS_TMC2130)
-          stepperZ.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
-        #endif
-        EEPROM_READ(val);
-        #if ENABLED(X2_IS_TMC2130)
-          stepperX2.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
-        #endif
-        EEPROM_READ(val);
-        #if ENABLED(Y2_IS_TMC2130)
-          stepperY2.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
-        #endif
-        EEPROM_READ(val);
-        #if ENABLED(Z2_IS_TMC2130)
-          stepperZ2.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
-        #endif
-        EEPROM_READ(val);
-        #if ENABLED(E0_IS_TMC2130)
-          stepperE0.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
-        #endif
-        EEPROM_READ(val);
-        #if ENABLED(E1_IS_TMC2130)
-          stepperE1.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
-        #endif
-        EEPROM_READ(val);
-        #if ENABLED(E2_IS_TMC2130)
-          stepperE2.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
-        #endif
-        EEPROM_READ(val);
-        #if ENABLED(E3_IS_TMC2130)
-          stepperE3.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
-        #endif
-        EEPROM_READ(val);
-        #if ENABLED(E4_IS_TMC2130)
-          stepperE4.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
+      if (RECORD_LOAD(SR_TMC_CURRENT)) {
+        uint16_t val;
+        #if ENABLED(HAVE_TMC2130)
+          EEPROM_READ(val);
+          #if ENABLED(X_IS_TMC2130)
+            stepperX.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
+          #endif
+          EEPROM_READ(val);
+          #if ENABLED(Y_IS_TMC2130)
+            stepperY.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
+          #endif
+          EEPROM_READ(val);
+          #if ENABLED(Z_IS_TMC2130)
+            stepperZ.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
+          #endif
+          EEPROM_READ(val);
+          #if ENABLED(X2_IS_TMC2130)
+            stepperX2.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
+          #endif
+          EEPROM_READ(val);
+          #if ENABLED(Y2_IS_TMC2130)
+            stepperY2.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
+          #endif
+          EEPROM_READ(val);
+          #if ENABLED(Z2_IS_TMC2130)
+            stepperZ2.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
+          #endif
+          EEPROM_READ(val);
+          #if ENABLED(E0_IS_TMC2130)
+            stepperE0.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
+          #endif
+          EEPROM_READ(val);
+          #if ENABLED(E1_IS_TMC2130)
+            stepperE1.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
+          #endif
+          EEPROM_READ(val);
+          #if ENABLED(E2_IS_TMC2130)
+            stepperE2.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
+          #endif
+          EEPROM_READ(val);
+          #if ENABLED(E3_IS_TMC2130)
+            stepperE3.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
+          #endif
+          EEPROM_READ(val);
+          #if ENABLED(E4_IS_TMC2130)
+            stepperE4.setCurrent(val, R_SENSE, HOLD_MULTIPLIER);
+          #endif
+        #else
+          for (uint8_t q = 11; q--;) EEPROM_READ(val);
         #endif
-      #else
-        for (uint8_t q = 11; q--;) EEPROM_READ(val);
-      #endif
+      }
 
       //
       // Linear Advance
       //
 
-      #if ENABLED(LIN_ADVANCE)
-        EEPROM_READ(planner.extruder_advance_k);
-        EEPROM_READ(planner.advance_ed_ratio);
-      #else
-        EEPROM_READ(dummy);
-        EEPROM_READ(dummy);
-      #endif
+      if (RECORD_LOAD(SR_LIN_ADVANCE)) {
+        #if ENABLED(LIN_ADVANCE)
+          EEPROM_READ(planner.extruder_advance_k);
+          EEPROM_READ(planner.advance_ed_ratio);
+        #else
+          EEPROM_READ(dummy);
+          EEPROM_READ(dummy);
+        #endif
+      }
 
       //
       // Motor Current PWM
       //
 
-      #if HAS_MOTOR_CURRENT_PWM
-        for (uint8_t q = 3; q--;) EEPROM_READ(stepper.motor_current_setting[q]);
-      #else
-        uint32_t dummyui32;
-        for (uint8_t q = 3; q--;) EEPROM_READ(dummyui32);
-      #endif
+      if (RECORD_LOAD(SR_MOTOR_CURRENT)) {
+        #if HAS_MOTOR_CURRENT_PWM
+          for (uint8_t q = 3; q--;) EEPROM_READ(stepper.motor_current_setting[q]);
+        #else
+          uint32_t dummyui32;
+          for (uint8_t q = 3; q--;) EEPROM_READ(dummyui32);
+        #endif
+      }
 
       //
       // CNC Coordinate System
       //
 
-      #if ENABLED(CNC_COORDINATE_SYSTEMS)
-        position_changed = gcode.select_coordinate_system(-1); // Go back to machine space
-        EEPROM_READ(gcode.coordinate_system);                  // 27 floats
-      #else
-        for (uint8_t q = 27; q--;) EEPROM_READ(dummy);
-      #endif
+      if (RECORD_LOAD(SR_COORDINATES)) {
+        #if ENABLED(CNC_COORDINATE_SYSTEMS)
+          position_changed = gcode.select_coordinate_system(-1); // Go back to machine space
+          EEPROM_READ(gcode.coordinate_system);                  // 27 floats
+        #else
+          for (uint8_t q = 27; q--;) EEPROM_READ(dummy);
+        #endif
+      }
 
       //
       // Skew correction factors
       //
 
-      #if ENABLED(SKEW_CORRECTION_GCODE)
-        EEPROM_READ(planner.xy_skew_factor);
-        #if ENABLED(SKEW_CORRECTION_FOR_Z)
-          EEPROM_READ(planner.xz_skew_factor);
-          EEPROM_READ(planner.yz_skew_factor);
+      if (RECORD_LOAD(SR_SKEW)) {
+        #if ENABLED(SKEW_CORRECTION_GCODE)
+          EEPROM_READ(planner.xy_skew_factor);
+          #if ENABLED(SKEW_CORRECTION_FOR_Z)
+            EEPROM_READ(planner.xz_skew_factor);
+            EEPROM_READ(planner.yz_skew_factor);
+          #else
+            EEPROM_READ(dummy);
+            EEPROM_READ(dummy);
+          #endif
         #else
-          EEPROM_READ(dummy);
-          EEPROM_READ(dummy);
-        #endif
-      #else
-        for (uint8_t q = 3; q--;) EEPROM_READ(dummy);
-      #endif
-
-      if (working_crc == stored_crc) {
-        postprocess();
-        #if ENABLED(EEPROM_CHITCHAT)
-          SERIAL_ECHO_START();
-          SERIAL_ECHO(version);
-          SERIAL_ECHOPAIR(" stored settings retrieved (", eeprom_index - (EEPROM_OFFSET));
-          SERIAL_ECHOPAIR(" bytes; crc ", (uint32_t)working_crc);
-          SERIAL_ECHOLNPGM(")");
+          for (uint8_t q = 3; q--;) EEPROM_READ(dummy);
         #endif
       }
-      else {
-        #if ENABLED(EEPROM_CHITCHAT)
-          SERIAL_ERROR_START();
-          SERIAL_ERRORPGM("EEPROM CRC mismatch - (stored) ");
-          SERIAL_ERROR(stored_crc);
-          SERIAL_ERRORPGM(" != ");
-          SERIAL_ERROR(working_crc);
-          SERIAL_ERRORLNPGM(" (calculated)!");
-        #endif
-        reset();
-      }
 
-      #if ENABLED(AUTO_BED_LEVELING_UBL)
-        meshes_begin = (eeprom_index + 32) & 0xFFF8;  // Pad the end of configuration data so it
-                                                      // can float up or down a little bit without
-                                                      // disrupting the mesh data
-        ubl.report_state();
+      postprocess();
 
-        if (!ubl.sanity_check()) {
-          SERIAL_EOL();
-          #if ENABLED(EEPROM_CHITCHAT)
-            ubl.echo_name();
-            SERIAL_ECHOLNPGM(" initialized.\n");
-          #endif
+      #if ENABLED(EEPROM_CHITCHAT)
+        SERIAL_ECHO_START();
+        if ((usable & wanted) == wanted) {
+          SERIAL_ECHO(version);
+          SERIAL_ECHOLNPGM(" stored settings retrieved");
         }
         else {
-          #if ENABLED(EEPROM_CHITCHAT)
-            SERIAL_PROTOCOLPGM("?Can't enable ");
-            ubl.echo_name();
-            SERIAL_PROTOCOLLNPGM(".");
-          #endif
-          ubl.reset();
+          SERIAL_ECHOPGM("Bad or missing settings records, using defaults for");
+          for (uint8_t t = 1; t < SR_COUNT; t++)
+            if (TEST(wanted, t) && !TEST(usable, t)) SERIAL_ECHOPAIR(" ", t);
+          SERIAL_EOL();
         }
+      #endif
 
-        if (ubl.storage_slot >= 0) {
-          load_mesh(ubl.storage_slot);
-          #if ENABLED(EEPROM_CHITCHAT)
-            SERIAL_ECHOPAIR("Mesh ", ubl.storage_slot);
-            SERIAL_ECHOLNPGM(" loaded from storage.");
-          #endif
-        }
-        else {
-          ubl.reset();
-          #if ENABLED(EEPROM_CHITCHAT)
-            SERIAL_ECHOLNPGM("UBL System reset()");
-          #endif
+      #if ENABLED(AUTO_BED_LEVELING_UBL)
+        // Pad the end of configuration data so it can float up or down
+        // a little bit without disrupting the mesh data
+        meshes_begin = (record_position(sizes, SR_COUNT) + 32) & 0xFFF8;
+
+        // The mesh state only changes when leveling settings are loaded
+        if (TEST(wanted, SR_LEVELING)) {
+          ubl.report_state();
+
+          if (!ubl.sanity_check()) {
+            SERIAL_EOL();
+            #if ENABLED(EEPROM_CHITCHAT)
+              ubl.echo_name();
+              SERIAL_ECHOLNPGM(" initialized.\n");
+            #endif
+          }
+          else {
+            #if ENABLED(EEPROM_CHITCHAT)
+              SERIAL_PROTOCOLPGM("?Can't enable ");
+              ubl.echo_name();
+              SERIAL_PROTOCOLLNPGM(".");
+            #endif
+            ubl.reset();
+          }
+
+          if (ubl.storage_slot >= 0) {
+            load_mesh(ubl.storage_slot);
+            #if ENABLED(EEPROM_CHITCHAT)
+              SERIAL_ECHOPAIR("Mesh ", ubl.storage_slot);
+              SERIAL_ECHOLNPGM(" loaded from storage.");
+            #endif
+          }
+          else {
+            ubl.reset();
+            #if ENABLED(EEPROM_CHITCHAT)
+              SERIAL_ECHOLNPGM("UBL System reset()");
+            #endif
+          }
         }
       #endif
     }
@@ -1195,12 +1500,32 @@ void MarlinSettings::postprocess() {
       }
     #endif
 
+    #if ENABLED(UBL_MESH_COMPRESSION)
+
+      /**
+       * A compressed slot keeps the plane that best fits the mesh and the
+       * height of each point above that plane in microns. Points load back
+       * within half a micron of what was stored, in about half the space,
+       * so more meshes (e.g., one per bed sheet) fit in the EEPROM.
+       */
+      #define MESH_NAN_UM -32768
+      #define MESH_SLOT_SIZE (3 * sizeof(float) + GRID_MAX_POINTS * sizeof(int16_t) + sizeof(uint16_t))
+
+      // Height of the plane z = -(A.i + B.j + D) at mesh point i,j
+      FORCE_INLINE static float mesh_plane_z(const float plane[3], const uint8_t i, const uint8_t j) {
+        return -(plane[0] * i + plane[1] * j + plane[2]);
+      }
+
+    #else
+      #define MESH_SLOT_SIZE sizeof(ubl.z_values)
+    #endif
+
     int MarlinSettings::calc_num_meshes() {
       //obviously this will get more sophisticated once we've added an actual MAT
 
       if (meshes_begin <= 0) return 0;
 
-      return (meshes_end - meshes_begin) / sizeof(ubl.z_values);
+      return (meshes_end - meshes_begin) / (MESH_SLOT_SIZE);
     }
 
     void MarlinSettings::store_mesh(int8_t slot) {
@@ -1220,11 +1545,53 @@ void MarlinSettings::postprocess() {
 
         uint16_t crc = 0;
         bool status;
-        int pos = meshes_end - (slot + 1) * sizeof(ubl.z_values);
+        int pos = meshes_end - (slot + 1) * (MESH_SLOT_SIZE);
+
+        #if ENABLED(UBL_MESH_COMPRESSION)
+
+          // Fit the base plane the same way G29 J does
+          struct linear_fit_data lsf_results;
+          incremental_LSF_reset(&lsf_results);
+          for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
+            for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++)
+              if (!isnan(ubl.z_values[x][y]))
+                incremental_LSF(&lsf_results, x, y, ubl.z_values[x][y]);
+          if (finish_incremental_LSF(&lsf_results)) {   // Too few points for a plane? Use their mean.
+            lsf_results.A = lsf_results.B = 0;
+            lsf_results.D = -lsf_results.zbar;
+          }
+          const float plane[3] = { lsf_results.A, lsf_results.B, lsf_results.D };
+
+          bool clipped = false;
+          HAL::PersistentStore::access_start();
+          status = HAL::PersistentStore::write_data(pos, (uint8_t *)plane, sizeof(plane), &crc);
+          for (uint8_t x = 0; x < GRID_MAX_POINTS_X && !status; x++) {
+            int16_t row[GRID_MAX_POINTS_Y];
+            for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++) {
+              const float z = ubl.z_values[x][y];
+              if (isnan(z)) { row[y] = MESH_NAN_UM; continue; }
+              const long um = LROUND((z - mesh_plane_z(plane, x, y)) * 1000.0);
+              if (!WITHIN(um, -32767, 32767)) clipped = true;
+              row[y] = constrain(um, -32767, 32767);
+            }
+            status = HAL::PersistentStore::write_data(pos, (uint8_t *)row, sizeof(row), &crc);
+          }
+          if (!status) {
+            const uint16_t mesh_crc = crc;
+            status = HAL::PersistentStore::write_data(pos, (uint8_t *)&mesh_crc, sizeof(mesh_crc), &crc);
+          }
+          HAL::PersistentStore::access_finish();
 
-        HAL::PersistentStore::access_start();
-        status = HAL::PersistentStore::write_data(pos, (uint8_t *)&ubl.z_values, sizeof(ubl.z_values), &crc);
-        HAL::PersistentStore::access_finish();
+          if (clipped)
+            SERIAL_PROTOCOLLNPGM("?Mesh points over 32mm from the plane were clipped.");
+
+        #else
+
+          HAL::PersistentStore::access_start();
+          status = HAL::PersistentStore::write_data(pos, (uint8_t *)&ubl.z_values, sizeof(ubl.z_values), &crc);
+          HAL::PersistentStore::access_finish();
+
+        #endif
 
         if (status)
           SERIAL_PROTOCOL("?Unable to save mesh data.\n");
@@ -1257,13 +1624,44 @@ void MarlinSettings::postprocess() {
         }
 
         uint16_t crc = 0;
-        int pos = meshes_end - (slot + 1) * sizeof(ubl.z_values);
-        uint8_t * const dest = into ? (uint8_t*)into : (uint8_t*)&ubl.z_values;
+        int pos = meshes_end - (slot + 1) * (MESH_SLOT_SIZE);
         uint16_t status;
 
-        HAL::PersistentStore::access_start();
-        status = HAL::PersistentStore::read_data(pos, dest, sizeof(ubl.z_values), &crc);
-        HAL::PersistentStore::access_finish();
+        #if ENABLED(UBL_MESH_COMPRESSION)
+
+          float (* const dest)[GRID_MAX_POINTS_Y] = into ? (float (*)[GRID_MAX_POINTS_Y])into : ubl.z_values;
+          float plane[3];
+          uint16_t mesh_crc, stored_crc;
+
+          HAL::PersistentStore::access_start();
+          status = HAL::PersistentStore::read_data(pos, (uint8_t *)plane, sizeof(plane), &crc);
+          for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++) {
+            int16_t row[GRID_MAX_POINTS_Y];
+            status |= HAL::PersistentStore::read_data(pos, (uint8_t *)row, sizeof(row), &crc);
+            for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++)
+              dest[x][y] = row[y] == MESH_NAN_UM ? NAN : mesh_plane_z(plane, x, y) + row[y] * 0.001;
+          }
+          mesh_crc = crc;
+          status |= HAL::PersistentStore::read_data(pos, (uint8_t *)&stored_crc, sizeof(stored_crc), &crc);
+          HAL::PersistentStore::access_finish();
+
+          // Never leave a mesh that was not stored in the slot: on a read error or a bad CRC, load no points
+          if (status || stored_crc != mesh_crc) {
+            status = true;
+            for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
+              for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++)
+                dest[x][y] = NAN;
+          }
+
+        #else
+
+          uint8_t * const dest = into ? (uint8_t*)into : (uint8_t*)&ubl.z_values;
+
+          HAL::PersistentStore::access_start();
+          status = HAL::PersistentStore::read_data(pos, dest, sizeof(ubl.z_values), &crc);
+          HAL::PersistentStore::access_finish();
+
+        #endif
 
         if (status)
           SERIAL_PROTOCOL("?Unable to load mesh data.\n");
@@ -1288,7 +1686,8 @@ void MarlinSettings::postprocess() {
 
 #else // !EEPROM_SETTINGS
 
-  bool MarlinSettings::save() {
+  bool MarlinSettings::save(const uint8_t only/*=SR_ALL*/) {
+    UNUSED(only);
     SERIAL_ERROR_START();
     SERIAL_ERRORLNPGM("EEPROM disabled");
     return false;
@@ -1355,7 +1754,8 @@ void MarlinSettings::reset() {
 
   #if ENABLED(DELTA)
     const float adj[ABC] = DELTA_ENDSTOP_ADJ,
-                dta[ABC] = DELTA_TOWER_ANGLE_TRIM;
+                dta[ABC] = DELTA_TOWER_ANGLE_TRIM,
+                drt[ABC] = DELTA_DIAGONAL_ROD_TRIM_TOWER;
     delta_height = DELTA_HEIGHT;
     COPY(delta_endstop_adj, adj);
     delta_radius = DELTA_RADIUS;
@@ -1363,6 +1763,7 @@ void MarlinSettings::reset() {
     delta_segments_per_second = DELTA_SEGMENTS_PER_SECOND;
     delta_calibration_radius = DELTA_CALIBRATION_RADIUS;
     COPY(delta_tower_angle_trim, dta);
+    COPY(delta_diagonal_rod_trim, drt);
 
   #elif ENABLED(X_DUAL_ENDSTOPS) || ENABLED(Y_DUAL_ENDSTOPS) || ENABLED(Z_DUAL_ENDSTOPS)
 
@@ -1426,6 +1827,17 @@ void MarlinSettings::reset() {
     #endif
   #endif // PIDTEMP
 
+  #if ENABLED(MPC_HOTEND)
+    HOTEND_LOOP() {
+      thermalManager.mpc[e].heater_power = MPC_HEATER_POWER;
+      thermalManager.mpc[e].block_heat_capacity = MPC_BLOCK_HEAT_CAPACITY;
+      thermalManager.mpc[e].sensor_responsiveness = MPC_SENSOR_RESPONSIVENESS;
+      thermalManager.mpc[e].ambient_xfer_coeff = MPC_AMBIENT_XFER_COEFF;
+      thermalManager.mpc[e].filament_heat_capacity_permm = MPC_FILAMENT_HEAT_CAPACITY_PERMM;
+      thermalManager.mpc[e].ambient_temp = MPC_AMBIENT_TEMP;
+    }
+  #endif
+
   #if ENABLED(PIDTEMPBED)
     thermalManager.bedKp = DEFAULT_bedKp;
     thermalManager.bedKi = scalePID_i(DEFAULT_bedKi);
@@ -1789,7 +2201,7 @@ void MarlinSettings::reset() {
       SERIAL_ECHOLNPAIR(" Z", LINEAR_UNIT(delta_endstop_adj[Z_AXIS]));
       if (!forReplay) {
         CONFIG_ECHO_START;
-        SERIAL_ECHOLNPGM("Delta settings: L<diagonal_rod> R<radius> H<height> S<segments_per_s> B<calibration radius> XYZ<tower angle corrections>");
+        SERIAL_ECHOLNPGM("Delta settings: L<diagonal_rod> R<radius> H<height> S<segments_per_s> B<calibration radius> XYZ<tower angle corrections> IJK<rod trims>");
       }
       CONFIG_ECHO_START;
       SERIAL_ECHOPAIR("  M665 L", LINEAR_UNIT(delta_diagonal_rod));
@@ -1800,6 +2212,9 @@ void MarlinSettings::reset() {
       SERIAL_ECHOPAIR(" X", LINEAR_UNIT(delta_tower_angle_trim[A_AXIS]));
       SERIAL_ECHOPAIR(" Y", LINEAR_UNIT(delta_tower_angle_trim[B_AXIS]));
       SERIAL_ECHOPAIR(" Z", LINEAR_UNIT(delta_tower_angle_trim[C_AXIS]));
+      SERIAL_ECHOPAIR(" I", LINEAR_UNIT(delta_diagonal_rod_trim[A_AXIS]));
+      SERIAL_ECHOPAIR(" J", LINEAR_UNIT(delta_diagonal_rod_trim[B_AXIS]));
+      SERIAL_ECHOPAIR(" K", LINEAR_UNIT(delta_diagonal_rod_trim[C_AXIS]));
       SERIAL_EOL();
 
     #elif ENABLED(X_DUAL_ENDSTOPS) || ENABLED(Y_DUAL_ENDSTOPS) || ENABLED(Z_DUAL_ENDSTOPS)
@@ -1883,6 +2298,24 @@ void MarlinSettings::reset() {
 
     #endif // PIDTEMP || PIDTEMPBED
 
+    #if ENABLED(MPC_HOTEND)
+      if (!forReplay) {
+        CONFIG_ECHO_START;
+        SERIAL_ECHOLNPGM("MPC hotend model:");
+      }
+      HOTEND_LOOP() {
+        const Temperature::mpc_t &m = thermalManager.mpc[e];
+        CONFIG_ECHO_START;
+        SERIAL_ECHOPAIR("  M306 E", e);
+        SERIAL_ECHOPAIR(" P", m.heater_power);
+        SERIAL_ECHOPAIR(" C", m.block_heat_capacity);
+        SERIAL_ECHOPGM(" R"); SERIAL_ECHO_F(m.sensor_responsiveness, 4);
+        SERIAL_ECHOPGM(" A"); SERIAL_ECHO_F(m.ambient_xfer_coeff, 4);
+        SERIAL_ECHOPGM(" H"); SERIAL_ECHO_F(m.filament_heat_capacity_permm, 6);
+        SERIAL_ECHOLNPAIR(" T", m.ambient_temp);
+      }
+    #endif
+
     #if HAS_LCD_CONTRAST
       if (!forReplay) {
         CONFIG_ECHO_START;
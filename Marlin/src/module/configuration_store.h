@@ -25,15 +25,39 @@
 
 #include "../inc/MarlinConfig.h"
 
+/**
+ * Settings are stored as tagged records, in this order, each with its own
+ * version and CRC. M500 R<record> and M501 R<record> save or load just one.
+ */
+enum SettingsRecord : uint8_t {
+  SR_ALL = 0,
+  SR_STEPPERS,      //  1 : M92 M201 M203
+  SR_MOTION,        //  2 : M204 M205 M206 M218
+  SR_LEVELING,      //  3 : Fade height, MBL mesh, M851, ABL matrix and grid, UBL state
+  SR_DELTA,         //  4 : M665 M666, or dual endstop adjustments
+  SR_PREHEAT,       //  5 : M145
+  SR_TEMPERATURE,   //  6 : M301 M304
+  SR_LCD_CONTRAST,  //  7 : M250
+  SR_RETRACT,       //  8 : M207 M208 M209
+  SR_FILAMENT,      //  9 : M200
+  SR_TMC_CURRENT,   // 10 : M906
+  SR_LIN_ADVANCE,   // 11 : M900
+  SR_MOTOR_CURRENT, // 12 : M907
+  SR_COORDINATES,   // 13 : G54-G59.3
+  SR_SKEW,          // 14 : M852
+  SR_COUNT,
+  SR_MEASURE = 0xFF // Only measure the record sizes
+};
+
 class MarlinSettings {
   public:
     MarlinSettings() { }
 
     static void reset();
-    static bool save();
+    static bool save(const uint8_t only=SR_ALL);
 
     #if ENABLED(EEPROM_SETTINGS)
-      static bool load();
+      static bool load(const uint8_t only=SR_ALL);
 
       #if ENABLED(AUTO_BED_LEVELING_UBL) // Eventually make these available if any leveling system
                                          // That can store is enabled
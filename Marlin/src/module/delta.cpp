@@ -44,7 +44,8 @@ float delta_height,
       delta_diagonal_rod,
       delta_segments_per_second,
       delta_calibration_radius,
-      delta_tower_angle_trim[ABC];
+      delta_tower_angle_trim[ABC],
+      delta_diagonal_rod_trim[ABC];
 
 float delta_tower[ABC][2],
       delta_diagonal_rod_2_tower[ABC],
@@ -53,21 +54,28 @@ float delta_tower[ABC][2],
 float delta_safe_distance_from_top();
 
 /**
- * Recalculate factors used for delta kinematics whenever
- * settings have been changed (e.g., by M665).
+ * Recalculate only the tower positions and rod lengths,
+ * leaving the software endstops and homed state alone.
  */
-void recalc_delta_settings() {
-  const float trt[ABC] = DELTA_RADIUS_TRIM_TOWER,
-              drt[ABC] = DELTA_DIAGONAL_ROD_TRIM_TOWER;
+void recalc_delta_towers() {
+  const float trt[ABC] = DELTA_RADIUS_TRIM_TOWER;
   delta_tower[A_AXIS][X_AXIS] = cos(RADIANS(210 + delta_tower_angle_trim[A_AXIS])) * (delta_radius + trt[A_AXIS]); // front left tower
   delta_tower[A_AXIS][Y_AXIS] = sin(RADIANS(210 + delta_tower_angle_trim[A_AXIS])) * (delta_radius + trt[A_AXIS]);
   delta_tower[B_AXIS][X_AXIS] = cos(RADIANS(330 + delta_tower_angle_trim[B_AXIS])) * (delta_radius + trt[B_AXIS]); // front right tower
   delta_tower[B_AXIS][Y_AXIS] = sin(RADIANS(330 + delta_tower_angle_trim[B_AXIS])) * (delta_radius + trt[B_AXIS]);
   delta_tower[C_AXIS][X_AXIS] = cos(RADIANS( 90 + delta_tower_angle_trim[C_AXIS])) * (delta_radius + trt[C_AXIS]); // back middle tower
   delta_tower[C_AXIS][Y_AXIS] = sin(RADIANS( 90 + delta_tower_angle_trim[C_AXIS])) * (delta_radius + trt[C_AXIS]);
-  delta_diagonal_rod_2_tower[A_AXIS] = sq(delta_diagonal_rod + drt[A_AXIS]);
-  delta_diagonal_rod_2_tower[B_AXIS] = sq(delta_diagonal_rod + drt[B_AXIS]);
-  delta_diagonal_rod_2_tower[C_AXIS] = sq(delta_diagonal_rod + drt[C_AXIS]);
+  delta_diagonal_rod_2_tower[A_AXIS] = sq(delta_diagonal_rod + delta_diagonal_rod_trim[A_AXIS]);
+  delta_diagonal_rod_2_tower[B_AXIS] = sq(delta_diagonal_rod + delta_diagonal_rod_trim[B_AXIS]);
+  delta_diagonal_rod_2_tower[C_AXIS] = sq(delta_diagonal_rod + delta_diagonal_rod_trim[C_AXIS]);
+}
+
+/**
+ * Recalculate factors used for delta kinematics whenever
+ * settings have been changed (e.g., by M665).
+ */
+void recalc_delta_settings() {
+  recalc_delta_towers();
   update_software_endstops(Z_AXIS);
   axis_homed[X_AXIS] = axis_homed[Y_AXIS] = axis_homed[Z_AXIS] = false;
 }
@@ -125,6 +133,53 @@ void inverse_kinematics(const float raw[XYZ]) {
   // DELTA_DEBUG();
 }
 
+/**
+ * Delta Inverse Kinematics for a run of points
+ *
+ * Store the tower positions for the 'count' points that follow
+ * 'raw' at intervals of 'step' in the out[] array.
+ *
+ * Along a straight line the value under each square root is a
+ * quadratic, so it can be advanced by finite differences. That
+ * takes two additions per tower instead of two squares and five
+ * additions, leaving only the square roots.
+ *
+ * As an arm nears flat the square root magnifies the rounding in
+ * the running sums. The quadratic is smallest at one end of the
+ * run, so if an arm gets within about 6 degrees of flat there the
+ * points are solved directly, exactly as inverse_kinematics() would.
+ */
+void inverse_kinematics_batch(const float raw[XYZ], const float step[XYZ], const uint8_t count, float out[][ABC]) {
+  const float step_2 = HYPOT2(step[X_AXIS], step[Y_AXIS]);
+  float radicand[ABC], difference[ABC];
+  bool near_flat = false;
+  for (uint8_t t = A_AXIS; t <= C_AXIS; t++) {
+    const float dx = delta_tower[t][X_AXIS] - raw[X_AXIS],
+                dy = delta_tower[t][Y_AXIS] - raw[Y_AXIS],
+                flat_2 = delta_diagonal_rod_2_tower[t] * 0.01; // Arm within 1/10 of its length of flat
+    radicand[t] = delta_diagonal_rod_2_tower[t] - HYPOT2(dx, dy);
+    difference[t] = 2 * (dx * step[X_AXIS] + dy * step[Y_AXIS]) - step_2;
+    if (radicand[t] < flat_2 || delta_diagonal_rod_2_tower[t] - HYPOT2(dx - count * step[X_AXIS], dy - count * step[Y_AXIS]) < flat_2)
+      near_flat = true;
+  }
+
+  float x = raw[X_AXIS], y = raw[Y_AXIS], z = raw[Z_AXIS];
+  for (uint8_t i = 0; i < count; i++) {
+    z += step[Z_AXIS];
+    if (near_flat) {
+      x += step[X_AXIS];
+      y += step[Y_AXIS];
+      for (uint8_t t = A_AXIS; t <= C_AXIS; t++)
+        out[i][t] = z + _SQRT(delta_diagonal_rod_2_tower[t] - HYPOT2(delta_tower[t][X_AXIS] - x, delta_tower[t][Y_AXIS] - y));
+    }
+    else for (uint8_t t = A_AXIS; t <= C_AXIS; t++) {
+      radicand[t] += difference[t];
+      difference[t] -= 2 * step_2;
+      out[i][t] = z + _SQRT(radicand[t]);
+    }
+  }
+}
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
@@ -257,6 +312,18 @@ bool home_delta() {
 
   SYNC_PLAN_POSITION_KINEMATIC();
 
+  #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    // Home is where the endstops switched. The carriages stopped above it.
+    inverse_kinematics(current_position);
+    planner.set_position_mm(
+      delta[A_AXIS] + homing_overrun[A_AXIS],
+      delta[B_AXIS] + homing_overrun[B_AXIS],
+      delta[C_AXIS] + homing_overrun[C_AXIS],
+      current_position[E_AXIS]
+    );
+    set_current_from_steppers_for_axis(ALL_AXES);
+  #endif
+
   #if ENABLED(DEBUG_LEVELING_FEATURE)
     if (DEBUGGING(LEVELING)) DEBUG_POS("<<< home_delta", current_position);
   #endif
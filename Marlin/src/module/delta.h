@@ -33,7 +33,8 @@ extern float delta_height,
              delta_diagonal_rod,
              delta_segments_per_second,
              delta_calibration_radius,
-             delta_tower_angle_trim[ABC];
+             delta_tower_angle_trim[ABC],
+             delta_diagonal_rod_trim[ABC];
 
 extern float delta_tower[ABC][2],
              delta_diagonal_rod_2_tower[ABC],
@@ -45,6 +46,12 @@ extern float delta_tower[ABC][2],
  */
 void recalc_delta_settings();
 
+/**
+ * Recalculate only the tower positions and rod lengths,
+ * leaving the software endstops and homed state alone.
+ */
+void recalc_delta_towers();
+
 /**
  * Delta Inverse Kinematics
  *
@@ -71,6 +78,9 @@ void recalc_delta_settings();
    */
   float Q_rsqrt(float number);
   #define _SQRT(n) (1.0f / Q_rsqrt(n))
+#elif defined(__ARM_FP)
+  // A Cortex-M4F (e.g., Teensy 3.5/3.6) has a single-precision sqrt instruction
+  #define _SQRT(n) sqrtf(n)
 #else
   #define _SQRT(n) SQRT(n)
 #endif
@@ -91,6 +101,16 @@ void recalc_delta_settings();
 
 void inverse_kinematics(const float raw[XYZ]);
 
+/**
+ * The most points to solve in one inverse_kinematics_batch call.
+ * Rounding error in the running sums stays below 1um while every arm is
+ * more than about 6 degrees from flat, and closer to flat the batch solves
+ * its points directly ("marlin -k" in the Linux simulation).
+ */
+#define DELTA_IK_BATCH 8
+
+void inverse_kinematics_batch(const float raw[XYZ], const float step[XYZ], const uint8_t count, float out[][ABC]);
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
@@ -312,6 +312,9 @@ void Endstops::M119() {
 // Check endstops - Called from ISR!
 void Endstops::update() {
 
+  // The temperature ISR can get here between blocks, with nothing to test against
+  if (!stepper.current_block) return;
+
   #define _ENDSTOP(AXIS, MINMAX) AXIS ##_## MINMAX
   #define _ENDSTOP_PIN(AXIS, MINMAX) AXIS ##_## MINMAX ##_PIN
   #define _ENDSTOP_INVERTING(AXIS, MINMAX) AXIS ##_## MINMAX ##_ENDSTOP_INVERTING
@@ -325,8 +328,12 @@ void Endstops::update() {
   #define UPDATE_ENDSTOP(AXIS,MINMAX) do { \
       UPDATE_ENDSTOP_BIT(AXIS, MINMAX); \
       if (TEST_ENDSTOP(_ENDSTOP(AXIS, MINMAX)) && stepper.current_block->steps[_AXIS(AXIS)] > 0) { \
-        _ENDSTOP_HIT(AXIS, MINMAX); \
-        stepper.endstop_triggered(_AXIS(AXIS)); \
+        if (TEST(endstop_hit_bits, _ENDSTOP(AXIS, MINMAX))) \
+          stepper.kill_current_block(); /* Still closed on the next block of the move. Keep the first position. */ \
+        else { \
+          _ENDSTOP_HIT(AXIS, MINMAX); \
+          stepper.endstop_triggered(_AXIS(AXIS)); \
+        } \
       } \
     } while(0)
 
@@ -508,6 +508,140 @@ float soft_endstop_min[XYZ] = { X_MIN_BED, Y_MIN_BED, Z_MIN_POS },
     #define ADJUST_DELTA(V) NOOP
   #endif
 
+  #if ENABLED(KINEMATIC_CHORD_SEGMENTS)
+
+    /**
+     * How far the effector strays from the Cartesian midpoint of a move
+     * from 'a' to 'b' when the joints move in a straight line from 'ja' to 'jb'.
+     */
+    static float kinematic_chord_error(const float a[XYZ], const float b[XYZ], const float ja[ABC], const float jb[ABC]) {
+      #if ENABLED(DELTA)
+        forward_kinematics_DELTA((ja[A_AXIS] + jb[A_AXIS]) * 0.5, (ja[B_AXIS] + jb[B_AXIS]) * 0.5, (ja[C_AXIS] + jb[C_AXIS]) * 0.5);
+        return SQRT(
+          sq(cartes[X_AXIS] - (a[X_AXIS] + b[X_AXIS]) * 0.5) +
+          sq(cartes[Y_AXIS] - (a[Y_AXIS] + b[Y_AXIS]) * 0.5) +
+          sq(cartes[Z_AXIS] - (a[Z_AXIS] + b[Z_AXIS]) * 0.5)
+        );
+      #else
+        forward_kinematics_SCARA((ja[A_AXIS] + jb[A_AXIS]) * 0.5, (ja[B_AXIS] + jb[B_AXIS]) * 0.5);
+        return HYPOT(cartes[X_AXIS] - (a[X_AXIS] + b[X_AXIS]) * 0.5, cartes[Y_AXIS] - (a[Y_AXIS] + b[Y_AXIS]) * 0.5);
+      #endif
+    }
+
+    #if IS_SCARA
+      #define MIN_CHORD_SEGMENT_MM 0.25 // SCARA minimum segment size is 0.25mm
+    #else
+      #define MIN_CHORD_SEGMENT_MM 0.1
+    #endif
+
+    /**
+     * Buffer a kinematic move as segments of varying length, each as long
+     * as it can be while staying within KINEMATIC_CHORD_ERROR of the straight
+     * line (and of the leveling mesh under it). A segment that strays too far
+     * is halved until it fits, and the next one starts out twice as long.
+     *
+     * 'max_segments' is the segment count for DELTA_SEGMENTS_PER_SECOND.
+     * No segment is longer than this allows.
+     */
+    static void adaptive_kinematic_move_to(const float rtarget[XYZE], const float &cartesian_mm, const uint16_t max_segments, const float &fr_mm_s) {
+
+      const float max_step = 1.0 / float(max_segments),
+                  min_step = min(max_step, float(MIN_CHORD_SEGMENT_MM) / cartesian_mm),
+                  diff[XYZE] = {
+                    rtarget[X_AXIS] - current_position[X_AXIS],
+                    rtarget[Y_AXIS] - current_position[Y_AXIS],
+                    rtarget[Z_AXIS] - current_position[Z_AXIS],
+                    rtarget[E_AXIS] - current_position[E_AXIS]
+                  };
+
+      // Start of the segment, and its unleveled joint positions
+      float start[XYZE], jstart[ABC];
+      COPY(start, current_position);
+      inverse_kinematics(start);
+      COPY(jstart, delta);
+
+      #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+        float zstart = planner.leveling_active ? bilinear_z_offset(start) : 0.0;
+      #endif
+
+      #if IS_SCARA && ENABLED(SCARA_FEEDRATE_SCALING)
+        float oldA = stepper.get_axis_position_degrees(A_AXIS),
+              oldB = stepper.get_axis_position_degrees(B_AXIS);
+      #endif
+
+      float end[XYZE], t = 0.0, step = max_step;
+      for (;;) {
+
+        static millis_t next_idle_ms = millis() + 200UL;
+        thermalManager.manage_heater();  // This returns immediately if not really needed.
+        if (ELAPSED(millis(), next_idle_ms)) {
+          next_idle_ms = millis() + 200UL;
+          idle();
+        }
+
+        // Take in a remainder too short to stand alone, which is mostly rounding
+        if (step > 1.0 - t - min_step * 0.5) step = 1.0 - t;
+
+        // Shorten the segment until it follows the path closely enough
+        bool last;
+        for (;;) {
+          last = step >= 1.0 - t;
+          if (last) {
+            step = 1.0 - t;
+            LOOP_XYZE(i) end[i] = rtarget[i]; // COPY can't size a parameter
+          }
+          else
+            LOOP_XYZE(i) end[i] = current_position[i] + diff[i] * (t + step);
+
+          inverse_kinematics(end);
+          if (step <= min_step) break;
+
+          float err = kinematic_chord_error(start, end, jstart, delta);
+
+          #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+            // The mesh under the segment may bend too
+            if (planner.leveling_active) {
+              const float mid[XYZ] = { (start[X_AXIS] + end[X_AXIS]) * 0.5, (start[Y_AXIS] + end[Y_AXIS]) * 0.5, (start[Z_AXIS] + end[Z_AXIS]) * 0.5 };
+              err += FABS(bilinear_z_offset(mid) - (zstart + bilinear_z_offset(end)) * 0.5);
+            }
+          #endif
+
+          if (err <= KINEMATIC_CHORD_ERROR) break;
+          step = max(step * 0.5, min_step);
+        }
+
+        const float segment_mm = cartesian_mm * step;
+
+        COPY(start, end);
+        COPY(jstart, delta);
+        #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+          if (planner.leveling_active) zstart = bilinear_z_offset(end);
+        #endif
+
+        ADJUST_DELTA(end); // Adjust Z if bed leveling is enabled
+
+        #if IS_SCARA && ENABLED(SCARA_FEEDRATE_SCALING)
+          // For SCARA scale the feed rate from mm/s to degrees/s
+          // Use ratio between the length of the segment and the larger angle change
+          const float adiff = abs(delta[A_AXIS] - oldA),
+                      bdiff = abs(delta[B_AXIS] - oldB);
+          planner.buffer_line(delta[A_AXIS], delta[B_AXIS], delta[C_AXIS], end[E_AXIS], max(adiff, bdiff) * fr_mm_s / max(segment_mm, 0.1), active_extruder);
+          oldA = delta[A_AXIS];
+          oldB = delta[B_AXIS];
+        #else
+          planner.buffer_line(delta[A_AXIS], delta[B_AXIS], delta[C_AXIS], end[E_AXIS], fr_mm_s, active_extruder, segment_mm);
+        #endif
+
+        if (last) break;
+
+        // Try a longer segment next time
+        t += step;
+        step = min(step * 2, max_step);
+      }
+    }
+
+  #endif // KINEMATIC_CHORD_SEGMENTS
+
   /**
    * Prepare a linear move in a DELTA or SCARA setup.
    *
@@ -562,6 +696,12 @@ float soft_endstop_min[XYZ] = { X_MIN_BED, Y_MIN_BED, Z_MIN_POS },
     // At least one segment is required
     NOLESS(segments, 1);
 
+    #if ENABLED(KINEMATIC_CHORD_SEGMENTS)
+      // Only split the move where the path bends
+      adaptive_kinematic_move_to(rtarget, cartesian_mm, segments, _feedrate_mm_s);
+      return false;
+    #endif
+
     // The approximate length of each segment
     const float inv_segments = 1.0 / float(segments),
                 segment_distance[XYZE] = {
@@ -587,6 +727,17 @@ float soft_endstop_min[XYZ] = { X_MIN_BED, Y_MIN_BED, Z_MIN_POS },
     float raw[XYZE];
     COPY(raw, current_position);
 
+    #if ENABLED(DELTA)
+      #define IK_BATCH DELTA_IK_BATCH
+    #elif ENABLED(SCARA_FAST_TRIG)
+      #define IK_BATCH SCARA_IK_BATCH
+    #endif
+
+    #ifdef IK_BATCH
+      // Solve several segments at a time
+      float batch[IK_BATCH][ABC];
+      uint8_t batch_index = IK_BATCH;
+    #endif
 
     // Calculate and execute the segments
     while (--segments) {
@@ -598,10 +749,15 @@ float soft_endstop_min[XYZ] = { X_MIN_BED, Y_MIN_BED, Z_MIN_POS },
         idle();
       }
 
-      LOOP_XYZE(i) raw[i] += segment_distance[i];
-      #if ENABLED(DELTA)
-        DELTA_RAW_IK(); // Delta can inline its kinematics
+      #ifdef IK_BATCH
+        if (batch_index >= IK_BATCH) {
+          inverse_kinematics_batch(raw, segment_distance, min(segments, IK_BATCH), batch);
+          batch_index = 0;
+        }
+        LOOP_XYZE(i) raw[i] += segment_distance[i];
+        COPY(delta, batch[batch_index++]);
       #else
+        LOOP_XYZE(i) raw[i] += segment_distance[i];
         inverse_kinematics(raw);
       #endif
 
@@ -640,6 +796,57 @@ float soft_endstop_min[XYZ] = { X_MIN_BED, Y_MIN_BED, Z_MIN_POS },
 
 #else // !IS_KINEMATIC
 
+  #if ENABLED(ADAPTIVE_LEVELED_SEGMENTS)
+
+    #if ENABLED(SEGMENT_LEVELED_MOVES)
+
+      // Leveling offset at a point, ignoring fade
+      inline float leveled_z_offset(const float raw[XYZ]) {
+        #if ENABLED(MESH_BED_LEVELING)
+          return mbl.get_z(raw[X_AXIS], raw[Y_AXIS]
+            #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
+              , 1.0
+            #endif
+          );
+        #else
+          return bilinear_z_offset(raw);
+        #endif
+      }
+
+      // The mesh can only change course at the edge of a cell
+      #if ENABLED(MESH_BED_LEVELING)
+        #define LEVELED_CELL_SIZE min(MESH_X_DIST, MESH_Y_DIST)
+      #else
+        #define LEVELED_CELL_SIZE min(bilinear_grid_spacing[X_AXIS], bilinear_grid_spacing[Y_AXIS])
+      #endif
+
+    #else
+
+      /**
+       * Buffer a move that stays inside one mesh cell. Along a straight line
+       * the bilinear surface is a parabola, curving by the cell's twist times
+       * the fraction of the cell crossed in X and in Y. Split the move into
+       * just enough equal parts to stay within LEVELED_SEGMENT_ERROR of it.
+       */
+      void cell_line_to_destination(const float fr_mm_s, const float &twist, const float &cell_x, const float &cell_y) {
+        const float curve = twist * (destination[X_AXIS] - current_position[X_AXIS]) * (destination[Y_AXIS] - current_position[Y_AXIS]) / (cell_x * cell_y);
+        const uint16_t segments = CEIL(SQRT(FABS(curve) * (0.25 / (LEVELED_SEGMENT_ERROR))));
+        if (segments > 1) {
+          const float inv_segments = 1.0 / float(segments);
+          float raw[XYZE];
+          for (uint16_t s = 1; s < segments; s++) {
+            const float fraction = float(s) * inv_segments;
+            LOOP_XYZE(i) raw[i] = current_position[i] + (destination[i] - current_position[i]) * fraction;
+            planner.buffer_line_kinematic(raw, fr_mm_s, active_extruder);
+          }
+        }
+        buffer_line_to_destination(fr_mm_s);
+      }
+
+    #endif
+
+  #endif // ADAPTIVE_LEVELED_SEGMENTS
+
   #if ENABLED(SEGMENT_LEVELED_MOVES)
 
     /**
@@ -671,6 +878,61 @@ float soft_endstop_min[XYZ] = { X_MIN_BED, Y_MIN_BED, Z_MIN_POS },
       if (UNEAR_ZERO(cartesian_mm)) cartesian_mm = FABS(ediff);
       if (UNEAR_ZERO(cartesian_mm)) return;
 
+      #if ENABLED(ADAPTIVE_LEVELED_SEGMENTS)
+
+        // Segments run from 'segment_size' up to a full mesh cell, and are
+        // only shortened where the mesh bends more than LEVELED_SEGMENT_ERROR.
+        const float max_step = min(1.0, float(LEVELED_CELL_SIZE) / cartesian_mm),
+                    min_step = min(max_step, segment_size / cartesian_mm),
+                    diff[XYZE] = { xdiff, ydiff, zdiff, ediff };
+
+        float start[XYZE], end[XYZE], t = 0.0, step = max_step;
+        COPY(start, current_position);
+        float zstart = leveled_z_offset(start);
+
+        for (;;) {
+          static millis_t next_idle_ms = millis() + 200UL;
+          thermalManager.manage_heater();  // This returns immediately if not really needed.
+          if (ELAPSED(millis(), next_idle_ms)) {
+            next_idle_ms = millis() + 200UL;
+            idle();
+          }
+
+          // Take in a remainder too short to stand alone, which is mostly rounding
+          if (step > 1.0 - t - min_step * 0.5) step = 1.0 - t;
+
+          // Shorten the segment until it follows the mesh closely enough
+          bool last;
+          float zend;
+          for (;;) {
+            last = step >= 1.0 - t;
+            if (last) {
+              step = 1.0 - t;
+              COPY(end, destination);
+            }
+            else
+              LOOP_XYZE(i) end[i] = current_position[i] + diff[i] * (t + step);
+
+            zend = leveled_z_offset(end);
+            if (step <= min_step) break;
+
+            const float mid[XYZ] = { (start[X_AXIS] + end[X_AXIS]) * 0.5, (start[Y_AXIS] + end[Y_AXIS]) * 0.5, (start[Z_AXIS] + end[Z_AXIS]) * 0.5 };
+            if (FABS(leveled_z_offset(mid) - (zstart + zend) * 0.5) <= LEVELED_SEGMENT_ERROR) break;
+            step = max(step * 0.5, min_step);
+          }
+
+          planner.buffer_line_kinematic(end, fr_mm_s, active_extruder);
+          if (last) return;
+
+          // Try a longer segment next time
+          COPY(start, end);
+          zstart = zend;
+          t += step;
+          step = min(step * 2, max_step);
+        }
+
+      #endif // ADAPTIVE_LEVELED_SEGMENTS
+
       // The length divided by the segment size
       // At least one segment is required
       uint16_t segments = cartesian_mm / segment_size;
@@ -953,6 +1215,27 @@ inline float get_homing_bump_feedrate(const AxisEnum axis) {
   return homing_feedrate(axis) / hbd;
 }
 
+#if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+
+  /**
+   * How far an axis ran on past the endstop edge of the last move, in mm.
+   *
+   * The stepper ISR only stops the motors an interrupt or two after the
+   * pin interrupt latched their positions, so the overrun grows with the
+   * speed. Zero if no endstop was hit, or if the latch is further off than
+   * a torn or stale one could be.
+   */
+  float endstop_overrun_mm(const AxisEnum axis) {
+    if (!Endstops::endstop_hit_bits) return 0;
+    const float overrun = stepper.get_axis_position_mm(axis) - stepper.triggered_position_mm(axis);
+    return FABS(overrun) * planner.axis_steps_per_mm[axis] > 64 ? 0 : overrun;
+  }
+
+  // Overrun of the last homing move that hit each endstop
+  float homing_overrun[XYZ];
+
+#endif
+
 /**
  * Home an individual linear axis
  */
@@ -993,6 +1276,21 @@ static void do_homing_move(const AxisEnum axis, const float distance, const floa
 
   stepper.synchronize();
 
+  #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    // Dual endstops don't latch, as each motor stops on its own
+    if (Endstops::endstop_hit_bits
+      #if ENABLED(X_DUAL_ENDSTOPS)
+        && axis != X_AXIS
+      #endif
+      #if ENABLED(Y_DUAL_ENDSTOPS)
+        && axis != Y_AXIS
+      #endif
+      #if ENABLED(Z_DUAL_ENDSTOPS)
+        && axis != Z_AXIS
+      #endif
+    ) homing_overrun[axis] = endstop_overrun_mm(axis);
+  #endif
+
   #if QUIET_PROBING
     if (axis == Z_AXIS) probing_pause(false);
   #endif
@@ -1144,6 +1442,10 @@ void homeaxis(const AxisEnum axis) {
     if (axis == Z_AXIS && DEPLOY_PROBE()) return;
   #endif
 
+  #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    homing_overrun[axis] = 0;
+  #endif
+
   // Set flags for X, Y, Z motor locking
   #if ENABLED(X_DUAL_ENDSTOPS)
     if (axis == X_AXIS) stepper.set_homing_flag_x(true);
@@ -1234,6 +1536,9 @@ void homeaxis(const AxisEnum axis) {
   #if IS_SCARA
 
     set_axis_is_at_home(axis);
+    #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+      current_position[axis] += homing_overrun[axis]; // Home is where the endstop switched
+    #endif
     SYNC_PLAN_POSITION_KINEMATIC();
 
   #elif ENABLED(DELTA)
@@ -1255,6 +1560,9 @@ void homeaxis(const AxisEnum axis) {
     // For cartesian/core machines,
     // set the axis to its home position
     set_axis_is_at_home(axis);
+    #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+      current_position[axis] += homing_overrun[axis]; // Home is where the endstop switched
+    #endif
     sync_plan_position();
 
     destination[axis] = current_position[axis];
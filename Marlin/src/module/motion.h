@@ -140,6 +140,10 @@ void line_to_current_position();
  */
 void buffer_line_to_destination(const float fr_mm_s);
 
+#if ENABLED(ADAPTIVE_LEVELED_SEGMENTS) && DISABLED(SEGMENT_LEVELED_MOVES)
+  void cell_line_to_destination(const float fr_mm_s, const float &twist, const float &cell_x, const float &cell_y);
+#endif
+
 #if IS_KINEMATIC
   void prepare_uninterpolated_move_to_destination(const float fr_mm_s=0.0);
 #endif
@@ -188,6 +192,11 @@ void clean_up_after_endstop_or_probe_move();
 
 void set_axis_is_at_home(const AxisEnum axis);
 
+#if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+  float endstop_overrun_mm(const AxisEnum axis);
+  extern float homing_overrun[XYZ];
+#endif
+
 void homeaxis(const AxisEnum axis);
 #define HOMEAXIS(LETTER) homeaxis(LETTER##_AXIS)
 
@@ -84,6 +84,10 @@
   #include "../feature/mixing.h"
 #endif
 
+#if ENABLED(CPU_PROFILER)
+  #include "../feature/profiler.h"
+#endif
+
 Planner planner;
 
   // public:
@@ -426,6 +430,37 @@ void Planner::recalculate() {
 
 #endif // AUTOTEMP
 
+#if ENABLED(MPC_HOTEND)
+
+  /**
+   * Get the average rate (mm/s of filament) at which the given extruder
+   * will be fed over the next window_ms of planned moves, for use as
+   * heater feed-forward. Retractions don't carry heat away and are ignored.
+   */
+  float Planner::get_upcoming_e_rate(const uint8_t extruder, const millis_t window_ms) {
+    const float window = window_ms * 0.001;
+    float e_mm = 0.0, secs = 0.0;
+    const uint8_t head = block_buffer_head;
+    for (uint8_t b = block_buffer_tail; b != head && secs < window; b = next_block_index(b)) {
+      const block_t * const block = &block_buffer[b];
+      if (block->nominal_speed <= 0) continue;
+      float block_secs = block->millimeters / block->nominal_speed,
+            block_e = 0.0;
+      if (block->active_extruder == extruder && !TEST(block->direction_bits, E_AXIS))
+        block_e = block->steps[E_AXIS] * steps_to_mm[E_AXIS_N];
+      if (secs + block_secs > window) {         // Only the part of the block inside the window
+        const float frac = (window - secs) / block_secs;
+        block_e *= frac;
+        block_secs *= frac;
+      }
+      e_mm += block_e;
+      secs += block_secs;
+    }
+    return secs > 0 ? e_mm / secs : 0.0;
+  }
+
+#endif // MPC_HOTEND
+
 /**
  * Maintain fans, paste extruder pressure,
  */
@@ -706,8 +741,9 @@ void Planner::calculate_volumetric_multipliers() {
  *  target      - target position in steps units
  *  fr_mm_s     - (target) speed of the move
  *  extruder    - target extruder
+ *  millimeters - the length of the move, if not the length in axis space
  */
-void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const uint8_t extruder) {
+void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/) {
 
   const int32_t da = target[X_AXIS] - position[X_AXIS],
                 db = target[Y_AXIS] - position[Y_AXIS],
@@ -786,6 +822,10 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
   // Rest here until there is room in the buffer.
   while (block_buffer_tail == next_buffer_head) idle();
 
+  #if ENABLED(CPU_PROFILER)
+    ProfileScope profile(PROFILE_PLANNER); // Not counting the wait for room
+  #endif
+
   // Prepare to set up new block
   block_t* block = &block_buffer[block_buffer_head];
 
@@ -1008,6 +1048,10 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
   if (block->steps[X_AXIS] < MIN_STEPS_PER_SEGMENT && block->steps[Y_AXIS] < MIN_STEPS_PER_SEGMENT && block->steps[Z_AXIS] < MIN_STEPS_PER_SEGMENT) {
     block->millimeters = FABS(delta_mm[E_AXIS]);
   }
+  else if (millimeters) {
+    // Kinematic segments are planned by their Cartesian length
+    block->millimeters = millimeters;
+  }
   else {
     block->millimeters = SQRT(
       #if CORE_IS_XY
@@ -1396,11 +1440,12 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
  *
  * Leveling and kinematics should be applied ahead of calling this.
  *
- *  a,b,c,e   - target positions in mm and/or degrees
- *  fr_mm_s   - (target) speed of the move
- *  extruder  - target extruder
+ *  a,b,c,e     - target positions in mm and/or degrees
+ *  fr_mm_s     - (target) speed of the move
+ *  extruder    - target extruder
+ *  millimeters - the length of the move, if not the length in axis space
  */
-void Planner::_buffer_line(const float &a, const float &b, const float &c, const float &e, const float &fr_mm_s, const uint8_t extruder) {
+void Planner::_buffer_line(const float &a, const float &b, const float &c, const float &e, const float &fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/) {
   // When changing extruders recalculate steps corresponding to the E position
   #if ENABLED(DISTINCT_E_FACTORS)
     if (last_extruder != extruder && axis_steps_per_mm[E_AXIS_N] != axis_steps_per_mm[E_AXIS + last_extruder]) {
@@ -1455,12 +1500,12 @@ void Planner::_buffer_line(const float &a, const float &b, const float &c, const
     #define _BETWEEN(A) (position[A##_AXIS] + target[A##_AXIS]) >> 1
     const int32_t between[XYZE] = { _BETWEEN(X), _BETWEEN(Y), _BETWEEN(Z), _BETWEEN(E) };
     DISABLE_STEPPER_DRIVER_INTERRUPT();
-    _buffer_steps(between, fr_mm_s, extruder);
-    _buffer_steps(target, fr_mm_s, extruder);
+    _buffer_steps(between, fr_mm_s, extruder, millimeters * 0.5);
+    _buffer_steps(target, fr_mm_s, extruder, millimeters * 0.5);
     ENABLE_STEPPER_DRIVER_INTERRUPT();
   }
   else
-    _buffer_steps(target, fr_mm_s, extruder);
+    _buffer_steps(target, fr_mm_s, extruder, millimeters);
 
   stepper.wake_up();
 
@@ -52,6 +52,20 @@
 
 float zprobe_zoffset; // Initialized by settings.load()
 
+#if ENABLED(PROBE_ON_THE_FLY)
+  #include "stepper.h"
+  uint16_t probe_touches_saved;   // Fast approaches skipped thanks to a good prediction
+  static bool probe_near_bed;     // Only lifted off the bed after the last touch
+#endif
+
+#if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+  float probe_std_error;          // Standard error of the last probed point (mm)
+  static float pooled_ss;         // Squared deviations of all points since the reset
+  static uint16_t pooled_dof;     // ...and their degrees of freedom
+
+  void reset_probe_statistics() { pooled_ss = 0; pooled_dof = 0; }
+#endif
+
 #if HAS_Z_SERVO_ENDSTOP
   #include "../module/servo.h"
   const int z_servo_angle[2] = Z_SERVO_ANGLES;
@@ -356,6 +370,10 @@ inline void do_probe_raise(const float z_raise) {
 // returns false for ok and true for failure
 bool set_probe_deployed(const bool deploy) {
 
+  #if ENABLED(PROBE_ON_THE_FLY)
+    finish_probe_raise();
+  #endif
+
   // Can be extended to servo probes, if needed.
   #if ENABLED(PROBE_IS_TRIGGERED_WHEN_STOWED_TEST)
     #if ENABLED(Z_MIN_PROBE_ENDSTOP)
@@ -448,6 +466,9 @@ bool set_probe_deployed(const bool deploy) {
   return false;
 }
 
+// Z where the last do_probe_move stopped or, with endstop interrupts, where the probe switched
+static float probe_trigger_z;
+
 /**
  * @brief Used by run_z_probe to do a single Z probe move.
  *
@@ -490,6 +511,10 @@ static bool do_probe_move(const float z, const float fr_mm_m) {
     if (probe_triggered && set_bltouch_deployed(false)) return true;
   #endif
 
+  #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    const float overrun = probe_triggered ? endstop_overrun_mm(Z_AXIS) : 0;
+  #endif
+
   // Clear endstop flags
   endstops.hit_on_purpose();
 
@@ -499,6 +524,12 @@ static bool do_probe_move(const float z, const float fr_mm_m) {
   // Tell the planner where we actually are
   SYNC_PLAN_POSITION_KINEMATIC();
 
+  probe_trigger_z = current_position[Z_AXIS]
+    #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+      - overrun // The motors ran on past the switch. On a delta every tower ran on as far as Z did.
+    #endif
+  ;
+
   #if ENABLED(DEBUG_LEVELING_FEATURE)
     if (DEBUGGING(LEVELING)) DEBUG_POS("<<< do_probe_move", current_position);
   #endif
@@ -506,13 +537,90 @@ static bool do_probe_move(const float z, const float fr_mm_m) {
   return !probe_triggered;
 }
 
+#if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+
+  /**
+   * Take slow touches at the current XY until the mean is known to within
+   * PROBE_SAMPLE_TOLERANCE (about 95% confidence).
+   *
+   * The spread of the points probed so far stands in for the spread here,
+   * so with a repeatable probe a single touch may be enough. A point whose
+   * own touches disagree more than that takes more, up to PROBE_SAMPLES_MAX.
+   * A touch further than PROBE_OUTLIER_LIMIT from the median is discarded.
+   *
+   * @return The mean raw Z, or NAN if the probe failed
+   */
+  static float sample_z_probe() {
+    float z[PROBE_SAMPLES_MAX], mean = 0, ss = 0, s2 = 0;
+    uint8_t n = 0;
+
+    for (uint8_t touches = 0; touches < PROBE_SAMPLES_MAX;) {
+      if (touches) do_blocking_move_to_z(current_position[Z_AXIS] + (PROBE_SAMPLE_LIFT), MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+      if (do_probe_move(-10, Z_PROBE_SPEED_SLOW)) return NAN;
+      z[n++] = probe_trigger_z;
+      touches++;
+
+      // Discard the touch furthest from the median, if it is too far
+      if (n >= 3) {
+        float sorted[PROBE_SAMPLES_MAX];
+        for (uint8_t i = 0; i < n; i++) {
+          uint8_t j = i;
+          for (; j && sorted[j - 1] > z[i]; j--) sorted[j] = sorted[j - 1];
+          sorted[j] = z[i];
+        }
+        const float median = (n & 1) ? sorted[n >> 1] : 0.5 * (sorted[(n >> 1) - 1] + sorted[n >> 1]);
+        uint8_t worst = 0;
+        for (uint8_t i = 1; i < n; i++)
+          if (FABS(z[i] - median) > FABS(z[worst] - median)) worst = i;
+        if (FABS(z[worst] - median) > PROBE_OUTLIER_LIMIT) {
+          #if ENABLED(DEBUG_LEVELING_FEATURE)
+            if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPAIR("Outlier Z:", z[worst]);
+          #endif
+          z[worst] = z[--n];
+        }
+      }
+
+      mean = 0;
+      for (uint8_t i = 0; i < n; i++) mean += z[i];
+      mean /= n;
+      ss = 0;
+      for (uint8_t i = 0; i < n; i++) ss += sq(z[i] - mean);
+
+      // Use the pooled variance, or this point's own if it is worse
+      const uint16_t dof = pooled_dof + n - 1;
+      if (!dof) continue;
+      s2 = (pooled_ss + ss) / dof;
+      if (n > 1) NOLESS(s2, ss / (n - 1));
+
+      if (n >= PROBE_SAMPLES_MIN && 4 * s2 <= sq(PROBE_SAMPLE_TOLERANCE) * n) break;
+    }
+
+    pooled_ss += ss;
+    pooled_dof += n - 1;
+    probe_std_error = pooled_dof ? SQRT(s2 / n) : NAN;
+
+    #if ENABLED(DEBUG_LEVELING_FEATURE)
+      if (DEBUGGING(LEVELING)) {
+        SERIAL_ECHOPAIR("Sampled Z:", mean);
+        SERIAL_ECHOPAIR(" Touches:", n);
+        SERIAL_ECHOLNPAIR(" Std Error:", probe_std_error);
+      }
+    #endif
+
+    return mean;
+  }
+
+#endif // PROBE_ADAPTIVE_SAMPLING
+
 /**
  * @details Used by probe_pt to do a single Z probe.
- *          Leaves current_position[Z_AXIS] at the height where the probe triggered.
+ *          Leaves current_position[Z_AXIS] at the height where the probe stopped.
+ *          With PROBE_ADAPTIVE_SAMPLING the mean of several touches is returned.
  *
+ * @param  predicted_z  Expected raw Z of the bed, or NAN if unknown
  * @return The raw Z position where the probe was triggered
  */
-static float run_z_probe() {
+static float run_z_probe(const float predicted_z=NAN) {
 
   #if ENABLED(DEBUG_LEVELING_FEATURE)
     if (DEBUGGING(LEVELING)) DEBUG_POS(">>> run_z_probe", current_position);
@@ -521,18 +629,40 @@ static float run_z_probe() {
   // Prevent stepper_inactive_time from running out and EXTRUDER_RUNOUT_PREVENT from extruding
   gcode.refresh_cmd_timeout();
 
+  #if ENABLED(PROBE_DOUBLE_TOUCH) && ENABLED(DEBUG_LEVELING_FEATURE)
+    float first_probe_z = NAN;
+  #endif
+
+  #if ENABLED(PROBE_ON_THE_FLY)
+    // With a predicted bed height, approach it quickly and start the slow
+    // probe from just above. Only if the probe triggers early is this the
+    // first touch, and the usual clearance move is needed.
+    const bool approached = !isnan(predicted_z) && predicted_z + (PROBE_PREDICT_MARGIN) < current_position[Z_AXIS];
+    if (approached) {
+      if (!do_probe_move(predicted_z + (PROBE_PREDICT_MARGIN), Z_PROBE_SPEED_FAST))
+        do_blocking_move_to_z(current_position[Z_AXIS] + Z_CLEARANCE_BETWEEN_PROBES, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+      else
+        probe_touches_saved++;
+    }
+  #else
+    UNUSED(predicted_z);
+    constexpr bool approached = false;
+  #endif
+
   #if ENABLED(PROBE_DOUBLE_TOUCH)
 
-    // Do a first probe at the fast speed
-    if (do_probe_move(-10, Z_PROBE_SPEED_FAST)) return NAN;
+    if (!approached) {
+      // Do a first probe at the fast speed
+      if (do_probe_move(-10, Z_PROBE_SPEED_FAST)) return NAN;
 
-    #if ENABLED(DEBUG_LEVELING_FEATURE)
-      float first_probe_z = current_position[Z_AXIS];
-      if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPAIR("1st Probe Z:", first_probe_z);
-    #endif
+      #if ENABLED(DEBUG_LEVELING_FEATURE)
+        first_probe_z = probe_trigger_z;
+        if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPAIR("1st Probe Z:", first_probe_z);
+      #endif
 
-    // move up to make clearance for the probe
-    do_blocking_move_to_z(current_position[Z_AXIS] + Z_CLEARANCE_BETWEEN_PROBES, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+      // move up to make clearance for the probe
+      do_blocking_move_to_z(current_position[Z_AXIS] + Z_CLEARANCE_BETWEEN_PROBES, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    }
 
   #else
 
@@ -541,7 +671,7 @@ static float run_z_probe() {
     float z = Z_CLEARANCE_DEPLOY_PROBE;
     if (zprobe_zoffset < 0) z -= zprobe_zoffset;
 
-    if (z < current_position[Z_AXIS]) {
+    if (!approached && z < current_position[Z_AXIS]) {
 
       // If we don't make it to the z position (i.e. the probe triggered), move up to make clearance for the probe
       if (!do_probe_move(z, Z_PROBE_SPEED_FAST))
@@ -549,8 +679,18 @@ static float run_z_probe() {
     }
   #endif
 
-  // Move down slowly to find bed, not too far
-  if (do_probe_move(-10, Z_PROBE_SPEED_SLOW)) return NAN;
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+
+    // Move down slowly to find bed, as many times as needed
+    const float sampled_z = sample_z_probe();
+    if (isnan(sampled_z)) return NAN;
+
+  #else
+
+    // Move down slowly to find bed, not too far
+    if (do_probe_move(-10, Z_PROBE_SPEED_SLOW)) return NAN;
+
+  #endif
 
   #if ENABLED(DEBUG_LEVELING_FEATURE)
     if (DEBUGGING(LEVELING)) DEBUG_POS("<<< run_z_probe", current_position);
@@ -559,12 +699,16 @@ static float run_z_probe() {
   // Debug: compare probe heights
   #if ENABLED(PROBE_DOUBLE_TOUCH) && ENABLED(DEBUG_LEVELING_FEATURE)
     if (DEBUGGING(LEVELING)) {
-      SERIAL_ECHOPAIR("2nd Probe Z:", current_position[Z_AXIS]);
-      SERIAL_ECHOLNPAIR(" Discrepancy:", first_probe_z - current_position[Z_AXIS]);
+      SERIAL_ECHOPAIR("2nd Probe Z:", probe_trigger_z);
+      SERIAL_ECHOLNPAIR(" Discrepancy:", first_probe_z - probe_trigger_z);
     }
   #endif
 
-  return current_position[Z_AXIS];
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+    return sampled_z;
+  #else
+    return probe_trigger_z;
+  #endif
 }
 
 /**
@@ -575,8 +719,11 @@ static float run_z_probe() {
  *   - Stow the probe, or
  *   - Raise to the BETWEEN height
  * - Return the probed Z position
+ *
+ * With PROBE_ON_THE_FLY a 'predicted_z' (from a neighboring point) lets
+ * the probe rise while traveling to the point and skip its fast approach.
  */
-float probe_pt(const float &rx, const float &ry, const bool stow, const uint8_t verbose_level, const bool probe_relative/*=true*/) {
+float probe_pt(const float &rx, const float &ry, const bool stow, const uint8_t verbose_level, const bool probe_relative/*=true*/, const float &predicted_z/*=NAN*/) {
   #if ENABLED(DEBUG_LEVELING_FEATURE)
     if (DEBUGGING(LEVELING)) {
       SERIAL_ECHOPAIR(">>> probe_pt(", LOGICAL_X_POSITION(rx));
@@ -596,6 +743,34 @@ float probe_pt(const float &rx, const float &ry, const bool stow, const uint8_t
   }
   else if (!position_is_reachable(nx, ny)) return NAN;        // The given position is in terms of the nozzle
 
+  const float old_feedrate_mm_s = feedrate_mm_s;
+  feedrate_mm_s = XY_PROBE_FEEDRATE_MM_S;
+
+  #if ENABLED(PROBE_ON_THE_FLY)
+    const bool on_the_fly = !isnan(predicted_z);
+    if (probe_near_bed) {
+      probe_near_bed = false;
+      const float travel_z = current_position[Z_AXIS] + Z_CLEARANCE_BETWEEN_PROBES - (PROBE_PREDICT_MARGIN);
+      if (on_the_fly) {
+        // Finish the raise along the way to the next point, in a single move
+        set_destination_from_current();
+        destination[X_AXIS] = nx;
+        destination[Y_AXIS] = ny;
+        destination[Z_AXIS] =
+          #if ENABLED(DELTA)
+            min(travel_z, delta_clip_start_height)
+          #else
+            travel_z
+          #endif
+        ;
+        prepare_move_to_destination();
+        stepper.synchronize();
+      }
+      else
+        do_blocking_move_to_z(travel_z, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    }
+  #endif
+
   const float nz =
     #if ENABLED(DELTA)
       // Move below clip height or xy move will be aborted by do_blocking_move_to
@@ -605,18 +780,28 @@ float probe_pt(const float &rx, const float &ry, const bool stow, const uint8_t
     #endif
   ;
 
-  const float old_feedrate_mm_s = feedrate_mm_s;
-  feedrate_mm_s = XY_PROBE_FEEDRATE_MM_S;
-
   // Move the probe to the starting XYZ
   do_blocking_move_to(nx, ny, nz);
 
   float measured_z = NAN;
   if (!DEPLOY_PROBE()) {
-    measured_z = run_z_probe() + zprobe_zoffset;
-
-    if (!stow)
+    measured_z = run_z_probe(
+      #if ENABLED(PROBE_ON_THE_FLY)
+        predicted_z - zprobe_zoffset
+      #endif
+    ) + zprobe_zoffset;
+
+    if (!stow) {
+      #if ENABLED(PROBE_ON_THE_FLY)
+        // Just clear the bed, leaving the rest of the raise for the next travel
+        if (on_the_fly) {
+          do_blocking_move_to_z(current_position[Z_AXIS] + (PROBE_PREDICT_MARGIN), MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+          probe_near_bed = true;
+        }
+        else
+      #endif
       do_blocking_move_to_z(current_position[Z_AXIS] + Z_CLEARANCE_BETWEEN_PROBES, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    }
     else
       if (STOW_PROBE()) measured_z = NAN;
   }
@@ -628,6 +813,10 @@ float probe_pt(const float &rx, const float &ry, const bool stow, const uint8_t
     SERIAL_PROTOCOL_F(LOGICAL_Y_POSITION(ry), 3);
     SERIAL_PROTOCOLPGM(" Z: ");
     SERIAL_PROTOCOL_F(measured_z, 3);
+    #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+      SERIAL_PROTOCOLPGM(" +/- ");
+      SERIAL_PROTOCOL_F(probe_std_error, 4);
+    #endif
     SERIAL_EOL();
   }
 
@@ -646,6 +835,43 @@ float probe_pt(const float &rx, const float &ry, const bool stow, const uint8_t
   return measured_z;
 }
 
+#if ENABLED(PROBE_ON_THE_FLY)
+
+  /**
+   * Finish the raise that the last on-the-fly probe_pt left for the
+   * next travel move. Call when a probing sequence ends, so the probe
+   * isn't left just above the bed and a later probe_pt doesn't pick up
+   * the stale state.
+   */
+  void finish_probe_raise() {
+    if (!probe_near_bed) return;
+    probe_near_bed = false;
+    do_blocking_move_to_z(current_position[Z_AXIS] + Z_CLEARANCE_BETWEEN_PROBES - (PROBE_PREDICT_MARGIN), MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+  }
+
+  /**
+   * Report how long a mesh took to probe and roughly how much of that
+   * was saved by skipping the fast approach at well-predicted points.
+   */
+  void report_probing_time(const millis_t start_ms) {
+    constexpr float approach = Z_CLEARANCE_BETWEEN_PROBES - (PROBE_PREDICT_MARGIN),
+                    saved_s =
+                      #if ENABLED(PROBE_DOUBLE_TOUCH)
+                        // The fast touch and retract, and the longer slow descent
+                        2 * (Z_CLEARANCE_BETWEEN_PROBES) / MMM_TO_MMS(Z_PROBE_SPEED_FAST) + approach / MMM_TO_MMS(Z_PROBE_SPEED_SLOW)
+                      #else
+                        // The slow descent, now done at the fast speed
+                        approach / MMM_TO_MMS(Z_PROBE_SPEED_SLOW) - approach / MMM_TO_MMS(Z_PROBE_SPEED_FAST)
+                      #endif
+                    ;
+    SERIAL_ECHOPAIR("Probing time: ", (millis() - start_ms) / 1000UL);
+    SERIAL_ECHOPAIR("s. Fast approaches skipped: ", probe_touches_saved);
+    SERIAL_ECHOPAIR(" (~", int(probe_touches_saved * saved_s));
+    SERIAL_ECHOLNPGM("s saved)");
+  }
+
+#endif
+
 #if HAS_Z_SERVO_ENDSTOP
 
   void servo_probe_init() {
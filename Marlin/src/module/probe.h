@@ -32,7 +32,16 @@
 #if HAS_BED_PROBE
   extern float zprobe_zoffset;
   bool set_probe_deployed(const bool deploy);
-  float probe_pt(const float &rx, const float &ry, const bool, const uint8_t, const bool probe_relative=true);
+  float probe_pt(const float &rx, const float &ry, const bool, const uint8_t, const bool probe_relative=true, const float &predicted_z=NAN);
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+    extern float probe_std_error;
+    void reset_probe_statistics();
+  #endif
+  #if ENABLED(PROBE_ON_THE_FLY)
+    extern uint16_t probe_touches_saved;
+    void finish_probe_raise();
+    void report_probing_time(const millis_t start_ms);
+  #endif
   #define DEPLOY_PROBE() set_probe_deployed(true)
   #define STOW_PROBE() set_probe_deployed(false)
 #else
@@ -34,6 +34,62 @@
 
 float delta_segments_per_second = SCARA_SEGMENTS_PER_SECOND;
 
+#if ENABLED(SCARA_FAST_TRIG)
+
+  /**
+   * atan() from 0 to 1 in steps of 1/SCARA_ATAN_TABLE_SIZE.
+   * Linear interpolation between entries is within 6e-6 radians
+   * (0.0003 degrees) of the exact value.
+   */
+  #define SCARA_ATAN_TABLE_SIZE 128
+
+  static const float scara_atan_table[SCARA_ATAN_TABLE_SIZE + 1] PROGMEM = {
+    0.0000000, 0.0078123, 0.0156237, 0.0234332, 0.0312398, 0.0390426, 0.0468407, 0.0546331,
+    0.0624188, 0.0701970, 0.0779666, 0.0857269, 0.0934768, 0.1012154, 0.1089420, 0.1166554,
+    0.1243550, 0.1320398, 0.1397089, 0.1473615, 0.1549967, 0.1626138, 0.1702119, 0.1777902,
+    0.1853479, 0.1928843, 0.2003986, 0.2078899, 0.2153577, 0.2228012, 0.2302196, 0.2376123,
+    0.2449787, 0.2523180, 0.2596296, 0.2669130, 0.2741675, 0.2813924, 0.2885874, 0.2957517,
+    0.3028849, 0.3099864, 0.3170558, 0.3240925, 0.3310961, 0.3380661, 0.3450022, 0.3519038,
+    0.3587707, 0.3656023, 0.3723984, 0.3791587, 0.3858827, 0.3925701, 0.3992208, 0.4058343,
+    0.4124104, 0.4189490, 0.4254496, 0.4319122, 0.4383366, 0.4447224, 0.4510697, 0.4573781,
+    0.4636476, 0.4698781, 0.4760693, 0.4822213, 0.4883340, 0.4944071, 0.5004408, 0.5064349,
+    0.5123895, 0.5183044, 0.5241796, 0.5300153, 0.5358112, 0.5415676, 0.5472844, 0.5529616,
+    0.5585993, 0.5641976, 0.5697565, 0.5752760, 0.5807564, 0.5861976, 0.5915997, 0.5969629,
+    0.6022873, 0.6075731, 0.6128202, 0.6180289, 0.6231993, 0.6283316, 0.6334259, 0.6384823,
+    0.6435011, 0.6484824, 0.6534263, 0.6583331, 0.6632030, 0.6680361, 0.6728325, 0.6775926,
+    0.6823166, 0.6870045, 0.6916566, 0.6962732, 0.7008544, 0.7054005, 0.7099116, 0.7143881,
+    0.7188300, 0.7232377, 0.7276113, 0.7319512, 0.7362574, 0.7405303, 0.7447701, 0.7489770,
+    0.7531513, 0.7572931, 0.7614028, 0.7654805, 0.7695265, 0.7735410, 0.7775243, 0.7814766,
+    0.7853982
+  };
+
+  /**
+   * Table-driven atan2. Fold the angle into the first octant, look
+   * it up there, then unfold it. One division replaces the series
+   * that libm evaluates in soft-float.
+   */
+  static float scara_atan2(const float &y, const float &x) {
+    const float ax = FABS(x), ay = FABS(y);
+    if (ay == 0 && ax == 0) return 0;
+    const bool steep = ay > ax;
+    const float f = (steep ? ax / ay : ay / ax) * (SCARA_ATAN_TABLE_SIZE);
+    const uint8_t i = f < SCARA_ATAN_TABLE_SIZE ? uint8_t(f) : SCARA_ATAN_TABLE_SIZE - 1;
+    const float a0 = pgm_read_float(&scara_atan_table[i]),
+                a1 = pgm_read_float(&scara_atan_table[i + 1]);
+    float a = a0 + (a1 - a0) * (f - i);
+    if (steep) a = M_PI_2 - a;
+    if (x < 0) a = M_PI - a;
+    return y < 0 ? -a : a;
+  }
+
+  #define SCARA_ATAN2(Y,X) scara_atan2(Y,X)
+
+#else
+
+  #define SCARA_ATAN2(Y,X) ATAN2(Y,X)
+
+#endif
+
 void scara_set_axis_is_at_home(const AxisEnum axis) {
   if (axis == Z_AXIS)
     current_position[Z_AXIS] = Z_HOME_POS;
@@ -97,24 +153,26 @@ void forward_kinematics_SCARA(const float &a, const float &b) {
 }
 
 /**
- * Morgan SCARA Inverse Kinematics. Results in delta[].
+ * Morgan SCARA Inverse Kinematics. Arm angles for the point sx,sy
+ * relative to the SCARA center, where r2 = sx^2 + sy^2. Results in angle[].
  *
  * See http://forums.reprap.org/read.php?185,283327
  *
  * Maths and first version by QHARLEY.
  * Integrated into Marlin and slightly restructured by Joachim Cerny.
  */
-void inverse_kinematics(const float raw[XYZ]) {
+static void scara_arm_angles(const float &sx, const float &sy, const float &r2, float angle[ABC]) {
 
-  static float C2, S2, SK1, SK2, THETA, PSI;
-
-  float sx = raw[X_AXIS] - SCARA_OFFSET_X,  // Translate SCARA to standard X Y
-        sy = raw[Y_AXIS] - SCARA_OFFSET_Y;  // With scaling factor.
+  float C2, S2, SK1, SK2, THETA, PSI;
 
   if (L1 == L2)
-    C2 = HYPOT2(sx, sy) / L1_2_2 - 1;
+    C2 = r2 / L1_2_2 - 1;
   else
-    C2 = (HYPOT2(sx, sy) - (L1_2 + L2_2)) / (2.0 * L1 * L2);
+    C2 = (r2 - (L1_2 + L2_2)) / (2.0 * L1 * L2);
+
+  #if ENABLED(SCARA_FAST_TRIG)
+    C2 = constrain(C2, -1, 1); // Keep the table lookup in range at the edge of reach
+  #endif
 
   S2 = SQRT(1 - sq(C2));
 
@@ -125,18 +183,15 @@ void inverse_kinematics(const float raw[XYZ]) {
   SK2 = L2 * S2;
 
   // Angle of Arm1 is the difference between Center-to-End angle and the Center-to-Elbow
-  THETA = ATAN2(SK1, SK2) - ATAN2(sx, sy);
+  THETA = SCARA_ATAN2(SK1, SK2) - SCARA_ATAN2(sx, sy);
 
   // Angle of Arm2
-  PSI = ATAN2(S2, C2);
+  PSI = SCARA_ATAN2(S2, C2);
 
-  delta[A_AXIS] = DEGREES(THETA);        // theta is support arm angle
-  delta[B_AXIS] = DEGREES(THETA + PSI);  // equal to sub arm angle (inverted motor)
-  delta[C_AXIS] = raw[Z_AXIS];
+  angle[A_AXIS] = DEGREES(THETA);        // theta is support arm angle
+  angle[B_AXIS] = DEGREES(THETA + PSI);  // equal to sub arm angle (inverted motor)
 
   /*
-    DEBUG_POS("SCARA IK", raw);
-    DEBUG_POS("SCARA IK", delta);
     SERIAL_ECHOPAIR("  SCARA (x,y) ", sx);
     SERIAL_ECHOPAIR(",", sy);
     SERIAL_ECHOPAIR(" C2=", C2);
@@ -146,6 +201,50 @@ void inverse_kinematics(const float raw[XYZ]) {
   //*/
 }
 
+void inverse_kinematics(const float raw[XYZ]) {
+
+  const float sx = raw[X_AXIS] - SCARA_OFFSET_X,  // Translate SCARA to standard X Y
+              sy = raw[Y_AXIS] - SCARA_OFFSET_Y;  // With scaling factor.
+
+  scara_arm_angles(sx, sy, HYPOT2(sx, sy), delta);
+  delta[C_AXIS] = raw[Z_AXIS];
+
+  /*
+    DEBUG_POS("SCARA IK", raw);
+    DEBUG_POS("SCARA IK", delta);
+  //*/
+}
+
+#if ENABLED(SCARA_FAST_TRIG)
+
+  /**
+   * SCARA Inverse Kinematics for a run of points
+   *
+   * Store the arm angles for the 'count' points that follow 'raw'
+   * at intervals of 'step' in the out[] array. Along a straight line
+   * the squared distance from the center is a quadratic, so it is
+   * advanced by finite differences as for Delta.
+   */
+  void inverse_kinematics_batch(const float raw[XYZ], const float step[XYZ], const uint8_t count, float out[][ABC]) {
+    const float step_2 = HYPOT2(step[X_AXIS], step[Y_AXIS]);
+    float sx = raw[X_AXIS] - SCARA_OFFSET_X,
+          sy = raw[Y_AXIS] - SCARA_OFFSET_Y,
+          z = raw[Z_AXIS],
+          r2 = HYPOT2(sx, sy),
+          difference = 2 * (sx * step[X_AXIS] + sy * step[Y_AXIS]) + step_2;
+    for (uint8_t i = 0; i < count; i++) {
+      sx += step[X_AXIS];
+      sy += step[Y_AXIS];
+      z += step[Z_AXIS];
+      r2 += difference;
+      difference += 2 * step_2;
+      scara_arm_angles(sx, sy, r2, out[i]);
+      out[i][C_AXIS] = z;
+    }
+  }
+
+#endif
+
 void scara_report_positions() {
   SERIAL_PROTOCOLPAIR("SCARA Theta:", stepper.get_axis_position_degrees(A_AXIS));
   SERIAL_PROTOCOLLNPAIR("   Psi+Theta:", stepper.get_axis_position_degrees(B_AXIS));
@@ -39,6 +39,13 @@ float constexpr L1 = SCARA_LINKAGE_1, L2 = SCARA_LINKAGE_2,
 void scara_set_axis_is_at_home(const AxisEnum axis);
 
 void inverse_kinematics(const float raw[XYZ]);
+
+#if ENABLED(SCARA_FAST_TRIG)
+  // The most points to solve in one inverse_kinematics_batch call
+  #define SCARA_IK_BATCH 8
+
+  void inverse_kinematics_batch(const float raw[XYZ], const float step[XYZ], const uint8_t count, float out[][ABC]);
+#endif
 void forward_kinematics_SCARA(const float &a, const float &b);
 
 void scara_report_positions();
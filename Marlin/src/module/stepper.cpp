@@ -73,6 +73,14 @@
   #include <SPI.h>
 #endif
 
+#if ENABLED(STEP_TRACE)
+  #include "../feature/step_trace.h"
+#endif
+
+#if ENABLED(CPU_PROFILER)
+  #include "../feature/profiler.h"
+#endif
+
 Stepper stepper; // Singleton
 
 // public:
@@ -163,6 +171,11 @@ hal_timer_t Stepper::OCR1A_nominal;
 
 volatile long Stepper::endstops_trigsteps[XYZ];
 
+#if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+  volatile long Stepper::endstop_latch[XYZ];
+  volatile bool Stepper::endstop_latched = false;
+#endif
+
 #if ENABLED(X_DUAL_ENDSTOPS) || ENABLED(Y_DUAL_ENDSTOPS) || ENABLED(Z_DUAL_ENDSTOPS)
   #define LOCKED_X_MOTOR  locked_x_motor
   #define LOCKED_Y_MOTOR  locked_y_motor
@@ -332,6 +345,14 @@ void Stepper::set_directions() {
 
 HAL_STEP_TIMER_ISR {
   HAL_timer_isr_prologue(STEP_TIMER_NUM);
+  #if ENABLED(STEP_TRACE)
+    // The timer restarts at each compare match, so the compare value is the period just ended
+    #ifdef CPU_32_BIT
+      step_trace.period(HAL_timer_get_count(STEP_TIMER_NUM));
+    #else
+      step_trace.period(OCR1A);
+    #endif
+  #endif
   #if ENABLED(LIN_ADVANCE)
     Stepper::advance_isr_scheduler();
   #else
@@ -341,6 +362,10 @@ HAL_STEP_TIMER_ISR {
 
 void Stepper::isr() {
 
+  #if ENABLED(CPU_PROFILER)
+    ProfileScope profile(PROFILE_STEPPER_ISR);
+  #endif
+
   hal_timer_t ocr_val;
 
   #define ENDSTOP_NOMINAL_OCR_VAL 1500 * HAL_TICKS_PER_US    // check endstops every 1.5ms to guarantee two stepper ISRs within 5ms for BLTouch
@@ -368,8 +393,14 @@ void Stepper::isr() {
   }while(0)
 
   if (step_remaining) {
-    if (ENDSTOPS_ENABLED)
-      endstops.update();
+    #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+      if (e_hit && ENDSTOPS_ENABLED) {
+        endstops.update();
+        if (!--e_hit) clear_endstop_latch();
+      }
+    #else
+      if (ENDSTOPS_ENABLED) endstops.update();
+    #endif
     if (step_remaining > ENDSTOP_NOMINAL_OCR_VAL) {
       step_remaining -= ENDSTOP_NOMINAL_OCR_VAL;
       ocr_val = ENDSTOP_NOMINAL_OCR_VAL;
@@ -413,18 +444,23 @@ void Stepper::isr() {
       trapezoid_generator_reset();
 
       // Initialize Bresenham counters to 1/2 the ceiling
-      counter_X = counter_Y = counter_Z = counter_E = -(current_block->step_event_count >> 1);
+      counter_X = counter_Y = counter_Z = counter_E = -((int32_t)current_block->step_event_count >> 1);
 
       #if ENABLED(MIXING_EXTRUDER)
         MIXING_STEPPERS_LOOP(i)
-          counter_m[i] = -(current_block->mix_event_count[i] >> 1);
+          counter_m[i] = -((int32_t)current_block->mix_event_count[i] >> 1);
       #endif
 
       step_events_completed = 0;
 
+      #if ENABLED(STEP_TRACE)
+        step_trace.block(current_block);
+      #endif
+
       #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
         e_hit = 2; // Needed for the case an endstop is already triggered before the new move begins.
                    // No 'change' can be detected.
+        clear_endstop_latch();
       #endif
 
       #if ENABLED(Z_LATE_ENABLE)
@@ -447,7 +483,7 @@ void Stepper::isr() {
   #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
     if (e_hit && ENDSTOPS_ENABLED) {
       endstops.update();
-      e_hit--;
+      if (!--e_hit) clear_endstop_latch();
     }
   #else
     if (ENDSTOPS_ENABLED) endstops.update();
@@ -486,16 +522,19 @@ void Stepper::isr() {
     #define _APPLY_STEP(AXIS) AXIS ##_APPLY_STEP
     #define _INVERT_STEP_PIN(AXIS) INVERT_## AXIS ##_STEP_PIN
 
-    // Advance the Bresenham counter; start a pulse if the axis needs a step
+    // Advance the Bresenham counter; count the step and start a pulse if the axis needs one.
+    // The count goes first so an endstop interrupt at the pulse edge latches the new position.
     #define PULSE_START(AXIS) \
       _COUNTER(AXIS) += current_block->steps[_AXIS(AXIS)]; \
-      if (_COUNTER(AXIS) > 0) { _APPLY_STEP(AXIS)(!_INVERT_STEP_PIN(AXIS),0); }
+      if (_COUNTER(AXIS) > 0) { \
+        count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+        _APPLY_STEP(AXIS)(!_INVERT_STEP_PIN(AXIS),0); \
+      }
 
-    // Stop an active pulse, reset the Bresenham counter, update the position
+    // Stop an active pulse and reset the Bresenham counter
     #define PULSE_STOP(AXIS) \
       if (_COUNTER(AXIS) > 0) { \
         _COUNTER(AXIS) -= current_block->step_event_count; \
-        count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
         _APPLY_STEP(AXIS)(_INVERT_STEP_PIN(AXIS),0); \
       }
 
@@ -593,6 +632,26 @@ void Stepper::isr() {
       #endif
     #endif // !LIN_ADVANCE
 
+    #if ENABLED(STEP_TRACE)
+      {
+        // Pulses are up on every axis whose counter went over zero
+        const uint8_t trace_steps = (counter_X > 0 ? _BV(X_AXIS) : 0) | (counter_Y > 0 ? _BV(Y_AXIS) : 0) | (counter_Z > 0 ? _BV(Z_AXIS) : 0)
+          #if DISABLED(LIN_ADVANCE)
+            | (counter_E > 0 ? _BV(E_AXIS) : 0)
+          #endif
+        ;
+        // Skip cycles that stepped nothing, like E-only blocks with LIN_ADVANCE
+        if (trace_steps) step_trace.step(
+          #ifdef CPU_32_BIT
+            HAL_timer_get_current_count(STEP_TIMER_NUM)
+          #else
+            TCNT1
+          #endif
+          , trace_steps, last_direction_bits
+        );
+      }
+    #endif
+
     // For minimum pulse time wait before stopping pulses
     #if EXTRA_CYCLES_XYZE > 20
       while (EXTRA_CYCLES_XYZE > (uint32_t)(HAL_timer_get_current_count(STEP_TIMER_NUM) - pulse_start) * (STEPPER_TIMER_PRESCALE)) { /* nada */ }
@@ -779,6 +838,9 @@ void Stepper::isr() {
   // Timer interrupt for E. e_steps is set in the main routine;
 
   void Stepper::advance_isr() {
+    #if ENABLED(CPU_PROFILER)
+      ProfileScope profile(PROFILE_ADVANCE_ISR);
+    #endif
     nextAdvanceISR = eISR_Rate;
 
     #if ENABLED(MK2_MULTIPLEXER)
@@ -820,6 +882,21 @@ void Stepper::isr() {
         uint32_t pulse_start = TCNT0;
       #endif
 
+      #if ENABLED(STEP_TRACE)
+        // One event for the E pulses of this loop
+        for (uint8_t e = 0; e < E_STEPPERS; e++) if (e_steps[e]) {
+          step_trace.step(
+            #ifdef CPU_32_BIT
+              HAL_timer_get_current_count(STEP_TIMER_NUM)
+            #else
+              TCNT1
+            #endif
+            , _BV(E_AXIS) | _BV(STEP_TRACE_ADVANCE), e_steps[e] < 0 ? _BV(E_AXIS) : 0
+          );
+          break;
+        }
+      #endif
+
       START_E_PULSE(0);
       #if E_STEPPERS > 1
         START_E_PULSE(1);
@@ -1239,16 +1316,34 @@ void Stepper::quick_stop() {
 
 void Stepper::endstop_triggered(AxisEnum axis) {
 
+  #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    /**
+     * Prefer the positions latched by the pin interrupt, since the ISR only
+     * gets here one or two interrupts (up to 2 * step_loops steps) later.
+     * On AVR the pin interrupt can land in the middle of a multi-byte
+     * count_position update, so a latch that drifted more than a handful
+     * of steps from the live count is treated as torn and ignored.
+     */
+    const volatile long *pos = count_position;
+    if (endstop_latched) {
+      pos = endstop_latch;
+      LOOP_XYZ(i) if (labs(count_position[i] - endstop_latch[i]) > 32) { pos = count_position; break; }
+    }
+    clear_endstop_latch();
+  #else
+    const volatile long * const pos = count_position;
+  #endif
+
   #if IS_CORE
 
     endstops_trigsteps[axis] = 0.5f * (
-      axis == CORE_AXIS_2 ? CORESIGN(count_position[CORE_AXIS_1] - count_position[CORE_AXIS_2])
-                          : count_position[CORE_AXIS_1] + count_position[CORE_AXIS_2]
+      axis == CORE_AXIS_2 ? CORESIGN(pos[CORE_AXIS_1] - pos[CORE_AXIS_2])
+                          : pos[CORE_AXIS_1] + pos[CORE_AXIS_2]
     );
 
   #else // !COREXY && !COREXZ && !COREYZ
 
-    endstops_trigsteps[axis] = count_position[axis];
+    endstops_trigsteps[axis] = pos[axis];
 
   #endif // !COREXY && !COREXZ && !COREYZ
 
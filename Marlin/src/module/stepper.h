@@ -119,6 +119,11 @@ class Stepper {
     static volatile long endstops_trigsteps[XYZ];
     static volatile long endstops_stepsTotal, endstops_stepsDone;
 
+    #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+      static volatile long endstop_latch[XYZ];  // Motor positions at the first endstop edge
+      static volatile bool endstop_latched;     // ...since the last endstops.update() window
+    #endif
+
     //
     // Positions of stepper motors, in step units
     //
@@ -264,6 +269,22 @@ class Stepper {
     //
     static void endstop_triggered(AxisEnum axis);
 
+    #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+
+      //
+      // Called by the endstop pin interrupt to record the motor
+      // positions at the moment of the edge. Bounces keep the first.
+      //
+      static FORCE_INLINE void latch_endstop_position() {
+        if (endstop_latched) return;
+        LOOP_XYZ(i) endstop_latch[i] = count_position[i];
+        endstop_latched = true;
+      }
+
+      static FORCE_INLINE void clear_endstop_latch() { endstop_latched = false; }
+
+    #endif
+
     //
     // Triggered position of an axis in mm (not core-savvy)
     //
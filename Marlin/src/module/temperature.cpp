@@ -35,7 +35,7 @@
   #include "../libs/private_spi.h"
 #endif
 
-#if ENABLED(BABYSTEPPING)
+#if ENABLED(BABYSTEPPING) || ENABLED(MPC_HOTEND) || ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
   #include "stepper.h"
 #endif
 
@@ -49,6 +49,14 @@
   #include "../feature/filwidth.h"
 #endif
 
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+  #include "../HAL/adc_scan.h"
+#endif
+
+#if ENABLED(CPU_PROFILER)
+  #include "../feature/profiler.h"
+#endif
+
 #ifdef K1 // Defined in Configuration.h in the PID settings
   #define K2 (1.0-K1)
 #endif
@@ -90,6 +98,11 @@ int16_t Temperature::current_temperature_raw[HOTENDS] = { 0 },
   #endif
 #endif
 
+// Initialized by settings.load()
+#if ENABLED(MPC_HOTEND)
+  Temperature::mpc_t Temperature::mpc[HOTENDS];
+#endif
+
 // Initialized by settings.load()
 #if ENABLED(PIDTEMPBED)
   float Temperature::bedKp, Temperature::bedKi, Temperature::bedKd;
@@ -141,6 +154,18 @@ volatile bool Temperature::temp_meas_ready = false;
   bool Temperature::pid_reset[HOTENDS];
 #endif
 
+#if HAS_PID_HEATING
+  Temperature::pid_autotune_t Temperature::autotune[PID_AUTOTUNE_SLOTS];
+#endif
+
+#if ENABLED(MPC_HOTEND)
+  float Temperature::mpc_block_temp[HOTENDS],
+        Temperature::mpc_sensor_temp[HOTENDS],
+        Temperature::mpc_last_power[HOTENDS] = { 0 };
+  bool Temperature::mpc_model_ready[HOTENDS] = { false };
+  long Temperature::mpc_last_e_position[HOTENDS] = { 0 };
+#endif
+
 #if ENABLED(PIDTEMPBED)
   float Temperature::temp_iState_bed = { 0 },
         Temperature::temp_dState_bed = { 0 },
@@ -152,6 +177,18 @@ volatile bool Temperature::temp_meas_ready = false;
   millis_t Temperature::next_bed_check_ms;
 #endif
 
+#if ENABLED(HARDWARE_PWM_HEATERS)
+  uint16_t Temperature::hw_pwm_bound = 0;
+  uint8_t Temperature::hw_pwm_value[HW_PWM_OUTPUTS] = { 0 };
+#endif
+
+#if ENABLED(HEATER_POWER_BUDGET)
+  uint8_t Temperature::heater_power_grant = 0;
+  #define POWER_GRANTED(N, A) (TEST(heater_power_grant, N) ? (A) : 0)
+#else
+  #define POWER_GRANTED(N, A) (A)
+#endif
+
 uint16_t Temperature::raw_temp_value[MAX_EXTRUDERS] = { 0 },
          Temperature::raw_temp_bed_value = 0;
 
@@ -217,72 +254,67 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
 
 #if HAS_PID_HEATING
 
-  /**
-   * PID Autotuning (M303)
-   *
-   * Alternately heat and cool the nozzle, observing its behavior to
-   * determine the best PID values to achieve a stable temperature.
-   */
-  void Temperature::PID_autotune(const float temp, const int8_t hotend, const int8_t ncycles, const bool set_result/*=false*/) {
-    float input = 0.0;
-    int cycles = 0;
-    bool heating = true;
-
-    millis_t next_temp_ms = millis(), t1 = next_temp_ms, t2 = next_temp_ms;
-    long t_high = 0, t_low = 0;
-
-    long bias, d;
-    float Ku, Tu,
-          workKp = 0, workKi = 0, workKd = 0,
-          max = 0, min = 10000;
+  #if ENABLED(PIDTEMP)
+    #define _TOP_HOTEND HOTENDS - 1
+  #else
+    #define _TOP_HOTEND -1
+  #endif
+  #if ENABLED(PIDTEMPBED)
+    #define _BOT_HOTEND -1
+  #else
+    #define _BOT_HOTEND 0
+  #endif
 
-    #if WATCH_THE_BED || WATCH_HOTENDS
-      const float watch_temp_target = temp -
-        #if ENABLED(THERMAL_PROTECTION_BED) && ENABLED(PIDTEMPBED) && ENABLED(THERMAL_PROTECTION_HOTENDS) && ENABLED(PIDTEMP)
-          (hotend < 0 ? (WATCH_BED_TEMP_INCREASE + TEMP_BED_HYSTERESIS + 1) : (WATCH_TEMP_INCREASE + TEMP_HYSTERESIS + 1))
-        #elif ENABLED(THERMAL_PROTECTION_BED) && ENABLED(PIDTEMPBED)
-          (WATCH_BED_TEMP_INCREASE + TEMP_BED_HYSTERESIS + 1)
-        #else
-          (WATCH_TEMP_INCREASE + TEMP_HYSTERESIS + 1)
-        #endif
-      ;
-      const int8_t watch_temp_period =
-        #if ENABLED(THERMAL_PROTECTION_BED) && ENABLED(PIDTEMPBED) && ENABLED(THERMAL_PROTECTION_HOTENDS) && ENABLED(PIDTEMP)
-          hotend < 0 ? THERMAL_PROTECTION_BED_PERIOD : THERMAL_PROTECTION_PERIOD
-        #elif ENABLED(THERMAL_PROTECTION_BED) && ENABLED(PIDTEMPBED)
-          THERMAL_PROTECTION_BED_PERIOD
-        #else
-          THERMAL_PROTECTION_PERIOD
-        #endif
-      ;
-      const int8_t watch_temp_increase =
-        #if ENABLED(THERMAL_PROTECTION_BED) && ENABLED(PIDTEMPBED) && ENABLED(THERMAL_PROTECTION_HOTENDS) && ENABLED(PIDTEMP)
-          hotend < 0 ? WATCH_BED_TEMP_INCREASE : WATCH_TEMP_INCREASE
-        #elif ENABLED(THERMAL_PROTECTION_BED) && ENABLED(PIDTEMPBED)
-          WATCH_BED_TEMP_INCREASE
-        #else
-          WATCH_TEMP_INCREASE
-        #endif
-      ;
-      millis_t temp_change_ms = next_temp_ms + watch_temp_period * 1000UL;
-      float next_watch_temp = 0.0;
-      bool heated = false;
-    #endif
+  #if HAS_PID_FOR_BOTH
+    #define TUNE_INPUT(H)     ((H) < 0 ? current_temperature_bed : current_temperature[H])
+    #define TUNE_MAX_POWER(H) ((H) < 0 ? MAX_BED_POWER : PID_MAX)
+    #define SET_TUNE_PWM(H,V) do{ if ((H) < 0) soft_pwm_amount_bed = (V); else soft_pwm_amount[H] = (V); }while(0)
+  #elif ENABLED(PIDTEMP)
+    #define TUNE_INPUT(H)     current_temperature[H]
+    #define TUNE_MAX_POWER(H) PID_MAX
+    #define SET_TUNE_PWM(H,V) soft_pwm_amount[H] = (V)
+  #else
+    #define TUNE_INPUT(H)     current_temperature_bed
+    #define TUNE_MAX_POWER(H) MAX_BED_POWER
+    #define SET_TUNE_PWM(H,V) soft_pwm_amount_bed = (V)
+  #endif
 
-    #if HAS_AUTO_FAN
-      next_auto_fan_check_ms = next_temp_ms + 2500UL;
+  #if WATCH_THE_BED || WATCH_HOTENDS
+    // Watch the tuned heater for runaway with its own settings, or the other's
+    #if ENABLED(THERMAL_PROTECTION_BED)
+      #define WATCH_TUNE_BED_MARGIN   (WATCH_BED_TEMP_INCREASE + TEMP_BED_HYSTERESIS + 1)
+      #define WATCH_TUNE_BED_INCREASE WATCH_BED_TEMP_INCREASE
+      #define WATCH_TUNE_BED_PERIOD   THERMAL_PROTECTION_BED_PERIOD
     #endif
-
-    #if ENABLED(PIDTEMP)
-      #define _TOP_HOTEND HOTENDS - 1
+    #if ENABLED(THERMAL_PROTECTION_HOTENDS)
+      #define WATCH_TUNE_MARGIN       (WATCH_TEMP_INCREASE + TEMP_HYSTERESIS + 1)
+      #define WATCH_TUNE_INCREASE     WATCH_TEMP_INCREASE
+      #define WATCH_TUNE_PERIOD       THERMAL_PROTECTION_PERIOD
     #else
-      #define _TOP_HOTEND -1
+      #define WATCH_TUNE_MARGIN       WATCH_TUNE_BED_MARGIN
+      #define WATCH_TUNE_INCREASE     WATCH_TUNE_BED_INCREASE
+      #define WATCH_TUNE_PERIOD       WATCH_TUNE_BED_PERIOD
     #endif
-    #if ENABLED(PIDTEMPBED)
-      #define _BOT_HOTEND -1
-    #else
-      #define _BOT_HOTEND 0
+    #ifndef WATCH_TUNE_BED_MARGIN
+      #define WATCH_TUNE_BED_MARGIN   WATCH_TUNE_MARGIN
+      #define WATCH_TUNE_BED_INCREASE WATCH_TUNE_INCREASE
+      #define WATCH_TUNE_BED_PERIOD   WATCH_TUNE_PERIOD
     #endif
+  #endif
+
+  #define MAX_OVERSHOOT_PID_AUTOTUNE 20
+
+  /**
+   * PID Autotuning (M303)
+   *
+   * Alternately heat and cool the nozzle, observing its behavior to
+   * determine the best PID values to achieve a stable temperature.
+   *
+   * The relay runs from manage_heater() on every new reading, so several
+   * heaters can be tuned at once. With 'wait' this blocks until every
+   * running autotune has finished, as M303 always used to.
+   */
+  void Temperature::PID_autotune(const float temp, const int8_t hotend, const int8_t ncycles, const bool set_result/*=false*/, const bool wait/*=true*/) {
 
     if (!WITHIN(hotend, _BOT_HOTEND, _TOP_HOTEND)) {
       SERIAL_ECHOLN(MSG_PID_BAD_EXTRUDER_NUM);
@@ -291,197 +323,179 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
 
     SERIAL_ECHOLN(MSG_PID_AUTOTUNE_START);
 
-    disable_all_heaters(); // switch off all heaters.
-
+    // Switch off the heater being tuned. Any others keep running.
     #if HAS_PID_FOR_BOTH
-      if (hotend < 0)
-        soft_pwm_amount_bed = bias = d = (MAX_BED_POWER) >> 1;
-      else
-        soft_pwm_amount[hotend] = bias = d = (PID_MAX) >> 1;
+      if (hotend < 0) setTargetBed(0); else setTargetHotend(0, hotend);
     #elif ENABLED(PIDTEMP)
-      soft_pwm_amount[hotend] = bias = d = (PID_MAX) >> 1;
+      setTargetHotend(0, hotend);
     #else
-      soft_pwm_amount_bed = bias = d = (MAX_BED_POWER) >> 1;
+      setTargetBed(0);
     #endif
 
-    wait_for_heatup = true;
-
-    // PID Tuning loop
-    while (wait_for_heatup) {
-
-      const millis_t ms = millis();
-
-      if (temp_meas_ready) { // temp sample ready
-        updateTemperaturesFromRawValues();
-
-        input =
-          #if HAS_PID_FOR_BOTH
-            hotend < 0 ? current_temperature_bed : current_temperature[hotend]
-          #elif ENABLED(PIDTEMP)
-            current_temperature[hotend]
-          #else
-            current_temperature_bed
-          #endif
-        ;
+    pid_autotune_t &at = autotune[PID_AUTOTUNE_SLOT(hotend)];
+    const millis_t ms = millis();
+
+    at.target = temp;
+    at.ncycles = ncycles;
+    at.set_result = set_result;
+    at.cycles = 0;
+    at.heating = true;
+    at.t1 = at.t2 = ms;
+    at.t_high = at.t_low = 0;
+    at.workKp = at.workKi = at.workKd = 0;
+    at.max = 0;
+    at.min = 10000;
+    at.bias = at.d = TUNE_MAX_POWER(hotend) >> 1;
+    #if WATCH_THE_BED || WATCH_HOTENDS
+      at.temp_change_ms = ms + (hotend < 0 ? WATCH_TUNE_BED_PERIOD : WATCH_TUNE_PERIOD) * 1000UL;
+      at.next_watch_temp = 0.0;
+      at.heated = false;
+    #endif
+    SET_TUNE_PWM(hotend, (at.bias + at.d) >> 1);
+    at.active = true;
 
-        NOLESS(max, input);
-        NOMORE(min, input);
+    if (!wait) return;
 
-        #if HAS_AUTO_FAN
-          if (ELAPSED(ms, next_auto_fan_check_ms)) {
-            checkExtruderAutoFans();
-            next_auto_fan_check_ms = ms + 2500UL;
-          }
+    // Wait for this and any other running autotune to finish
+    millis_t next_temp_ms = ms;
+    wait_for_heatup = true;
+    while (wait_for_heatup && PID_autotune_running()) {
+      idle();
+      // Every 2 seconds...
+      if (ELAPSED(millis(), next_temp_ms)) {
+        #if HAS_TEMP_HOTEND || HAS_TEMP_BED
+          print_heaterstates();
+          SERIAL_EOL();
         #endif
+        next_temp_ms = millis() + 2000UL;
+      }
+    }
+    if (!wait_for_heatup) disable_all_heaters(); // Aborted with M108
+  }
 
-        if (heating && input > temp) {
-          if (ELAPSED(ms, t2 + 5000UL)) {
-            heating = false;
-            #if HAS_PID_FOR_BOTH
-              if (hotend < 0)
-                soft_pwm_amount_bed = (bias - d) >> 1;
-              else
-                soft_pwm_amount[hotend] = (bias - d) >> 1;
-            #elif ENABLED(PIDTEMP)
-              soft_pwm_amount[hotend] = (bias - d) >> 1;
-            #elif ENABLED(PIDTEMPBED)
-              soft_pwm_amount_bed = (bias - d) >> 1;
-            #endif
-            t1 = ms;
-            t_high = t1 - t2;
-            max = temp;
-          }
+  bool Temperature::PID_autotune_running() {
+    for (uint8_t i = 0; i < PID_AUTOTUNE_SLOTS; i++) if (autotune[i].active) return true;
+    return false;
+  }
+
+  /**
+   * Advance every running autotune by one temperature reading
+   */
+  void Temperature::PID_autotune_update() {
+    const millis_t ms = millis();
+
+    for (int8_t hotend = _BOT_HOTEND; hotend <= _TOP_HOTEND; hotend++) {
+      pid_autotune_t &at = autotune[PID_AUTOTUNE_SLOT(hotend)];
+      if (!at.active) continue;
+
+      const float input = TUNE_INPUT(hotend);
+      const long max_pow = TUNE_MAX_POWER(hotend);
+
+      NOLESS(at.max, input);
+      NOMORE(at.min, input);
+
+      if (at.heating && input > at.target) {
+        if (ELAPSED(ms, at.t2 + 5000UL)) {
+          at.heating = false;
+          SET_TUNE_PWM(hotend, (at.bias - at.d) >> 1);
+          at.t1 = ms;
+          at.t_high = at.t1 - at.t2;
+          at.max = at.target;
         }
+      }
 
-        if (!heating && input < temp) {
-          if (ELAPSED(ms, t1 + 5000UL)) {
-            heating = true;
-            t2 = ms;
-            t_low = t2 - t1;
-            if (cycles > 0) {
-              long max_pow =
-                #if HAS_PID_FOR_BOTH
-                  hotend < 0 ? MAX_BED_POWER : PID_MAX
-                #elif ENABLED(PIDTEMP)
-                  PID_MAX
-                #else
-                  MAX_BED_POWER
-                #endif
-              ;
-              bias += (d * (t_high - t_low)) / (t_low + t_high);
-              bias = constrain(bias, 20, max_pow - 20);
-              d = (bias > max_pow >> 1) ? max_pow - 1 - bias : bias;
-
-              SERIAL_PROTOCOLPAIR(MSG_BIAS, bias);
-              SERIAL_PROTOCOLPAIR(MSG_D, d);
-              SERIAL_PROTOCOLPAIR(MSG_T_MIN, min);
-              SERIAL_PROTOCOLPAIR(MSG_T_MAX, max);
-              if (cycles > 2) {
-                Ku = (4.0 * d) / (M_PI * (max - min) * 0.5); // i.e., CIRCLE_CIRC((max - min) * 0.25)
-                Tu = ((float)(t_low + t_high) * 0.001);
-                SERIAL_PROTOCOLPAIR(MSG_KU, Ku);
-                SERIAL_PROTOCOLPAIR(MSG_TU, Tu);
-                workKp = 0.6 * Ku;
-                workKi = 2 * workKp / Tu;
-                workKd = workKp * Tu * 0.125;
-                SERIAL_PROTOCOLLNPGM("\n" MSG_CLASSIC_PID);
-                SERIAL_PROTOCOLPAIR(MSG_KP, workKp);
-                SERIAL_PROTOCOLPAIR(MSG_KI, workKi);
-                SERIAL_PROTOCOLLNPAIR(MSG_KD, workKd);
-                /**
-                workKp = 0.33*Ku;
-                workKi = workKp/Tu;
-                workKd = workKp*Tu/3;
-                SERIAL_PROTOCOLLNPGM(" Some overshoot");
-                SERIAL_PROTOCOLPAIR(" Kp: ", workKp);
-                SERIAL_PROTOCOLPAIR(" Ki: ", workKi);
-                SERIAL_PROTOCOLPAIR(" Kd: ", workKd);
-                workKp = 0.2*Ku;
-                workKi = 2*workKp/Tu;
-                workKd = workKp*Tu/3;
-                SERIAL_PROTOCOLLNPGM(" No overshoot");
-                SERIAL_PROTOCOLPAIR(" Kp: ", workKp);
-                SERIAL_PROTOCOLPAIR(" Ki: ", workKi);
-                SERIAL_PROTOCOLPAIR(" Kd: ", workKd);
-                */
-              }
+      if (!at.heating && input < at.target) {
+        if (ELAPSED(ms, at.t1 + 5000UL)) {
+          at.heating = true;
+          at.t2 = ms;
+          at.t_low = at.t2 - at.t1;
+          if (at.cycles > 0) {
+            at.bias += (at.d * (at.t_high - at.t_low)) / (at.t_low + at.t_high);
+            at.bias = constrain(at.bias, 20, max_pow - 20);
+            at.d = (at.bias > max_pow >> 1) ? max_pow - 1 - at.bias : at.bias;
+
+            SERIAL_PROTOCOLPAIR(MSG_BIAS, at.bias);
+            SERIAL_PROTOCOLPAIR(MSG_D, at.d);
+            SERIAL_PROTOCOLPAIR(MSG_T_MIN, at.min);
+            SERIAL_PROTOCOLPAIR(MSG_T_MAX, at.max);
+            if (at.cycles > 2) {
+              const float Ku = (4.0 * at.d) / (M_PI * (at.max - at.min) * 0.5), // i.e., CIRCLE_CIRC((max - min) * 0.25)
+                          Tu = ((float)(at.t_low + at.t_high) * 0.001);
+              SERIAL_PROTOCOLPAIR(MSG_KU, Ku);
+              SERIAL_PROTOCOLPAIR(MSG_TU, Tu);
+              at.workKp = 0.6 * Ku;
+              at.workKi = 2 * at.workKp / Tu;
+              at.workKd = at.workKp * Tu * 0.125;
+              SERIAL_PROTOCOLLNPGM("\n" MSG_CLASSIC_PID);
+              SERIAL_PROTOCOLPAIR(MSG_KP, at.workKp);
+              SERIAL_PROTOCOLPAIR(MSG_KI, at.workKi);
+              SERIAL_PROTOCOLLNPAIR(MSG_KD, at.workKd);
             }
-            #if HAS_PID_FOR_BOTH
-              if (hotend < 0)
-                soft_pwm_amount_bed = (bias + d) >> 1;
-              else
-                soft_pwm_amount[hotend] = (bias + d) >> 1;
-            #elif ENABLED(PIDTEMP)
-              soft_pwm_amount[hotend] = (bias + d) >> 1;
-            #else
-              soft_pwm_amount_bed = (bias + d) >> 1;
-            #endif
-            cycles++;
-            min = temp;
           }
+          SET_TUNE_PWM(hotend, (at.bias + at.d) >> 1);
+          at.cycles++;
+          at.min = at.target;
         }
       }
-      #define MAX_OVERSHOOT_PID_AUTOTUNE 20
-      if (input > temp + MAX_OVERSHOOT_PID_AUTOTUNE) {
+
+      if (input > at.target + MAX_OVERSHOOT_PID_AUTOTUNE) {
         SERIAL_PROTOCOLLNPGM(MSG_PID_TEMP_TOO_HIGH);
-        break;
+        at.active = false;
+        SET_TUNE_PWM(hotend, 0);
+        continue;
       }
-      // Every 2 seconds...
-      if (ELAPSED(ms, next_temp_ms)) {
-        #if HAS_TEMP_HOTEND || HAS_TEMP_BED
-          print_heaterstates();
-          SERIAL_EOL();
-        #endif
 
-        next_temp_ms = ms + 2000UL;
+      #if WATCH_THE_BED || WATCH_HOTENDS
+        if (!at.heated && input > at.next_watch_temp) {
+          const float watch_temp_target = at.target - (hotend < 0 ? WATCH_TUNE_BED_MARGIN : WATCH_TUNE_MARGIN);
+          if (input > watch_temp_target) at.heated = true;
+          at.next_watch_temp = input + (hotend < 0 ? WATCH_TUNE_BED_INCREASE : WATCH_TUNE_INCREASE);
+          at.temp_change_ms = ms + (hotend < 0 ? WATCH_TUNE_BED_PERIOD : WATCH_TUNE_PERIOD) * 1000UL;
+        }
+        else if ((!at.heated && ELAPSED(ms, at.temp_change_ms)) || (at.heated && input < at.target - MAX_OVERSHOOT_PID_AUTOTUNE))
+          _temp_error(hotend, PSTR(MSG_T_THERMAL_RUNAWAY), PSTR(MSG_THERMAL_RUNAWAY));
+      #endif
 
-        #if WATCH_THE_BED || WATCH_HOTENDS
-          if (!heated && input > next_watch_temp) {
-            if (input > watch_temp_target) heated = true;
-            next_watch_temp = input + watch_temp_increase;
-            temp_change_ms = ms + watch_temp_period * 1000UL;
-          }
-          else if ((!heated && ELAPSED(ms, temp_change_ms)) || (heated && input < temp - MAX_OVERSHOOT_PID_AUTOTUNE))
-            _temp_error(hotend, PSTR(MSG_T_THERMAL_RUNAWAY), PSTR(MSG_THERMAL_RUNAWAY));
-        #endif
-      } // every 2 seconds
       // Timeout after 20 minutes since the last undershoot/overshoot cycle
-      if (((ms - t1) + (ms - t2)) > (20L * 60L * 1000L)) {
+      if (((ms - at.t1) + (ms - at.t2)) > (20L * 60L * 1000L)) {
         SERIAL_PROTOCOLLNPGM(MSG_PID_TIMEOUT);
-        break;
+        at.active = false;
+        SET_TUNE_PWM(hotend, 0);
+        continue;
       }
-      if (cycles > ncycles) {
+
+      if (at.cycles > at.ncycles) {
         SERIAL_PROTOCOLLNPGM(MSG_PID_AUTOTUNE_FINISHED);
 
         #if HAS_PID_FOR_BOTH
           const char* estring = hotend < 0 ? "bed" : "";
-          SERIAL_PROTOCOLPAIR("#define  DEFAULT_", estring); SERIAL_PROTOCOLPAIR("Kp ", workKp); SERIAL_EOL();
-          SERIAL_PROTOCOLPAIR("#define  DEFAULT_", estring); SERIAL_PROTOCOLPAIR("Ki ", workKi); SERIAL_EOL();
-          SERIAL_PROTOCOLPAIR("#define  DEFAULT_", estring); SERIAL_PROTOCOLPAIR("Kd ", workKd); SERIAL_EOL();
+          SERIAL_PROTOCOLPAIR("#define  DEFAULT_", estring); SERIAL_PROTOCOLPAIR("Kp ", at.workKp); SERIAL_EOL();
+          SERIAL_PROTOCOLPAIR("#define  DEFAULT_", estring); SERIAL_PROTOCOLPAIR("Ki ", at.workKi); SERIAL_EOL();
+          SERIAL_PROTOCOLPAIR("#define  DEFAULT_", estring); SERIAL_PROTOCOLPAIR("Kd ", at.workKd); SERIAL_EOL();
         #elif ENABLED(PIDTEMP)
-          SERIAL_PROTOCOLPAIR("#define  DEFAULT_Kp ", workKp); SERIAL_EOL();
-          SERIAL_PROTOCOLPAIR("#define  DEFAULT_Ki ", workKi); SERIAL_EOL();
-          SERIAL_PROTOCOLPAIR("#define  DEFAULT_Kd ", workKd); SERIAL_EOL();
+          SERIAL_PROTOCOLPAIR("#define  DEFAULT_Kp ", at.workKp); SERIAL_EOL();
+          SERIAL_PROTOCOLPAIR("#define  DEFAULT_Ki ", at.workKi); SERIAL_EOL();
+          SERIAL_PROTOCOLPAIR("#define  DEFAULT_Kd ", at.workKd); SERIAL_EOL();
         #else
-          SERIAL_PROTOCOLPAIR("#define  DEFAULT_bedKp ", workKp); SERIAL_EOL();
-          SERIAL_PROTOCOLPAIR("#define  DEFAULT_bedKi ", workKi); SERIAL_EOL();
-          SERIAL_PROTOCOLPAIR("#define  DEFAULT_bedKd ", workKd); SERIAL_EOL();
+          SERIAL_PROTOCOLPAIR("#define  DEFAULT_bedKp ", at.workKp); SERIAL_EOL();
+          SERIAL_PROTOCOLPAIR("#define  DEFAULT_bedKi ", at.workKi); SERIAL_EOL();
+          SERIAL_PROTOCOLPAIR("#define  DEFAULT_bedKd ", at.workKd); SERIAL_EOL();
         #endif
 
         #define _SET_BED_PID() do { \
-          bedKp = workKp; \
-          bedKi = scalePID_i(workKi); \
-          bedKd = scalePID_d(workKd); \
+          bedKp = at.workKp; \
+          bedKi = scalePID_i(at.workKi); \
+          bedKd = scalePID_d(at.workKd); \
         }while(0)
 
         #define _SET_EXTRUDER_PID() do { \
-          PID_PARAM(Kp, hotend) = workKp; \
-          PID_PARAM(Ki, hotend) = scalePID_i(workKi); \
-          PID_PARAM(Kd, hotend) = scalePID_d(workKd); \
+          PID_PARAM(Kp, hotend) = at.workKp; \
+          PID_PARAM(Ki, hotend) = scalePID_i(at.workKi); \
+          PID_PARAM(Kd, hotend) = scalePID_d(at.workKd); \
           updatePID(); }while(0)
 
         // Use the result? (As with "M303 U1")
-        if (set_result) {
+        if (at.set_result) {
           #if HAS_PID_FOR_BOTH
             if (hotend < 0)
               _SET_BED_PID();
@@ -493,13 +507,241 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
             _SET_BED_PID();
           #endif
         }
-        return;
+
+        at.active = false;
+        SET_TUNE_PWM(hotend, 0);
       }
-      lcd_update();
     }
-    disable_all_heaters();
   }
 
+  #if ENABLED(MPC_HOTEND)
+
+    #define MPC_TUNE_SAMPLES 16
+    #define MAX_OVERSHOOT_MPC_AUTOTUNE 20
+
+    /**
+     * MPC model identification (M303 on a hotend with MPC_HOTEND)
+     *
+     * Heat the hotend from ambient at full power and fit the heating curve.
+     * Its shape gives the block's time constant and the temperature it is
+     * heading for, which with the known heater power give the ambient loss
+     * and heat capacity. How late the sensor starts to follow gives its
+     * responsiveness. Then hold the target with the new model and refine
+     * the ambient loss from the average power needed to stay there.
+     */
+    void Temperature::MPC_autotune(const float temp, const int8_t hotend, const bool set_result/*=false*/) {
+
+      if (!WITHIN(hotend, 0, HOTENDS - 1)) {
+        SERIAL_ECHOLN(MSG_PID_BAD_EXTRUDER_NUM);
+        return;
+      }
+
+      // Keep clear of MAXTEMP, which would only stop the printer
+      const float temp_limit = maxttemp[hotend] - 15;
+      if (temp > temp_limit) {
+        SERIAL_PROTOCOLLNPGM(MSG_PID_TEMP_TOO_HIGH);
+        return;
+      }
+
+      SERIAL_ECHOLN(MSG_MPC_AUTOTUNE_START);
+
+      disable_all_heaters(); // switch off all heaters.
+
+      enum { MPCCooling, MPCHeating, MPCSettling, MPCMeasuring } phase = MPCCooling;
+
+      const mpc_t saved = mpc[hotend];
+      mpc_t tuned = saved;
+
+      // The heater is driven at the highest duty PID_MAX allows
+      const float full_power = saved.heater_power * ((PID_MAX) >> 1) / 127.0,
+                  sample_start_temp = current_temperature[hotend] + (temp - current_temperature[hotend]) * 0.3;
+
+      float samples[MPC_TUNE_SAMPLES], input = current_temperature[hotend], last_input = input,
+            block_responsiveness = 0, power_sum = 0, temp_sum = 0;
+      uint8_t sample_count = 0;
+      uint16_t measure_count = 0;
+
+      millis_t ms = millis(), next_temp_ms = ms, phase_ms = ms + 10000UL,
+               heat_start_ms = 0, first_sample_ms = 0, next_sample_ms = 0, sample_interval = 1000UL;
+
+      #if WATCH_HOTENDS
+        // Runaway check, as for PID autotune: heating must keep making progress
+        float next_watch_temp = 0;
+        millis_t temp_change_ms = 0;
+      #endif
+
+      SERIAL_ECHOLNPGM(MSG_MPC_COOLING);
+
+      wait_for_heatup = true;
+
+      while (wait_for_heatup) {
+
+        ms = millis();
+
+        if (temp_meas_ready) { // temp sample ready
+          updateTemperaturesFromRawValues();
+          input = current_temperature[hotend];
+
+          #if HAS_AUTO_FAN
+            if (ELAPSED(ms, next_auto_fan_check_ms)) {
+              checkExtruderAutoFans();
+              next_auto_fan_check_ms = ms + 2500UL;
+            }
+          #endif
+
+          switch (phase) {
+
+            case MPCCooling:
+              // Take ambient as wherever the hotend stops falling
+              if (ELAPSED(ms, phase_ms)) {
+                if (input > last_input - 0.5) {
+                  tuned.ambient_temp = input;
+                  soft_pwm_amount[hotend] = (PID_MAX) >> 1;
+                  heat_start_ms = ms;
+                  #if WATCH_HOTENDS
+                    next_watch_temp = input + WATCH_TUNE_INCREASE;
+                    temp_change_ms = ms + WATCH_TUNE_PERIOD * 1000UL;
+                  #endif
+                  phase = MPCHeating;
+                  SERIAL_ECHOLNPGM(MSG_MPC_HEATING);
+                }
+                last_input = input;
+                phase_ms = ms + 10000UL;
+              }
+              break;
+
+            case MPCHeating:
+              #if WATCH_HOTENDS
+                if (input > next_watch_temp) {
+                  next_watch_temp = input + WATCH_TUNE_INCREASE;
+                  temp_change_ms = ms + WATCH_TUNE_PERIOD * 1000UL;
+                }
+                else if (ELAPSED(ms, temp_change_ms))
+                  _temp_error(hotend, PSTR(MSG_T_THERMAL_RUNAWAY), PSTR(MSG_THERMAL_RUNAWAY));
+              #endif
+
+              // Wait for the sensor lag to die away, then sample at a fixed interval
+              if (!sample_count) {
+                if (input >= sample_start_temp) {
+                  first_sample_ms = ms;
+                  samples[sample_count++] = input;
+                  next_sample_ms = ms + sample_interval;
+                }
+              }
+              else if (ELAPSED(ms, next_sample_ms)) {
+                if (sample_count == MPC_TUNE_SAMPLES) { // Full: keep every other sample, at twice the interval
+                  for (uint8_t i = 0; i < MPC_TUNE_SAMPLES / 2; i++) samples[i] = samples[i * 2];
+                  sample_count = MPC_TUNE_SAMPLES / 2;
+                  sample_interval *= 2;
+                }
+                samples[sample_count++] = input;
+                next_sample_ms += sample_interval;
+              }
+
+              if (input >= temp) {
+                if (sample_count && !(sample_count & 1)) sample_count--; // Odd count puts the middle sample halfway
+
+                // Three equally spaced points on T = A - B * e^(-k * t)
+                float s1 = 0, s2 = 0, s3 = 0, asymp_temp = 0;
+                if (sample_count >= 3) {
+                  s1 = samples[0];
+                  s2 = samples[sample_count >> 1];
+                  s3 = samples[sample_count - 1];
+                  const float curve = 2 * s2 - s1 - s3;
+                  if (curve > 0) asymp_temp = (sq(s2) - s1 * s3) / curve;
+                }
+
+                if (asymp_temp <= s3) {
+                  SERIAL_PROTOCOLLNPGM(MSG_MPC_BAD_FIT);
+                  disable_all_heaters();
+                  return;
+                }
+
+                block_responsiveness = -log((s2 - asymp_temp) / (s1 - asymp_temp)) / (0.001 * sample_interval * (sample_count >> 1));
+                tuned.ambient_xfer_coeff = full_power / (asymp_temp - tuned.ambient_temp);
+                tuned.block_heat_capacity = tuned.ambient_xfer_coeff / block_responsiveness;
+                tuned.sensor_responsiveness = block_responsiveness / (1 - (tuned.ambient_temp - asymp_temp)
+                  * exp(-block_responsiveness * 0.001 * (first_sample_ms - heat_start_ms)) / (s1 - asymp_temp));
+
+                // Hold the target using the model found so far
+                mpc[hotend] = tuned;
+                mpc_model_ready[hotend] = false;
+                target_temperature[hotend] = temp;
+                phase = MPCSettling;
+                phase_ms = ms + 20000UL;
+                SERIAL_ECHOLNPGM(MSG_MPC_MEASURING);
+              }
+              break;
+
+            case MPCSettling:
+            case MPCMeasuring:
+              #if WATCH_HOTENDS
+                // Holding at the target, so a big drop means the heater or sensor failed
+                if (input < temp - MAX_OVERSHOOT_MPC_AUTOTUNE)
+                  _temp_error(hotend, PSTR(MSG_T_THERMAL_RUNAWAY), PSTR(MSG_THERMAL_RUNAWAY));
+              #endif
+              soft_pwm_amount[hotend] = (int)get_mpc_output(hotend) >> 1;
+              if (phase == MPCMeasuring) {
+                power_sum += mpc_last_power[hotend];
+                temp_sum += input;
+                measure_count++;
+              }
+              if (ELAPSED(ms, phase_ms)) {
+                if (phase == MPCSettling) {
+                  phase = MPCMeasuring;
+                  phase_ms = ms + 30000UL;
+                  break;
+                }
+
+                tuned.ambient_xfer_coeff = power_sum / (temp_sum - tuned.ambient_temp * measure_count);
+
+                SERIAL_PROTOCOLLNPGM(MSG_MPC_AUTOTUNE_FINISHED);
+                SERIAL_PROTOCOLPGM("#define  MPC_BLOCK_HEAT_CAPACITY ");
+                SERIAL_PROTOCOL_F(tuned.block_heat_capacity, 2); SERIAL_EOL();
+                SERIAL_PROTOCOLPGM("#define  MPC_SENSOR_RESPONSIVENESS ");
+                SERIAL_PROTOCOL_F(tuned.sensor_responsiveness, 4); SERIAL_EOL();
+                SERIAL_PROTOCOLPGM("#define  MPC_AMBIENT_XFER_COEFF ");
+                SERIAL_PROTOCOL_F(tuned.ambient_xfer_coeff, 4); SERIAL_EOL();
+
+                // Use the result? (As with "M303 U1")
+                mpc[hotend] = set_result ? tuned : saved;
+                mpc_model_ready[hotend] = false;
+                disable_all_heaters();
+                return;
+              }
+              break;
+          }
+        }
+
+        if (input > temp + MAX_OVERSHOOT_MPC_AUTOTUNE || input > temp_limit) {
+          SERIAL_PROTOCOLLNPGM(MSG_PID_TEMP_TOO_HIGH);
+          break;
+        }
+
+        // Every 2 seconds...
+        if (ELAPSED(ms, next_temp_ms)) {
+          #if HAS_TEMP_HOTEND
+            print_heaterstates();
+            SERIAL_EOL();
+          #endif
+          next_temp_ms = ms + 2000UL;
+        }
+
+        // A working heater reaches the target well within 20 minutes
+        if (phase == MPCHeating && ELAPSED(ms, heat_start_ms + 20UL * 60UL * 1000UL)) {
+          SERIAL_PROTOCOLLNPGM(MSG_PID_TIMEOUT);
+          break;
+        }
+
+        lcd_update();
+      }
+      mpc[hotend] = saved;
+      mpc_model_ready[hotend] = false;
+      disable_all_heaters();
+    }
+
+  #endif // MPC_HOTEND
+
 #endif // HAS_PID_HEATING
 
 /**
@@ -601,7 +843,9 @@ float Temperature::get_pid_output(const int8_t e) {
   #endif
   float pid_output;
   #if ENABLED(PIDTEMP)
-    #if DISABLED(PID_OPENLOOP)
+    #if ENABLED(MPC_HOTEND)
+      pid_output = get_mpc_output(e);
+    #elif DISABLED(PID_OPENLOOP)
       pid_error[HOTEND_INDEX] = target_temperature[HOTEND_INDEX] - current_temperature[HOTEND_INDEX];
       dTerm[HOTEND_INDEX] = K2 * PID_PARAM(Kd, HOTEND_INDEX) * (current_temperature[HOTEND_INDEX] - temp_dState[HOTEND_INDEX]) + K1 * dTerm[HOTEND_INDEX];
       temp_dState[HOTEND_INDEX] = current_temperature[HOTEND_INDEX];
@@ -691,6 +935,76 @@ float Temperature::get_pid_output(const int8_t e) {
   return pid_output;
 }
 
+#if ENABLED(MPC_HOTEND)
+
+  /**
+   * Model Predictive Control
+   *
+   * Step a thermal model of the hotend forward by the power applied over the
+   * last interval, then pull it toward the measured temperature. The output is
+   * the power that brings the modeled block to the target within one interval,
+   * plus what it takes to hold there against ambient loss and the filament the
+   * planner is about to push through.
+   */
+  float Temperature::get_mpc_output(const int8_t e) {
+    #if HOTENDS == 1
+      UNUSED(e);
+    #endif
+    const mpc_t &m = mpc[HOTEND_INDEX];
+    float &block_temp = mpc_block_temp[HOTEND_INDEX],
+          &sensor_temp = mpc_sensor_temp[HOTEND_INDEX];
+
+    if (!mpc_model_ready[HOTEND_INDEX]) {
+      block_temp = sensor_temp = current_temperature[HOTEND_INDEX];
+      mpc_last_power[HOTEND_INDEX] = 0;
+      mpc_model_ready[HOTEND_INDEX] = true;
+    }
+
+    // Filament fed since the last update and filament about to be fed (mm/s).
+    // Every hotend follows the E position, so a tool change doesn't count
+    // what the previous tool pushed through.
+    float e_rate = 0, e_upcoming = 0;
+    const long e_position = stepper.position(E_AXIS);
+    #if HOTENDS > 1
+      if (e == active_extruder)
+    #endif
+    {
+      const uint8_t extruder = active_extruder;
+      if (e_position > mpc_last_e_position[HOTEND_INDEX])
+        e_rate = (e_position - mpc_last_e_position[HOTEND_INDEX]) * planner.steps_to_mm[E_AXIS_N] / (PID_dT);
+      e_upcoming = planner.get_upcoming_e_rate(extruder, MPC_LOOKAHEAD_MS);
+    }
+    mpc_last_e_position[HOTEND_INDEX] = e_position;
+
+    // Advance the model. The sensor trails the block.
+    const float block_delta = block_temp - m.ambient_temp,
+                losses = (m.ambient_xfer_coeff + e_rate * m.filament_heat_capacity_permm) * block_delta;
+    block_temp += (mpc_last_power[HOTEND_INDEX] - losses) * (PID_dT) / m.block_heat_capacity;
+    sensor_temp += (block_temp - sensor_temp) * m.sensor_responsiveness * (PID_dT);
+
+    // Whatever the model missed shows up at the sensor
+    const float correction = (current_temperature[HOTEND_INDEX] - sensor_temp) * (MPC_SMOOTHING_FACTOR);
+    block_temp += correction;
+    sensor_temp += correction;
+
+    float power = 0;
+    if (target_temperature[HOTEND_INDEX]
+      #if HEATER_IDLE_HANDLER
+        && !heater_idle_timeout_exceeded[HOTEND_INDEX]
+      #endif
+    ) {
+      const float target = target_temperature[HOTEND_INDEX],
+                  hold = (m.ambient_xfer_coeff + e_upcoming * m.filament_heat_capacity_permm) * (target - m.ambient_temp);
+      power = (target - block_temp) * m.block_heat_capacity / (PID_dT) + hold;
+      power = constrain(power, 0, m.heater_power * (PID_MAX) / 255.0);
+    }
+    mpc_last_power[HOTEND_INDEX] = power;
+
+    return power * 255.0 / m.heater_power;
+  }
+
+#endif // MPC_HOTEND
+
 #if ENABLED(PIDTEMPBED)
   float Temperature::get_pid_output_bed() {
     float pid_output;
@@ -759,8 +1073,16 @@ void Temperature::manage_heater() {
 
   if (!temp_meas_ready) return;
 
+  #if ENABLED(CPU_PROFILER)
+    ProfileScope profile(PROFILE_MANAGE_HEATER);
+  #endif
+
   updateTemperaturesFromRawValues(); // also resets the watchdog
 
+  #if HAS_PID_HEATING
+    PID_autotune_update();
+  #endif
+
   #if ENABLED(HEATER_0_USES_MAX6675)
     if (current_temperature[0] > min(HEATER_0_MAXTEMP, MAX6675_TMAX - 1.0)) max_temp_error(0);
     if (current_temperature[0] < max(HEATER_0_MINTEMP, MAX6675_TMIN + .01)) min_temp_error(0);
@@ -782,7 +1104,10 @@ void Temperature::manage_heater() {
       thermal_runaway_protection(&thermal_runaway_state_machine[e], &thermal_runaway_timer[e], current_temperature[e], target_temperature[e], e, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
     #endif
 
-    soft_pwm_amount[e] = (current_temperature[e] > minttemp[e] || is_preheating(e)) && current_temperature[e] < maxttemp[e] ? (int)get_pid_output(e) >> 1 : 0;
+    #if ENABLED(PIDTEMP)
+      if (!autotune[e].active) // The relay drives the heater while tuning
+    #endif
+        soft_pwm_amount[e] = (current_temperature[e] > minttemp[e] || is_preheating(e)) && current_temperature[e] < maxttemp[e] ? (int)get_pid_output(e) >> 1 : 0;
 
     #if WATCH_HOTENDS
       // Make sure temperature is increasing
@@ -863,7 +1188,8 @@ void Temperature::manage_heater() {
     #endif
     {
       #if ENABLED(PIDTEMPBED)
-        soft_pwm_amount_bed = WITHIN(current_temperature_bed, BED_MINTEMP, BED_MAXTEMP) ? (int)get_pid_output_bed() >> 1 : 0;
+        if (!autotune[PID_AUTOTUNE_SLOT(-1)].active) // The relay drives the bed while tuning
+          soft_pwm_amount_bed = WITHIN(current_temperature_bed, BED_MINTEMP, BED_MAXTEMP) ? (int)get_pid_output_bed() >> 1 : 0;
 
       #elif ENABLED(BED_LIMIT_SWITCHING)
         // Check if temperature is within the correct band
@@ -893,6 +1219,30 @@ void Temperature::manage_heater() {
 
 #define PGM_RD_W(x)   (short)pgm_read_word(&x)
 
+/**
+ * Convert a raw ADC value to Celsius using a thermistor table.
+ *
+ * Tables are sorted by ascending raw value, so a binary search finds
+ * the first entry above 'raw' in O(log n) PROGMEM reads. The result is
+ * interpolated from that entry and its predecessor, exactly as the
+ * original linear scan did, including extrapolation below the first
+ * entry and clamping to the last entry on overflow.
+ */
+static float temp_from_table(const short (*tt)[2], const uint8_t len, const int raw) {
+  uint8_t l = 1, r = len;
+  while (l < r) {
+    const uint8_t m = (l + r) >> 1;
+    if (PGM_RD_W(tt[m][0]) > raw) r = m; else l = m + 1;
+  }
+
+  // Overflow: Set to last value in the table
+  if (l >= len) return PGM_RD_W(tt[len - 1][1]);
+
+  const short r0 = PGM_RD_W(tt[l - 1][0]), t0 = PGM_RD_W(tt[l - 1][1]),
+              r1 = PGM_RD_W(tt[l][0]),     t1 = PGM_RD_W(tt[l][1]);
+  return t0 + (raw - r0) * (float)(t1 - t0) / (float)(r1 - r0);
+}
+
 // Derived from RepRap FiveD extruder::getTemperature()
 // For hot end temperature measurement.
 float Temperature::analog2temp(int raw, uint8_t e) {
@@ -913,26 +1263,9 @@ float Temperature::analog2temp(int raw, uint8_t e) {
     if (e == 0) return 0.25 * raw;
   #endif
 
-  if (heater_ttbl_map[e] != NULL) {
-    float celsius = 0;
-    uint8_t i;
-    short(*tt)[][2] = (short(*)[][2])(heater_ttbl_map[e]);
-
-    for (i = 1; i < heater_ttbllen_map[e]; i++) {
-      if (PGM_RD_W((*tt)[i][0]) > raw) {
-        celsius = PGM_RD_W((*tt)[i - 1][1]) +
-                  (raw - PGM_RD_W((*tt)[i - 1][0])) *
-                  (float)(PGM_RD_W((*tt)[i][1]) - PGM_RD_W((*tt)[i - 1][1])) /
-                  (float)(PGM_RD_W((*tt)[i][0]) - PGM_RD_W((*tt)[i - 1][0]));
-        break;
-      }
-    }
-
-    // Overflow: Set to last value in the table
-    if (i == heater_ttbllen_map[e]) celsius = PGM_RD_W((*tt)[i - 1][1]);
+  if (heater_ttbl_map[e] != NULL)
+    return temp_from_table((const short(*)[2])heater_ttbl_map[e], heater_ttbllen_map[e], raw);
 
-    return celsius;
-  }
   return ((raw * ((5.0 * 100.0) / 1024.0) / OVERSAMPLENR) * (TEMP_SENSOR_AD595_GAIN)) + TEMP_SENSOR_AD595_OFFSET;
 }
 
@@ -940,23 +1273,7 @@ float Temperature::analog2temp(int raw, uint8_t e) {
 // For bed temperature measurement.
 float Temperature::analog2tempBed(const int raw) {
   #if ENABLED(BED_USES_THERMISTOR)
-    float celsius = 0;
-    byte i;
-
-    for (i = 1; i < BEDTEMPTABLE_LEN; i++) {
-      if (PGM_RD_W(BEDTEMPTABLE[i][0]) > raw) {
-        celsius  = PGM_RD_W(BEDTEMPTABLE[i - 1][1]) +
-                   (raw - PGM_RD_W(BEDTEMPTABLE[i - 1][0])) *
-                   (float)(PGM_RD_W(BEDTEMPTABLE[i][1]) - PGM_RD_W(BEDTEMPTABLE[i - 1][1])) /
-                   (float)(PGM_RD_W(BEDTEMPTABLE[i][0]) - PGM_RD_W(BEDTEMPTABLE[i - 1][0]));
-        break;
-      }
-    }
-
-    // Overflow: Set to last value in the table
-    if (i == BEDTEMPTABLE_LEN) celsius = PGM_RD_W(BEDTEMPTABLE[i - 1][1]);
-
-    return celsius;
+    return temp_from_table(BEDTEMPTABLE, BEDTEMPTABLE_LEN, raw);
 
   #elif defined(BED_USES_AD595)
 
@@ -1087,6 +1404,10 @@ void Temperature::init() {
     #endif
   #endif
 
+  #if ENABLED(HARDWARE_PWM_HEATERS)
+    init_hardware_pwm();
+  #endif
+
   #if ENABLED(HEATER_0_USES_MAX6675)
 
     OUT_WRITE(SCK_PIN, LOW);
@@ -1124,6 +1445,34 @@ void Temperature::init() {
     HAL_ANALOG_SELECT(FILWIDTH_PIN);
   #endif
 
+  #if ENABLED(ADC_CONTINUOUS_SCAN)
+    // In ADCScanSlot order
+    const pin_t scan_pins[] = {
+      #if HAS_TEMP_0
+        TEMP_0_PIN,
+      #endif
+      #if HAS_TEMP_1
+        TEMP_1_PIN,
+      #endif
+      #if HAS_TEMP_2
+        TEMP_2_PIN,
+      #endif
+      #if HAS_TEMP_3
+        TEMP_3_PIN,
+      #endif
+      #if HAS_TEMP_4
+        TEMP_4_PIN,
+      #endif
+      #if HAS_TEMP_BED
+        TEMP_BED_PIN,
+      #endif
+      #if ENABLED(FILAMENT_WIDTH_SENSOR)
+        FILWIDTH_PIN,
+      #endif
+    };
+    HAL_adc_scan_init(scan_pins, COUNT(scan_pins));
+  #endif
+
   // todo: HAL: fix abstraction
   #ifdef __AVR__
     // Use timer0 for temperature measurement
@@ -1420,6 +1769,132 @@ void Temperature::init() {
 
 #endif // THERMAL_PROTECTION_HOTENDS || THERMAL_PROTECTION_BED
 
+#if ENABLED(HARDWARE_PWM_HEATERS)
+
+  /**
+   * Bind heater outputs (and soft PWM fans) to hardware PWM channels where
+   * the HAL has one free. Unbound outputs stay on soft PWM in the ISR.
+   */
+  void Temperature::init_hardware_pwm() {
+    #define _HW_PWM_ATTACH(N, P) do{ if (HAL_pwm_attach(P)) SBI(hw_pwm_bound, N); }while(0)
+    #if DISABLED(HEATERS_PARALLEL)
+      _HW_PWM_ATTACH(HW_PWM_HEATER_0, HEATER_0_PIN);
+    #endif
+    #if HOTENDS > 1
+      _HW_PWM_ATTACH(HW_PWM_HEATER_1, HEATER_1_PIN);
+      #if HOTENDS > 2
+        _HW_PWM_ATTACH(HW_PWM_HEATER_2, HEATER_2_PIN);
+        #if HOTENDS > 3
+          _HW_PWM_ATTACH(HW_PWM_HEATER_3, HEATER_3_PIN);
+          #if HOTENDS > 4
+            _HW_PWM_ATTACH(HW_PWM_HEATER_4, HEATER_4_PIN);
+          #endif
+        #endif
+      #endif
+    #endif
+    #if HAS_HEATER_BED
+      _HW_PWM_ATTACH(HW_PWM_BED, HEATER_BED_PIN);
+      #if HEATER_BED_INVERTING
+        if (TEST(hw_pwm_bound, HW_PWM_BED)) HAL_pwm_write(HEATER_BED_PIN, 255);
+      #endif
+    #endif
+    #if ENABLED(FAN_SOFT_PWM)
+      #if HAS_FAN0
+        _HW_PWM_ATTACH(HW_PWM_FAN_0, FAN_PIN);
+      #endif
+      #if HAS_FAN1
+        _HW_PWM_ATTACH(HW_PWM_FAN_1, FAN1_PIN);
+      #endif
+      #if HAS_FAN2
+        _HW_PWM_ATTACH(HW_PWM_FAN_2, FAN2_PIN);
+      #endif
+    #endif
+  }
+
+  /**
+   * Push changed duty cycles to the bound hardware channels.
+   * Heater amounts are 7-bit, so stretch them to the full 0-255 range.
+   */
+  void Temperature::update_hardware_pwm() {
+    #define _HW_PWM_WRITE(N, P, V) do{ \
+      const uint8_t v = (V); \
+      if (TEST(hw_pwm_bound, N) && v != hw_pwm_value[N]) HAL_pwm_write(P, hw_pwm_value[N] = v); \
+    }while(0)
+    #define _HEATER_DUTY(A) (((A) << 1) | ((A) >> 6))
+
+    #if DISABLED(HEATERS_PARALLEL)
+      _HW_PWM_WRITE(HW_PWM_HEATER_0, HEATER_0_PIN, _HEATER_DUTY(POWER_GRANTED(0, soft_pwm_amount[0])));
+    #endif
+    #if HOTENDS > 1
+      _HW_PWM_WRITE(HW_PWM_HEATER_1, HEATER_1_PIN, _HEATER_DUTY(POWER_GRANTED(1, soft_pwm_amount[1])));
+      #if HOTENDS > 2
+        _HW_PWM_WRITE(HW_PWM_HEATER_2, HEATER_2_PIN, _HEATER_DUTY(POWER_GRANTED(2, soft_pwm_amount[2])));
+        #if HOTENDS > 3
+          _HW_PWM_WRITE(HW_PWM_HEATER_3, HEATER_3_PIN, _HEATER_DUTY(POWER_GRANTED(3, soft_pwm_amount[3])));
+          #if HOTENDS > 4
+            _HW_PWM_WRITE(HW_PWM_HEATER_4, HEATER_4_PIN, _HEATER_DUTY(POWER_GRANTED(4, soft_pwm_amount[4])));
+          #endif
+        #endif
+      #endif
+    #endif
+    #if HAS_HEATER_BED
+      _HW_PWM_WRITE(HW_PWM_BED, HEATER_BED_PIN,
+        #if HEATER_BED_INVERTING
+          255 -
+        #endif
+        _HEATER_DUTY(POWER_GRANTED(HOTENDS, soft_pwm_amount_bed))
+      );
+    #endif
+    #if ENABLED(FAN_SOFT_PWM)
+      #if HAS_FAN0
+        _HW_PWM_WRITE(HW_PWM_FAN_0, FAN_PIN, soft_pwm_amount_fan[0]);
+      #endif
+      #if HAS_FAN1
+        _HW_PWM_WRITE(HW_PWM_FAN_1, FAN1_PIN, soft_pwm_amount_fan[1]);
+      #endif
+      #if HAS_FAN2
+        _HW_PWM_WRITE(HW_PWM_FAN_2, FAN2_PIN, soft_pwm_amount_fan[2]);
+      #endif
+    #endif
+  }
+
+#endif // HARDWARE_PWM_HEATERS
+
+#if ENABLED(HEATER_POWER_BUDGET)
+
+  #if HAS_HEATER_BED
+    #define POWER_HEATERS (HOTENDS + 1)
+  #else
+    #define POWER_HEATERS HOTENDS
+  #endif
+
+  /**
+   * Pick the heaters that may switch on for the coming PWM cycle. Each heater
+   * that wants power is granted it in turn while its rating fits in what's
+   * left of the budget. Start with the next heater each cycle to share fairly.
+   */
+  void Temperature::allot_heater_power() {
+    static const uint16_t hotend_watts[] PROGMEM = HOTEND_HEATER_WATTS;
+    static uint8_t first_heater = 0;
+
+    uint16_t spare = HEATER_BUDGET_WATTS;
+    uint8_t grant = 0;
+    for (uint8_t i = 0, h = first_heater; i < POWER_HEATERS; i++) {
+      const bool is_bed = h == HOTENDS;
+      const uint16_t watts = is_bed ? BED_HEATER_WATTS : pgm_read_word(&hotend_watts[h]);
+      if ((is_bed ? soft_pwm_amount_bed : soft_pwm_amount[h]) && watts <= spare) {
+        SBI(grant, h);
+        spare -= watts;
+      }
+      if (++h == POWER_HEATERS) h = 0;
+    }
+    if (++first_heater == POWER_HEATERS) first_heater = 0;
+
+    heater_power_grant = grant;
+  }
+
+#endif // HEATER_POWER_BUDGET
+
 void Temperature::disable_all_heaters() {
 
   #if ENABLED(AUTOTEMP)
@@ -1429,6 +1904,11 @@ void Temperature::disable_all_heaters() {
   HOTEND_LOOP() setTargetHotend(0, e);
   setTargetBed(0);
 
+  // Stop any autotune in progress
+  #if HAS_PID_HEATING
+    for (uint8_t i = 0; i < PID_AUTOTUNE_SLOTS; i++) autotune[i].active = false;
+  #endif
+
   // Unpause and reset everything
   #if ENABLED(PROBING_HEATERS_OFF)
     pause(false);
@@ -1466,6 +1946,13 @@ void Temperature::disable_all_heaters() {
       WRITE_HEATER_BED(LOW);
     #endif
   #endif
+
+  #if ENABLED(HARDWARE_PWM_HEATERS)
+    // Don't wait for the next PWM cycle
+    CRITICAL_SECTION_START;
+    update_hardware_pwm();
+    CRITICAL_SECTION_END;
+  #endif
 }
 
 #if ENABLED(PROBING_HEATERS_OFF)
@@ -1616,6 +2103,10 @@ void Temperature::isr() {
   if (in_temp_isr) return;
   in_temp_isr = true;
 
+  #if ENABLED(CPU_PROFILER)
+    ProfileScope profile(PROFILE_TEMP_ISR);
+  #endif
+
   // Allow UART and stepper ISRs
   DISABLE_TEMPERATURE_INTERRUPT(); //Disable Temperature ISR
   #ifndef CPU_32_BIT
@@ -1623,7 +2114,9 @@ void Temperature::isr() {
   #endif
 
   static int8_t temp_count = -1;
-  static ADCSensorState adc_sensor_state = StartupDelay;
+  #if DISABLED(ADC_CONTINUOUS_SCAN)
+    static ADCSensorState adc_sensor_state = StartupDelay;
+  #endif
   static uint8_t pwm_count = _BV(SOFT_PWM_SCALE);
   // avoid multiple loads of pwm_count
   uint8_t pwm_count_tmp = pwm_count;
@@ -1676,75 +2169,92 @@ void Temperature::isr() {
     /**
      * Standard PWM modulation
      */
+
+    // Outputs bound to hardware PWM are left alone
+    #if ENABLED(HARDWARE_PWM_HEATERS)
+      #define SOFT_PWM_WRITE(N, W) do{ if (!TEST(hw_pwm_bound, N)) W; }while(0)
+    #else
+      #define SOFT_PWM_WRITE(N, W) W
+    #endif
+
     if (pwm_count_tmp >= 127) {
       pwm_count_tmp -= 127;
-      soft_pwm_count_0 = (soft_pwm_count_0 & pwm_mask) + soft_pwm_amount[0];
-      WRITE_HEATER_0(soft_pwm_count_0 > pwm_mask ? HIGH : LOW);
+
+      #if ENABLED(HEATER_POWER_BUDGET)
+        allot_heater_power();
+      #endif
+
+      #if ENABLED(HARDWARE_PWM_HEATERS)
+        update_hardware_pwm();
+      #endif
+
+      soft_pwm_count_0 = (soft_pwm_count_0 & pwm_mask) + POWER_GRANTED(0, soft_pwm_amount[0]);
+      SOFT_PWM_WRITE(HW_PWM_HEATER_0, WRITE_HEATER_0(soft_pwm_count_0 > pwm_mask ? HIGH : LOW));
       #if HOTENDS > 1
-        soft_pwm_count_1 = (soft_pwm_count_1 & pwm_mask) + soft_pwm_amount[1];
-        WRITE_HEATER_1(soft_pwm_count_1 > pwm_mask ? HIGH : LOW);
+        soft_pwm_count_1 = (soft_pwm_count_1 & pwm_mask) + POWER_GRANTED(1, soft_pwm_amount[1]);
+        SOFT_PWM_WRITE(HW_PWM_HEATER_1, WRITE_HEATER_1(soft_pwm_count_1 > pwm_mask ? HIGH : LOW));
         #if HOTENDS > 2
-          soft_pwm_count_2 = (soft_pwm_count_2 & pwm_mask) + soft_pwm_amount[2];
-          WRITE_HEATER_2(soft_pwm_count_2 > pwm_mask ? HIGH : LOW);
+          soft_pwm_count_2 = (soft_pwm_count_2 & pwm_mask) + POWER_GRANTED(2, soft_pwm_amount[2]);
+          SOFT_PWM_WRITE(HW_PWM_HEATER_2, WRITE_HEATER_2(soft_pwm_count_2 > pwm_mask ? HIGH : LOW));
           #if HOTENDS > 3
-            soft_pwm_count_3 = (soft_pwm_count_3 & pwm_mask) + soft_pwm_amount[3];
-            WRITE_HEATER_3(soft_pwm_count_3 > pwm_mask ? HIGH : LOW);
+            soft_pwm_count_3 = (soft_pwm_count_3 & pwm_mask) + POWER_GRANTED(3, soft_pwm_amount[3]);
+            SOFT_PWM_WRITE(HW_PWM_HEATER_3, WRITE_HEATER_3(soft_pwm_count_3 > pwm_mask ? HIGH : LOW));
             #if HOTENDS > 4
-              soft_pwm_count_4 = (soft_pwm_count_4 & pwm_mask) + soft_pwm_amount[4];
-              WRITE_HEATER_4(soft_pwm_count_4 > pwm_mask ? HIGH : LOW);
+              soft_pwm_count_4 = (soft_pwm_count_4 & pwm_mask) + POWER_GRANTED(4, soft_pwm_amount[4]);
+              SOFT_PWM_WRITE(HW_PWM_HEATER_4, WRITE_HEATER_4(soft_pwm_count_4 > pwm_mask ? HIGH : LOW));
             #endif // HOTENDS > 4
           #endif // HOTENDS > 3
         #endif // HOTENDS > 2
       #endif // HOTENDS > 1
 
       #if HAS_HEATER_BED
-        soft_pwm_count_BED = (soft_pwm_count_BED & pwm_mask) + soft_pwm_amount_bed;
-        WRITE_HEATER_BED(soft_pwm_count_BED > pwm_mask ? HIGH : LOW);
+        soft_pwm_count_BED = (soft_pwm_count_BED & pwm_mask) + POWER_GRANTED(HOTENDS, soft_pwm_amount_bed);
+        SOFT_PWM_WRITE(HW_PWM_BED, WRITE_HEATER_BED(soft_pwm_count_BED > pwm_mask ? HIGH : LOW));
       #endif
 
       #if ENABLED(FAN_SOFT_PWM)
         #if HAS_FAN0
           soft_pwm_count_fan[0] = (soft_pwm_count_fan[0] & pwm_mask) + (soft_pwm_amount_fan[0] >> 1);
-          WRITE_FAN(soft_pwm_count_fan[0] > pwm_mask ? HIGH : LOW);
+          SOFT_PWM_WRITE(HW_PWM_FAN_0, WRITE_FAN(soft_pwm_count_fan[0] > pwm_mask ? HIGH : LOW));
         #endif
         #if HAS_FAN1
           soft_pwm_count_fan[1] = (soft_pwm_count_fan[1] & pwm_mask) + (soft_pwm_amount_fan[1] >> 1);
-          WRITE_FAN1(soft_pwm_count_fan[1] > pwm_mask ? HIGH : LOW);
+          SOFT_PWM_WRITE(HW_PWM_FAN_1, WRITE_FAN1(soft_pwm_count_fan[1] > pwm_mask ? HIGH : LOW));
         #endif
         #if HAS_FAN2
           soft_pwm_count_fan[2] = (soft_pwm_count_fan[2] & pwm_mask) + (soft_pwm_amount_fan[2] >> 1);
-          WRITE_FAN2(soft_pwm_count_fan[2] > pwm_mask ? HIGH : LOW);
+          SOFT_PWM_WRITE(HW_PWM_FAN_2, WRITE_FAN2(soft_pwm_count_fan[2] > pwm_mask ? HIGH : LOW));
         #endif
       #endif
     }
     else {
-      if (soft_pwm_count_0 <= pwm_count_tmp) WRITE_HEATER_0(LOW);
+      if (soft_pwm_count_0 <= pwm_count_tmp) SOFT_PWM_WRITE(HW_PWM_HEATER_0, WRITE_HEATER_0(LOW));
       #if HOTENDS > 1
-        if (soft_pwm_count_1 <= pwm_count_tmp) WRITE_HEATER_1(LOW);
+        if (soft_pwm_count_1 <= pwm_count_tmp) SOFT_PWM_WRITE(HW_PWM_HEATER_1, WRITE_HEATER_1(LOW));
         #if HOTENDS > 2
-          if (soft_pwm_count_2 <= pwm_count_tmp) WRITE_HEATER_2(LOW);
+          if (soft_pwm_count_2 <= pwm_count_tmp) SOFT_PWM_WRITE(HW_PWM_HEATER_2, WRITE_HEATER_2(LOW));
           #if HOTENDS > 3
-            if (soft_pwm_count_3 <= pwm_count_tmp) WRITE_HEATER_3(LOW);
+            if (soft_pwm_count_3 <= pwm_count_tmp) SOFT_PWM_WRITE(HW_PWM_HEATER_3, WRITE_HEATER_3(LOW));
             #if HOTENDS > 4
-              if (soft_pwm_count_4 <= pwm_count_tmp) WRITE_HEATER_4(LOW);
+              if (soft_pwm_count_4 <= pwm_count_tmp) SOFT_PWM_WRITE(HW_PWM_HEATER_4, WRITE_HEATER_4(LOW));
             #endif // HOTENDS > 4
           #endif // HOTENDS > 3
         #endif // HOTENDS > 2
       #endif // HOTENDS > 1
 
       #if HAS_HEATER_BED
-        if (soft_pwm_count_BED <= pwm_count_tmp) WRITE_HEATER_BED(LOW);
+        if (soft_pwm_count_BED <= pwm_count_tmp) SOFT_PWM_WRITE(HW_PWM_BED, WRITE_HEATER_BED(LOW));
       #endif
 
       #if ENABLED(FAN_SOFT_PWM)
         #if HAS_FAN0
-          if (soft_pwm_count_fan[0] <= pwm_count_tmp) WRITE_FAN(LOW);
+          if (soft_pwm_count_fan[0] <= pwm_count_tmp) SOFT_PWM_WRITE(HW_PWM_FAN_0, WRITE_FAN(LOW));
         #endif
         #if HAS_FAN1
-          if (soft_pwm_count_fan[1] <= pwm_count_tmp) WRITE_FAN1(LOW);
+          if (soft_pwm_count_fan[1] <= pwm_count_tmp) SOFT_PWM_WRITE(HW_PWM_FAN_1, WRITE_FAN1(LOW));
         #endif
         #if HAS_FAN2
-          if (soft_pwm_count_fan[2] <= pwm_count_tmp) WRITE_FAN2(LOW);
+          if (soft_pwm_count_fan[2] <= pwm_count_tmp) SOFT_PWM_WRITE(HW_PWM_FAN_2, WRITE_FAN2(LOW));
         #endif
       #endif
     }
@@ -1905,124 +2415,169 @@ void Temperature::isr() {
   static bool do_buttons;
   if ((do_buttons ^= true)) lcd_buttons_update();
 
-  /**
-   * One sensor is sampled on every other call of the ISR.
-   * Each sensor is read 16 (OVERSAMPLENR) times, taking the average.
-   *
-   * On each Prepare pass, ADC is started for a sensor pin.
-   * On the next pass, the ADC value is read and accumulated.
-   *
-   * This gives each ADC 0.9765ms to charge up.
-   */
+  #if ENABLED(ADC_CONTINUOUS_SCAN)
 
-  switch (adc_sensor_state) {
-
-    case SensorsReady: {
-      // All sensors have been read. Stay in this state for a few
-      // ISRs to save on calls to temp update/checking code below.
-      constexpr int8_t extra_loops = MIN_ADC_ISR_LOOPS - (int8_t)SensorsReady;
-      static uint8_t delay_count = 0;
-      if (extra_loops > 0) {
-        if (delay_count == 0) delay_count = extra_loops;   // Init this delay
-        if (--delay_count)                                 // While delaying...
-          adc_sensor_state = (ADCSensorState)(int(SensorsReady) - 1); // retain this state (else, next state will be 0)
-        break;
-      }
-      else
-        adc_sensor_state = (ADCSensorState)0; // Fall-through to start first sensor now
-    }
+    /**
+     * The HAL converts all sensors continuously in the background,
+     * so every sensor is sampled on every call of the ISR.
+     * Each sensor is read 16 (OVERSAMPLENR) times, taking the average.
+     */
+    HAL_adc_scan_update();
 
     #if HAS_TEMP_0
-      case PrepareTemp_0:
-        HAL_START_ADC(TEMP_0_PIN);
-        break;
-      case MeasureTemp_0:
-        raw_temp_value[0] += HAL_READ_ADC;
-        break;
-    #endif
-
-    #if HAS_TEMP_BED
-      case PrepareTemp_BED:
-        HAL_START_ADC(TEMP_BED_PIN);
-        break;
-      case MeasureTemp_BED:
-        raw_temp_bed_value += HAL_READ_ADC;
-        break;
+      raw_temp_value[0] += HAL_adc_scan_value(ScanTemp_0);
     #endif
-
     #if HAS_TEMP_1
-      case PrepareTemp_1:
-        HAL_START_ADC(TEMP_1_PIN);
-        break;
-      case MeasureTemp_1:
-        raw_temp_value[1] += HAL_READ_ADC;
-        break;
+      raw_temp_value[1] += HAL_adc_scan_value(ScanTemp_1);
     #endif
-
     #if HAS_TEMP_2
-      case PrepareTemp_2:
-        HAL_START_ADC(TEMP_2_PIN);
-        break;
-      case MeasureTemp_2:
-        raw_temp_value[2] += HAL_READ_ADC;
-        break;
+      raw_temp_value[2] += HAL_adc_scan_value(ScanTemp_2);
     #endif
-
     #if HAS_TEMP_3
-      case PrepareTemp_3:
-        HAL_START_ADC(TEMP_3_PIN);
-        break;
-      case MeasureTemp_3:
-        raw_temp_value[3] += HAL_READ_ADC;
-        break;
+      raw_temp_value[3] += HAL_adc_scan_value(ScanTemp_3);
     #endif
-
     #if HAS_TEMP_4
-      case PrepareTemp_4:
-        HAL_START_ADC(TEMP_4_PIN);
-        break;
-      case MeasureTemp_4:
-        raw_temp_value[4] += HAL_READ_ADC;
-        break;
+      raw_temp_value[4] += HAL_adc_scan_value(ScanTemp_4);
+    #endif
+    #if HAS_TEMP_BED
+      raw_temp_bed_value += HAL_adc_scan_value(ScanTemp_BED);
     #endif
-
     #if ENABLED(FILAMENT_WIDTH_SENSOR)
-      case Prepare_FILWIDTH:
-        HAL_START_ADC(FILWIDTH_PIN);
-      break;
-      case Measure_FILWIDTH:
-        if (HAL_READ_ADC > 102) { // Make sure ADC is reading > 0.5 volts, otherwise don't read.
+      {
+        const uint16_t filwidth_adc = HAL_adc_scan_value(Scan_FILWIDTH);
+        if (filwidth_adc > 102) { // Make sure ADC is reading > 0.5 volts, otherwise don't read.
           raw_filwidth_value -= (raw_filwidth_value >> 7); // Subtract 1/128th of the raw_filwidth_value
-          raw_filwidth_value += ((unsigned long)HAL_READ_ADC << 7); // Add new ADC reading, scaled by 128
+          raw_filwidth_value += ((unsigned long)filwidth_adc << 7); // Add new ADC reading, scaled by 128
         }
-      break;
+      }
     #endif
 
-    #if ENABLED(ADC_KEYPAD)
-      case Prepare_ADC_KEY:
-        HAL_START_ADC(ADC_KEYPAD_PIN);
+  #else // !ADC_CONTINUOUS_SCAN
+
+    /**
+     * One sensor is sampled on every other call of the ISR.
+     * Each sensor is read 16 (OVERSAMPLENR) times, taking the average.
+     *
+     * On each Prepare pass, ADC is started for a sensor pin.
+     * On the next pass, the ADC value is read and accumulated.
+     *
+     * This gives each ADC 0.9765ms to charge up.
+     */
+
+    switch (adc_sensor_state) {
+
+      case SensorsReady: {
+        // All sensors have been read. Stay in this state for a few
+        // ISRs to save on calls to temp update/checking code below.
+        constexpr int8_t extra_loops = MIN_ADC_ISR_LOOPS - (int8_t)SensorsReady;
+        static uint8_t delay_count = 0;
+        if (extra_loops > 0) {
+          if (delay_count == 0) delay_count = extra_loops;   // Init this delay
+          if (--delay_count)                                 // While delaying...
+            adc_sensor_state = (ADCSensorState)(int(SensorsReady) - 1); // retain this state (else, next state will be 0)
+          break;
+        }
+        else
+          adc_sensor_state = (ADCSensorState)0; // Fall-through to start first sensor now
+      }
+
+      #if HAS_TEMP_0
+        case PrepareTemp_0:
+          HAL_START_ADC(TEMP_0_PIN);
+          break;
+        case MeasureTemp_0:
+          raw_temp_value[0] += HAL_READ_ADC;
+          break;
+      #endif
+
+      #if HAS_TEMP_BED
+        case PrepareTemp_BED:
+          HAL_START_ADC(TEMP_BED_PIN);
+          break;
+        case MeasureTemp_BED:
+          raw_temp_bed_value += HAL_READ_ADC;
+          break;
+      #endif
+
+      #if HAS_TEMP_1
+        case PrepareTemp_1:
+          HAL_START_ADC(TEMP_1_PIN);
+          break;
+        case MeasureTemp_1:
+          raw_temp_value[1] += HAL_READ_ADC;
+          break;
+      #endif
+
+      #if HAS_TEMP_2
+        case PrepareTemp_2:
+          HAL_START_ADC(TEMP_2_PIN);
+          break;
+        case MeasureTemp_2:
+          raw_temp_value[2] += HAL_READ_ADC;
+          break;
+      #endif
+
+      #if HAS_TEMP_3
+        case PrepareTemp_3:
+          HAL_START_ADC(TEMP_3_PIN);
+          break;
+        case MeasureTemp_3:
+          raw_temp_value[3] += HAL_READ_ADC;
+          break;
+      #endif
+
+      #if HAS_TEMP_4
+        case PrepareTemp_4:
+          HAL_START_ADC(TEMP_4_PIN);
+          break;
+        case MeasureTemp_4:
+          raw_temp_value[4] += HAL_READ_ADC;
+          break;
+      #endif
+
+      #if ENABLED(FILAMENT_WIDTH_SENSOR)
+        case Prepare_FILWIDTH:
+          HAL_START_ADC(FILWIDTH_PIN);
         break;
-      case Measure_ADC_KEY:
-        if (ADCKey_count < 16) {
-          raw_ADCKey_value = ADC;
-          if (raw_ADCKey_value > 900) {
-            //ADC Key release
-            ADCKey_count = 0;
-            current_ADCKey_raw = 0;
+        case Measure_FILWIDTH:
+          if (HAL_READ_ADC > 102) { // Make sure ADC is reading > 0.5 volts, otherwise don't read.
+            raw_filwidth_value -= (raw_filwidth_value >> 7); // Subtract 1/128th of the raw_filwidth_value
+            raw_filwidth_value += ((unsigned long)HAL_READ_ADC << 7); // Add new ADC reading, scaled by 128
           }
-          else {
-            current_ADCKey_raw += raw_ADCKey_value;
-            ADCKey_count++;
-          }
-        }
         break;
-    #endif // ADC_KEYPAD
+      #endif
 
-    case StartupDelay: break;
+      #if ENABLED(ADC_KEYPAD)
+        case Prepare_ADC_KEY:
+          HAL_START_ADC(ADC_KEYPAD_PIN);
+          break;
+        case Measure_ADC_KEY:
+          if (ADCKey_count < 16) {
+            raw_ADCKey_value = ADC;
+            if (raw_ADCKey_value > 900) {
+              //ADC Key release
+              ADCKey_count = 0;
+              current_ADCKey_raw = 0;
+            }
+            else {
+              current_ADCKey_raw += raw_ADCKey_value;
+              ADCKey_count++;
+            }
+          }
+          break;
+      #endif // ADC_KEYPAD
 
-  } // switch(adc_sensor_state)
+      case StartupDelay: break;
 
-  if (!adc_sensor_state && ++temp_count >= OVERSAMPLENR) { // 10 * 16 * 1/(16000000/64/256)  = 164ms.
+    } // switch(adc_sensor_state)
+
+  #endif // !ADC_CONTINUOUS_SCAN
+
+  #if ENABLED(ADC_CONTINUOUS_SCAN)
+    if (++temp_count >= OVERSAMPLENR) { // 16 * 1/1000 = 16ms.
+  #else
+    if (!adc_sensor_state && ++temp_count >= OVERSAMPLENR) { // 10 * 16 * 1/(16000000/64/256)  = 164ms.
+  #endif
 
     temp_count = 0;
 
@@ -2100,9 +2655,11 @@ void Temperature::isr() {
 
   } // temp_count >= OVERSAMPLENR
 
-  // Go to the next state, up to SensorsReady
-  adc_sensor_state = (ADCSensorState)(int(adc_sensor_state) + 1);
-  if (adc_sensor_state > SensorsReady) adc_sensor_state = (ADCSensorState)0;
+  #if DISABLED(ADC_CONTINUOUS_SCAN)
+    // Go to the next state, up to SensorsReady
+    adc_sensor_state = (ADCSensorState)(int(adc_sensor_state) + 1);
+    if (adc_sensor_state > SensorsReady) adc_sensor_state = (ADCSensorState)0;
+  #endif
 
   #if ENABLED(BABYSTEPPING)
     LOOP_XYZ(axis) {
@@ -2125,7 +2682,7 @@ void Temperature::isr() {
 
     if (e_hit && ENDSTOPS_ENABLED) {
       endstops.update();  // call endstop update routine
-      e_hit--;
+      if (!--e_hit) stepper.clear_endstop_latch();
     }
   #endif
 
@@ -86,7 +86,54 @@ enum ADCSensorState {
 // get all oversampled sensor readings
 #define MIN_ADC_ISR_LOOPS 10
 
-#define ACTUAL_ADC_SAMPLES max(int(MIN_ADC_ISR_LOOPS), int(SensorsReady))
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+
+  /**
+   * Slots in the HAL's continuous ADC scan. All sensors are
+   * sampled on every ISR loop, so a round is a single loop.
+   */
+  enum ADCScanSlot : char {
+    #if HAS_TEMP_0
+      ScanTemp_0,
+    #endif
+    #if HAS_TEMP_1
+      ScanTemp_1,
+    #endif
+    #if HAS_TEMP_2
+      ScanTemp_2,
+    #endif
+    #if HAS_TEMP_3
+      ScanTemp_3,
+    #endif
+    #if HAS_TEMP_4
+      ScanTemp_4,
+    #endif
+    #if HAS_TEMP_BED
+      ScanTemp_BED,
+    #endif
+    #if ENABLED(FILAMENT_WIDTH_SENSOR)
+      Scan_FILWIDTH,
+    #endif
+    ScanSlotCount
+  };
+
+  #define ACTUAL_ADC_SAMPLES 1
+
+#else
+
+  #define ACTUAL_ADC_SAMPLES max(int(MIN_ADC_ISR_LOOPS), int(SensorsReady))
+
+#endif
+
+#if ENABLED(HARDWARE_PWM_HEATERS)
+  // Heater and fan outputs that may be bound to a hardware PWM channel
+  enum HardwarePWMOutput : char {
+    HW_PWM_HEATER_0, HW_PWM_HEATER_1, HW_PWM_HEATER_2, HW_PWM_HEATER_3, HW_PWM_HEATER_4,
+    HW_PWM_BED,
+    HW_PWM_FAN_0, HW_PWM_FAN_1, HW_PWM_FAN_2,
+    HW_PWM_OUTPUTS
+  };
+#endif
 
 #if !HAS_HEATER_BED
   constexpr int16_t target_temperature_bed = 0;
@@ -148,6 +195,18 @@ class Temperature {
 
     #endif
 
+    #if ENABLED(MPC_HOTEND)
+      typedef struct {
+        float heater_power,                 // (W) Heater output at full duty
+              block_heat_capacity,          // (J/K) Heater block and nozzle
+              sensor_responsiveness,        // (1/s) Rate at which the sensor follows the block
+              ambient_xfer_coeff,           // (W/K) Heat lost to the surroundings
+              filament_heat_capacity_permm, // (J/K/mm) Heat carried off by the filament
+              ambient_temp;                 // (C) Surroundings, measured by M303
+      } mpc_t;
+      static mpc_t mpc[HOTENDS];
+    #endif
+
     #if ENABLED(PIDTEMPBED)
       static float bedKp, bedKi, bedKd;
     #endif
@@ -206,6 +265,45 @@ class Temperature {
       static bool pid_reset[HOTENDS];
     #endif
 
+    #if HAS_PID_HEATING
+      // Relay autotune state, one slot per PID heater with the bed last
+      typedef struct {
+        bool active, heating, set_result;
+        int8_t cycles, ncycles;
+        float target, max, min, workKp, workKi, workKd;
+        long bias, d, t_high, t_low;
+        millis_t t1, t2;
+        #if WATCH_THE_BED || WATCH_HOTENDS
+          millis_t temp_change_ms;
+          float next_watch_temp;
+          bool heated;
+        #endif
+      } pid_autotune_t;
+
+      #if ENABLED(PIDTEMP)
+        #define PID_AUTOTUNE_HOTENDS HOTENDS
+      #else
+        #define PID_AUTOTUNE_HOTENDS 0
+      #endif
+      #if ENABLED(PIDTEMPBED)
+        #define PID_AUTOTUNE_SLOTS (PID_AUTOTUNE_HOTENDS + 1)
+      #else
+        #define PID_AUTOTUNE_SLOTS PID_AUTOTUNE_HOTENDS
+      #endif
+      #define PID_AUTOTUNE_SLOT(H) ((H) < 0 ? PID_AUTOTUNE_HOTENDS : (H))
+
+      static pid_autotune_t autotune[PID_AUTOTUNE_SLOTS];
+      static void PID_autotune_update();
+    #endif
+
+    #if ENABLED(MPC_HOTEND)
+      static float mpc_block_temp[HOTENDS],   // Modeled heater block temperature
+                   mpc_sensor_temp[HOTENDS],  // Modeled sensor reading
+                   mpc_last_power[HOTENDS];   // (W) Applied over the last interval
+      static bool mpc_model_ready[HOTENDS];
+      static long mpc_last_e_position[HOTENDS]; // E steps at the last update
+    #endif
+
     #if ENABLED(PIDTEMPBED)
       static float temp_iState_bed,
                    temp_dState_bed,
@@ -220,6 +318,18 @@ class Temperature {
     static uint16_t raw_temp_value[MAX_EXTRUDERS],
                     raw_temp_bed_value;
 
+    #if ENABLED(HARDWARE_PWM_HEATERS)
+      static uint16_t hw_pwm_bound;                 // One bit per HardwarePWMOutput driven in hardware
+      static uint8_t hw_pwm_value[HW_PWM_OUTPUTS];  // Last duty written to each bound output
+      static void init_hardware_pwm();
+      static void update_hardware_pwm();
+    #endif
+
+    #if ENABLED(HEATER_POWER_BUDGET)
+      static uint8_t heater_power_grant;            // One bit per heater allowed on this PWM cycle, bed last
+      static void allot_heater_power();
+    #endif
+
     // Init min and max temp with extreme values to prevent false errors during startup
     static int16_t minttemp_raw[HOTENDS],
                    maxttemp_raw[HOTENDS],
@@ -429,7 +539,18 @@ class Temperature {
      * Perform auto-tuning for hotend or bed in response to M303
      */
     #if HAS_PID_HEATING
-      static void PID_autotune(const float temp, const int8_t hotend, const int8_t ncycles, const bool set_result=false);
+      static void PID_autotune(const float temp, const int8_t hotend, const int8_t ncycles, const bool set_result=false, const bool wait=true);
+      static bool PID_autotune_running();
+
+      #if ENABLED(MPC_HOTEND)
+        static void MPC_autotune(const float temp, const int8_t hotend, const bool set_result=false);
+
+        /**
+         * Update the temp manager when a hotend's MPC model changes.
+         * Its modeled temperatures start over from the sensor.
+         */
+        FORCE_INLINE static void updateMPC(const uint8_t e) { mpc_model_ready[e] = false; }
+      #endif
 
       #if ENABLED(PIDTEMP)
         /**
@@ -562,6 +683,10 @@ class Temperature {
 
     static float get_pid_output(const int8_t e);
 
+    #if ENABLED(MPC_HOTEND)
+      static float get_mpc_output(const int8_t e);
+    #endif
+
     #if ENABLED(PIDTEMPBED)
       static float get_pid_output_bed();
     #endif
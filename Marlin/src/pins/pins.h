@@ -37,7 +37,7 @@
 
 #include "../inc/MarlinConfig.h"
 
-#if MB(RAMPS_13_EFB) || MB(RAMPS_14_EFB) || MB(RAMPS_PLUS_EFB) || MB(RAMPS_14_RE_ARM_EFB) || MB(RAMPS_SMART_EFB) || MB(RAMPS_DUO_EFB) || MB(RAMPS4DUE_EFB)
+#if MB(RAMPS_13_EFB) || MB(RAMPS_14_EFB) || MB(RAMPS_PLUS_EFB) || MB(RAMPS_14_RE_ARM_EFB) || MB(RAMPS_SMART_EFB) || MB(RAMPS_DUO_EFB) || MB(RAMPS4DUE_EFB) || MB(LINUX_RAMPS)
   #define IS_RAMPS_EFB
 #elif MB(RAMPS_13_EEB) || MB(RAMPS_14_EEB) || MB(RAMPS_PLUS_EEB) || MB(RAMPS_14_RE_ARM_EEB) || MB(RAMPS_SMART_EEB) || MB(RAMPS_DUO_EEB) || MB(RAMPS4DUE_EEB)
   #define IS_RAMPS_EEB
@@ -330,6 +330,13 @@
   #include "pins_AZTEEG_X5_GT.h"
 #elif MB(BIQU_BQ111_A4)
   #include "pins_BIQU_BQ111_A4.h"
+
+//
+// Simulations - Linux
+//
+
+#elif MB(LINUX_RAMPS)
+  #include "pins_RAMPS_LINUX.h"
 #else
   #error "Unknown MOTHERBOARD value set in Configuration.h"
 #endif
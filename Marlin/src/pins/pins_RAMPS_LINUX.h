@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * RAMPS 1.4 simulated on a Linux host (HAL_LINUX)
+ *
+ * Applies to the following boards:
+ *
+ *  LINUX_RAMPS (Hotend, Fan, Bed)
+ *
+ * The simulated board uses the Arduino Mega pin numbers, plus a virtual
+ * power latch that ends the simulation when M81 or kill() drops it.
+ */
+
+#ifndef __PLAT_LINUX__
+  #error "Oops!  Build the Linux simulation with the 'linux_native' environment."
+#endif
+
+#ifndef BOARD_NAME
+  #define BOARD_NAME       "RAMPS 1.4 (Linux)"
+#endif
+
+#include "pins_RAMPS.h"
+
+#define SUICIDE_PIN        70   // Virtual power latch
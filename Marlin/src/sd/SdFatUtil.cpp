@@ -37,7 +37,9 @@
  * Amount of free RAM
  * \return The number of free bytes.
  */
-#ifdef __arm__
+#ifdef __PLAT_LINUX__
+int SdFatUtil::FreeRam() { return freeMemory(); }
+#elif defined(__arm__)
 extern "C" char* sbrk(int incr);
 int SdFatUtil::FreeRam() {
   char top;
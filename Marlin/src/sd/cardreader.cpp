@@ -456,7 +456,7 @@ void CardReader::removeFile(const char * const name) {
 
   char *dirname_start, *dirname_end;
   if (name[0] == '/') {
-    dirname_start = strchr(name, '/') + 1;
+    dirname_start = (char*)strchr(name, '/') + 1;
     while (dirname_start != NULL) {
       dirname_end = strchr(dirname_start, '/');
       //SERIAL_ECHOPGM("start:");SERIAL_ECHOLN((int)(dirname_start - name));
@@ -0,0 +1,212 @@
+#!/usr/bin/env python
+
+""" Write G-code files for the Linux simulation's replay benchmark (marlin -b).
+
+Each file is a stand-in for one kind of slicer output, generated the same
+way every time so results can be compared between runs and commits:
+
+  arcs.gcode      Rounded outlines printed with dense G2/G3 arcs
+  curves.gcode    Curves sliced into short G1 segments, with retracts and travels
+  delta.gcode     Long moves and spirals across a round bed (for DELTA builds)
+  leveled.gcode   A bed mesh set with M421, then travels and lines across it
+                  (for AUTO_BED_LEVELING_UBL builds, where M421 makes a mesh)
+
+Each file starts like a slicer's, with G28 and waits for the heaters; the
+benchmark skips those and starts every file from the home position.
+"""
+
+from __future__ import print_function, division
+import argparse
+import math
+import os
+import random
+
+__license__ = "GPL"
+
+LAYER = 0.2
+FILAMENT_AREA = math.pi * 1.75 ** 2 / 4
+
+class Writer(object):
+    """ Tracks the position and extrusion, like a slicer's G-code writer """
+    def __init__(self, f):
+        self.f = f
+        self.x = self.y = self.z = self.e = 0.0
+
+    def line(self, text):
+        self.f.write(text + "\n")
+
+    def start(self, x, y, z):
+        self.x, self.y, self.z, self.e = x, y, z, 0.0
+        for text in ("M140 S60", "M104 S210", "G28", "M190 S60", "M109 S210",
+                     "G21", "G90", "M82", "G92 E0", "M106 S255"):
+            self.line(text)
+        self.line("G0 Z%.3f F600" % z)
+        self.line("G0 X%.3f Y%.3f F9000" % (x, y))
+
+    def flow(self, length):
+        return length * 0.45 * LAYER / FILAMENT_AREA
+
+    def travel(self, x, y, f=9000):
+        self.e -= 0.8
+        self.line("G1 E%.5f F2400" % self.e)
+        self.line("G0 X%.3f Y%.3f F%d" % (x, y, f))
+        self.e += 0.8
+        self.line("G1 E%.5f F2400" % self.e)
+        self.x, self.y = x, y
+
+    def move_z(self, z):
+        self.z = z
+        self.line("G1 Z%.3f F600" % z)
+
+    def extrude(self, x, y, f=None):
+        self.e += self.flow(math.hypot(x - self.x, y - self.y))
+        self.line("G1 X%.3f Y%.3f E%.5f%s" % (x, y, self.e, " F%d" % f if f else ""))
+        self.x, self.y = x, y
+
+    def arc(self, cw, x, y, i, j, angle, radius, f=None):
+        self.e += self.flow(abs(angle) * radius)
+        self.line("G%d X%.3f Y%.3f I%.3f J%.3f E%.5f%s" % (
+            2 if cw else 3, x, y, i, j, self.e, " F%d" % f if f else ""))
+        self.x, self.y = x, y
+
+def rounded_rect(w, cx, cy, hw, hh, r, f):
+    """ One rounded rectangle, counterclockwise: straight sides and G3 corners """
+    corners = [(cx + hw - r, cy - hh + r, -90), (cx + hw - r, cy + hh - r, 0),
+               (cx - hw + r, cy + hh - r, 90), (cx - hw + r, cy - hh + r, 180)]
+    start = (cx - hw + r, cy - hh)
+    if math.hypot(w.x - start[0], w.y - start[1]) > 0.01:
+        w.travel(*start)
+    for k, (ox, oy, a0) in enumerate(corners):
+        a0 = math.radians(a0)
+        sx, sy = ox + r * math.cos(a0), oy + r * math.sin(a0)
+        w.extrude(sx, sy, f if k == 0 else None)
+        ex, ey = ox + r * math.cos(a0 + math.pi / 2), oy + r * math.sin(a0 + math.pi / 2)
+        w.arc(False, ex, ey, ox - sx, oy - sy, math.pi / 2, r)
+
+def write_arcs(w, bed):
+    cx, cy = bed[0] / 2, bed[1] / 2
+    w.start(cx, cy, LAYER)
+    for layer in range(12):
+        if layer:
+            w.move_z(LAYER * (layer + 1))
+        # Concentric outlines, then small cylinders of short arcs
+        for ring in range(12):
+            size = 20 + ring * 2.5
+            rounded_rect(w, cx, cy, size, size * 0.7, 2 + ring * 0.4, 1800)
+        for k in range(16):
+            ox = cx + 55 * math.cos(k * math.pi / 8)
+            oy = cy + 55 * math.sin(k * math.pi / 8)
+            w.travel(ox + 3, oy)
+            for n in range(36):
+                a = (n + 1) * math.pi / 18
+                px, py = ox + 3 * math.cos(a), oy + 3 * math.sin(a)
+                w.arc(False, px, py, ox - w.x, oy - w.y, math.pi / 18, 3, 1200 if n == 0 else None)
+
+def write_curves(w, bed):
+    cx, cy = bed[0] / 2, bed[1] / 2
+    w.start(cx, cy, LAYER)
+    rnd = random.Random(1)
+    for layer in range(8):
+        if layer:
+            w.move_z(LAYER * (layer + 1))
+        # A vase-like wavy outline in 0.2-0.4mm segments
+        r0 = 40 + layer * 0.5
+        n = int(2 * math.pi * r0 / 0.3)
+        for k in range(n + 1):
+            a = 2 * math.pi * k / n
+            r = r0 + 3 * math.sin(a * 9 + layer * 0.3)
+            x, y = cx + r * math.cos(a), cy + r * math.sin(a)
+            if k == 0:
+                w.travel(x, y)
+            else:
+                w.extrude(x, y, 2400 if k == 1 else None)
+        # Small text-like islands: jittered short strokes with travels between
+        for island in range(40):
+            ix = cx + rnd.uniform(-30, 30)
+            iy = cy + rnd.uniform(-30, 30)
+            w.travel(ix, iy)
+            a = rnd.uniform(0, 2 * math.pi)
+            for k in range(30):
+                a += rnd.uniform(-0.5, 0.5)
+                step = rnd.uniform(0.1, 0.5)
+                w.extrude(w.x + step * math.cos(a), w.y + step * math.sin(a), 1500 if k == 0 else None)
+        # Infill: a zigzag whose turns are short segments
+        for row in range(40):
+            y = cy - 20 + row
+            x0, x1 = (cx - 20, cx + 20) if row % 2 == 0 else (cx + 20, cx - 20)
+            if row == 0:
+                w.travel(x0, y)
+            w.extrude(x1, y, 4800)
+            w.extrude(x1, y + 0.5)
+
+def write_delta(w, radius):
+    w.start(0, 0, LAYER)
+    rnd = random.Random(2)
+    for layer in range(6):
+        if layer:
+            w.move_z(LAYER * (layer + 1))
+        # Long travels from edge to edge, which the delta splits into segments
+        for k in range(24):
+            a = rnd.uniform(0, 2 * math.pi)
+            w.travel(radius * 0.8 * math.cos(a), radius * 0.8 * math.sin(a), 12000)
+        # An outward spiral in 1mm segments
+        w.travel(0, 0)
+        a, r = 0.0, 1.0
+        while r < radius * 0.7:
+            a += 1.0 / r
+            r = 1.0 + 2.0 * a / (2 * math.pi)
+            w.extrude(r * math.cos(a), r * math.sin(a), 3000)
+        # Long straight extrusions, as for a first layer's perimeter
+        n = 64
+        for k in range(n + 1):
+            a = 2 * math.pi * k / n
+            w.extrude(radius * 0.75 * math.cos(a), radius * 0.75 * math.sin(a), 1800)
+
+def write_leveled(w, bed, grid):
+    w.start(10, 10, LAYER)
+    # A bed that sags in the middle and tilts a little
+    for j in range(grid):
+        for i in range(grid):
+            u, v = i / (grid - 1) - 0.5, j / (grid - 1) - 0.5
+            z = 0.2 * (u * u + v * v) - 0.1 + 0.05 * u
+            w.line("M421 I%d J%d Z%.3f" % (i, j, z))
+    w.line("M420 S1 Z10")
+    rnd = random.Random(3)
+    for layer in range(3):
+        if layer:
+            w.move_z(LAYER * (layer + 1))
+        # Travels between random points, crossing many mesh cells
+        for k in range(60):
+            w.travel(rnd.uniform(10, bed[0] - 10), rnd.uniform(10, bed[1] - 10), 12000)
+        # Lines across the bed
+        for row in range(20):
+            y = 10 + row * (bed[1] - 20) / 19
+            x0, x1 = (10, bed[0] - 10) if row % 2 == 0 else (bed[0] - 10, 10)
+            w.travel(x0, y)
+            w.extrude(x1, y, 3000)
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-o", "--output", default=".", help="directory for the files (default: current)")
+    parser.add_argument("--bed", default="200,200", help="cartesian bed X,Y size in mm (default 200,200)")
+    parser.add_argument("--delta-radius", type=float, default=90, help="delta printable radius in mm (default 90)")
+    parser.add_argument("--grid", type=int, default=10, help="mesh points per side (GRID_MAX_POINTS_X, default 10)")
+    args = parser.parse_args()
+
+    bed = [float(v) for v in args.bed.split(",")]
+    if not os.path.isdir(args.output):
+        os.makedirs(args.output)
+
+    def write(name, fn, *fn_args):
+        path = os.path.join(args.output, name)
+        with open(path, "w") as f:
+            fn(Writer(f), *fn_args)
+        print(path)
+
+    write("arcs.gcode", write_arcs, bed)
+    write("curves.gcode", write_curves, bed)
+    write("delta.gcode", write_delta, args.delta_radius)
+    write("leveled.gcode", write_leveled, bed, args.grid)
+
+if __name__ == "__main__":
+    main()
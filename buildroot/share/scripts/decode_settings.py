@@ -0,0 +1,149 @@
+#!/usr/bin/env python
+
+""" Decode a dump of the Marlin settings store (EEPROM image or eeprom.dat).
+
+Lists each settings record with its tag, version, size and CRC status, and
+decodes the fields of the record versions whose layout doesn't depend on the
+build. Other records are shown as hex, and a version this script doesn't know
+is flagged rather than guessed at. Use --int-size 4 for 32-bit boards.
+"""
+
+from __future__ import print_function
+import argparse
+import struct
+
+__license__ = "GPL"
+
+RECORDS = {
+    1: "STEPPERS", 2: "MOTION", 3: "LEVELING", 4: "DELTA", 5: "PREHEAT",
+    6: "TEMPERATURE", 7: "LCD_CONTRAST", 8: "RETRACT", 9: "FILAMENT",
+    10: "TMC_CURRENT", 11: "LIN_ADVANCE", 12: "MOTOR_CURRENT",
+    13: "COORDINATES", 14: "SKEW"
+}
+
+def crc16(data):
+    """ The CRC16 (CCITT, initial value 0) used by the firmware """
+    crc = 0
+    for b in bytearray(data):
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+def fields(data, fmt):
+    """ Unpack little-endian values, tolerating a short record """
+    size = struct.calcsize('<' + fmt)
+    if len(data) < size:
+        return None
+    return struct.unpack('<' + fmt, data[:size])
+
+def steppers(data, i):
+    n = bytearray(data)[0] + 3
+    v = fields(data[1:], '%df%df%dI' % (n, n, n))
+    return v and [("M92", v[:n]), ("M203", v[n:2 * n]), ("M201", v[2 * n:])]
+
+def motion(data, i):
+    v = fields(data, '3f2fI4f3f')
+    return v and [("M204 P R T", v[0:3]), ("M205 S T", v[3:5]), ("M205 B", v[5:6]),
+                  ("M205 X Y Z E", v[6:10]), ("M206", v[10:13])]
+
+def delta(data, i):
+    v = fields(data, '14f')
+    return v and [("Delta / dual endstops", v)]
+
+def preheat(data, i):
+    v = fields(data, '6' + i)
+    return v and [("M145 H", v[0:2]), ("M145 B", v[2:4]), ("M145 F", v[4:6])]
+
+def temperature_v1(data, i):
+    v = fields(data, '20f' + i + '3f')
+    return v and [("M301 E%d P I D C" % e, v[4 * e:4 * e + 4]) for e in range(5)] + \
+                 [("M301 L", v[20:21]), ("M304 P I D", v[21:24])]
+
+def temperature_v2(data, i):
+    """ Version 1 followed by the MPC model of each hotend """
+    v = fields(data, '20f' + i + '3f30f')
+    return v and temperature_v1(data, i) + \
+                 [("M306 E%d P C R A H T" % e, v[24 + 6 * e:30 + 6 * e]) for e in range(5)]
+
+def lcd_contrast(data, i):
+    v = fields(data, 'H')
+    return v and [("M250 C", v)]
+
+def retract(data, i):
+    v = fields(data, '?8f')
+    return v and [("M209 S", v[0:1]), ("M207 S F Z", v[1:4]), ("M208 S F", v[4:6]),
+                  ("M207 W", v[6:7]), ("M208 W R", v[7:9])]
+
+def filament(data, i):
+    v = fields(data, '?5f')
+    return v and [("M200 volumetric", v[0:1]), ("M200 D", v[1:])]
+
+def tmc_current(data, i):
+    v = fields(data, '11H')
+    return v and [("M906 X Y Z X2 Y2 Z2 E0-E4", v)]
+
+def lin_advance(data, i):
+    v = fields(data, '2f')
+    return v and [("M900 K R", v)]
+
+def motor_current(data, i):
+    v = fields(data, '3I')
+    return v and [("M907", v)]
+
+def coordinates(data, i):
+    v = fields(data, '27f')
+    return v and [("G5%d" % (4 + s) if s < 6 else "G59.%d" % (s - 5), v[3 * s:3 * s + 3]) for s in range(9)]
+
+def skew(data, i):
+    v = fields(data, '3f')
+    return v and [("M852 I J K", v)]
+
+# The layout of each record version the firmware has written. None for a
+# known record whose layout depends on the build.
+LAYOUTS = {
+    (1, 1): steppers, (2, 1): motion, (3, 1): None, (4, 1): delta,
+    (5, 1): preheat, (6, 1): temperature_v1, (6, 2): temperature_v2,
+    (7, 1): lcd_contrast, (8, 1): retract, (9, 1): filament,
+    (10, 1): tmc_current, (11, 1): lin_advance, (12, 1): motor_current,
+    (13, 1): coordinates, (14, 1): skew
+}
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('dump', help='binary dump of the EEPROM or eeprom.dat')
+    parser.add_argument('-o', '--offset', type=int, default=100, help='EEPROM_OFFSET (default=100)')
+    parser.add_argument('-i', '--int-size', type=int, choices=(2, 4), default=2, help='size of int on the board (default=2)')
+    args = parser.parse_args()
+
+    with open(args.dump, 'rb') as f:
+        image = f.read()
+
+    pos = args.offset
+    version = image[pos:pos + 4].split(b'\0')[0].decode('ascii', 'replace')
+    records_size, = struct.unpack('<H', image[pos + 4:pos + 6])
+    print("Version %s, %d bytes of records" % (version, records_size))
+
+    pos += 6
+    end = pos + records_size
+    while pos + 6 <= end:
+        tag, rec_version, size, crc = struct.unpack('<BBHH', image[pos:pos + 6])
+        data = image[pos + 6:pos + 6 + size]
+        ok = len(data) == size and crc16(data) == crc
+        print("\n@%d record %d %s v%d, %d bytes, CRC %s" % (
+            pos, tag, RECORDS.get(tag, "?"), rec_version, size, "ok" if ok else "BAD"))
+        if (tag, rec_version) not in LAYOUTS:
+            print("  Unknown record version, not decoded")
+        layout = LAYOUTS.get((tag, rec_version))
+        values = layout(data, 'h' if args.int_size == 2 else 'i') if ok and layout else None
+        if values:
+            for name, v in values:
+                print("  %-28s %s" % (name, " ".join("%g" % x for x in v)))
+        else:
+            for i in range(0, len(data), 16):
+                print("  " + " ".join("%02x" % b for b in bytearray(data[i:i + 16])))
+        pos += 6 + size
+
+if __name__ == '__main__':
+    main()
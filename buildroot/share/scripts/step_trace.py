@@ -0,0 +1,200 @@
+#!/usr/bin/env python
+
+""" Analyze a Marlin step pulse trace (M930 D over serial, or STEPTRC.TXT).
+
+Reads the last trace found in the input, which may be a whole serial log.
+For each block it compares the step rate the stepper ISR emitted with the
+trapezoid the planner asked for, and for each axis it reports the velocity
+and acceleration profile and the spread of its step intervals.
+
+Use --csv to write every step with the axis positions, the measured and
+planned rates, for plotting.
+"""
+
+from __future__ import print_function, division
+import argparse
+import math
+import sys
+
+__license__ = "GPL"
+
+AXES = "XYZE"
+ADVANCE_BIT = 1 << 7    # E step from the LIN_ADVANCE ISR, not a step event
+
+class Trace(object):
+    def __init__(self):
+        self.rate = 1
+        self.first_event = 0
+        self.blocks = []    # dicts of the block fields
+        self.events = []    # (seq, time, steps, dirs), time unwrapped
+
+def parse(lines):
+    """ Return the last complete trace in lines """
+    trace, current = None, None
+    for line in lines:
+        line = line.strip()
+        if line.startswith("echo:"):
+            line = line[5:]
+        if line.startswith("step_trace rate:"):
+            current = Trace()
+            for field in line.split()[1:]:
+                key, value = field.split(":")
+                if key == "rate":
+                    current.rate = int(value)
+                elif key == "events":
+                    current.first_event = int(value.split("-")[0])
+            seq, last = current.first_event, None
+        elif current is None:
+            continue
+        elif line == "step_trace end":
+            trace, current = current, None
+        elif line.startswith("b "):
+            v = [int(x) for x in line.split()[1:]]
+            current.blocks.append(dict(
+                first_event=v[0], step_event_count=v[1], accelerate_until=v[2], decelerate_after=v[3],
+                initial_rate=v[4], nominal_rate=v[5], final_rate=v[6], acceleration=v[7], steps=v[8:12]))
+        elif line.startswith("s "):
+            t, steps, dirs = line.split()[1:4]
+            t = int(t)
+            # Times are 32-bit tick counts; unwrap them
+            if last is not None:
+                t = last + ((t - last) & 0xFFFFFFFF)
+            last = t
+            current.events.append((seq, t, int(steps, 16), int(dirs, 16)))
+            seq += 1
+    return trace
+
+def planned_rate(block, n):
+    """ The trapezoid's step rate after n step events """
+    a, nominal = block["acceleration"], block["nominal_rate"]
+    if n <= block["accelerate_until"]:
+        return min(nominal, math.sqrt(block["initial_rate"] ** 2 + 2.0 * a * n))
+    if n > block["decelerate_after"]:
+        return min(nominal, math.sqrt(block["final_rate"] ** 2 + 2.0 * a * max(0, block["step_event_count"] - n)))
+    return nominal
+
+def stats(values):
+    if not values:
+        return 0, 0, 0, 0
+    mean = sum(values) / len(values)
+    sd = math.sqrt(sum((v - mean) ** 2 for v in values) / len(values))
+    return min(values), mean, max(values), sd
+
+def analyze_blocks(trace, rows):
+    print("Blocks (rates in step events/s, deviation of the emitted rate from the trapezoid):")
+    print("  %5s %7s %7s %9s %9s %9s %8s %8s %9s" % (
+        "block", "events", "seen", "initial", "nominal", "final", "dev avg", "dev max", "time err"))
+    # Number the step events within each block. Advance steps share the sequence
+    # numbers, so count from whichever end of the block the trace holds; a block
+    # whose start was overwritten is taken to have run to completion.
+    owner, b = {}, -1
+    for seq, _, steps, _ in trace.events:
+        while b + 1 < len(trace.blocks) and seq >= trace.blocks[b + 1]["first_event"]:
+            b += 1
+        if b >= 0 and not steps & ADVANCE_BIT:
+            owner.setdefault(b, []).append(seq)
+    index = {}
+    for b, seqs in owner.items():
+        block = trace.blocks[b]
+        if block["first_event"] >= trace.first_event:
+            numbers = range(len(seqs))
+        else:
+            numbers = range(block["step_event_count"] - len(seqs), block["step_event_count"])
+        for seq, n in zip(seqs, numbers):
+            index[seq] = (b, n)
+    for i, block in enumerate(trace.blocks):
+        mine = [e for e in trace.events if index.get(e[0], (None,))[0] == i]
+        if not mine:
+            continue
+        devs, actual, planned = [], 0.0, 0.0
+        for k in range(1, len(mine)):
+            interval = (mine[k][1] - mine[k - 1][1]) / trace.rate
+            rate = planned_rate(block, index[mine[k][0]][1])
+            actual += interval
+            planned += 1.0 / rate if rate else 0
+            if interval > 0 and rate:
+                dev = (1.0 / interval - rate) / rate * 100
+                devs.append(dev)
+                rows.setdefault(mine[k][0], {}).update(rate=1.0 / interval, planned=rate)
+        _, mean, _, _ = stats(devs)
+        worst = max(devs, key=abs) if devs else 0
+        time_err = (actual - planned) / planned * 100 if planned else 0
+        print("  %5d %7d %7d %9d %9d %9d %7.1f%% %7.1f%% %8.2f%%" % (
+            i, block["step_event_count"], len(mine), block["initial_rate"], block["nominal_rate"],
+            block["final_rate"], mean, worst, time_err))
+        if len(mine) != block["step_event_count"]:
+            print("        (trace holds %d of the block's %d events)" % (len(mine), block["step_event_count"]))
+
+def analyze_axes(trace, window, steps_per_unit, rows):
+    unit = "mm" if steps_per_unit else "steps"
+    print("Axes (velocity in %s/s over %d steps, acceleration in %s/s2):" % (unit, window, unit))
+    print("  %4s %7s %9s %10s %10s %10s %10s" % (
+        "axis", "steps", "net", "v max", "a max", "int min", "int jitter"))
+    for a, name in enumerate(AXES):
+        bit = 1 << a
+        steps = [(t, -1 if dirs & bit else 1, seq) for seq, t, s, dirs in trace.events if s & bit]
+        if not steps:
+            continue
+        scale = 1.0 / steps_per_unit[a] if steps_per_unit else 1.0
+        position, v_prev, t_prev, v_max, a_max = 0, None, None, 0.0, 0.0
+        intervals = [(steps[k][0] - steps[k - 1][0]) / trace.rate for k in range(1, len(steps))]
+        for k, (t, d, seq) in enumerate(steps):
+            position += d
+            rows.setdefault(seq, {})[name] = position * scale
+            if k < window:
+                continue
+            dt = (t - steps[k - window][0]) / trace.rate
+            if dt <= 0:
+                continue
+            v = d * window * scale / dt
+            v_max = max(v_max, abs(v))
+            tm = t - dt * trace.rate / 2
+            if v_prev is not None and tm > t_prev:
+                a_max = max(a_max, abs(v - v_prev) / ((tm - t_prev) / trace.rate))
+            v_prev, t_prev = v, tm
+        # Jitter: how far each interval strays from the mean of its neighbours
+        jitter = [abs(intervals[k] - (intervals[k - 1] + intervals[k + 1]) / 2)
+                  for k in range(1, len(intervals) - 1)]
+        _, _, _, sd = stats(jitter)
+        print("  %4s %7d %9.3f %10.2f %10.1f %8.1fus %8.1fus" % (
+            name, len(steps), position * scale, v_max, a_max,
+            min(intervals) * 1e6 if intervals else 0, sd * 1e6))
+
+def write_csv(trace, rows, filename):
+    with open(filename, "w") as f:
+        f.write("time_s,%s,rate,planned\n" % ",".join(AXES))
+        pos = dict((a, 0.0) for a in AXES)
+        t0 = trace.events[0][1]
+        for seq, t, _, _ in trace.events:
+            row = rows.get(seq, {})
+            for a in AXES:
+                pos[a] = row.get(a, pos[a])
+            f.write("%.7f,%s,%s,%s\n" % ((t - t0) / trace.rate, ",".join("%g" % pos[a] for a in AXES),
+                                        "%.1f" % row["rate"] if "rate" in row else "",
+                                        "%.1f" % row["planned"] if "planned" in row else ""))
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("file", nargs="?", help="serial log or STEPTRC.TXT (default: stdin)")
+    parser.add_argument("-w", "--window", type=int, default=4, help="steps per velocity sample (default 4)")
+    parser.add_argument("-s", "--steps-per-unit", help="X,Y,Z,E steps/mm, to report in mm")
+    parser.add_argument("--csv", help="write per-step positions and rates to this file")
+    args = parser.parse_args()
+
+    trace = parse(open(args.file) if args.file else sys.stdin)
+    if not trace or not trace.events:
+        sys.exit("No step trace found")
+
+    steps_per_unit = [float(x) for x in args.steps_per_unit.split(",")] if args.steps_per_unit else None
+    duration = (trace.events[-1][1] - trace.events[0][1]) / trace.rate
+    print("%d events over %.4fs at %d ticks/s, %d blocks" % (
+        len(trace.events), duration, trace.rate, len(trace.blocks)))
+
+    rows = {}
+    analyze_blocks(trace, rows)
+    analyze_axes(trace, max(1, args.window), steps_per_unit, rows)
+    if args.csv:
+        write_csv(trace, rows, args.csv)
+
+if __name__ == "__main__":
+    main()